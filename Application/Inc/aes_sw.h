@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    aes_sw.h
+  * @author  MCD Application Team
+  * @brief   Header for aes_sw.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __AES_SW_H
+#define __AES_SW_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define AESSW_BLOCK_SIZE        16U
+#define AESSW_KEY_SIZE          16U     /* AES-128 only */
+#define AESSW_ROUNDS            10U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Expanded AES-128 key
+  */
+typedef struct
+{
+  uint8_t RoundKey[(AESSW_ROUNDS + 1U) * AESSW_BLOCK_SIZE];
+} AESSW_ContextTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void AESSW_SetKey(AESSW_ContextTypeDef *Ctx, const uint8_t *Key);
+void AESSW_Encrypt(const AESSW_ContextTypeDef *Ctx, const uint8_t *In, uint8_t *Out);
+
+#endif /* __AES_SW_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
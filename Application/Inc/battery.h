@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    battery.h
+  * @author  MCD Application Team
+  * @brief   Header for battery.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BATTERY_H
+#define __BATTERY_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Seconds between two measurements, counted on the RTC wake-up */
+#define BATT_PERIOD_S           600U
+
+/* Supply thresholds of the battery bar levels, in mV */
+#define BATT_FULL_MV            2900U
+#define BATT_3_4_MV             2800U
+#define BATT_1_2_MV             2700U
+#define BATT_1_4_MV             2550U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     BATT_Init(void);
+void     BATT_OnSecond(void);
+void     BATT_Measure(void);
+uint32_t BATT_GetVdd(void);
+
+#endif /* __BATTERY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    button.h
+  * @author  MCD Application Team
+  * @brief   Header for button.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BUTTON_H
+#define __BUTTON_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "event.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  User button actions, passed to the action handler
+  */
+typedef enum
+{
+  BTN_SHORT = 0,           /*!< Released before BTN_LONG_TICKS         */
+  BTN_LONG,                /*!< Held for BTN_LONG_TICKS                */
+  BTN_REPEAT               /*!< Still held, every BTN_REPEAT_TICKS     */
+} BTN_ActionTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Durations in RTC fast ticks (1 / RTC_FAST_PER_S s) */
+#define BTN_DEBOUNCE_TICKS      2U    /* 62.5 ms with an unchanged level */
+#define BTN_LONG_TICKS          48U   /* 1.5 s                           */
+#define BTN_REPEAT_TICKS        6U    /* about 5 repeats per second      */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void BTN_Init(EVT_HandlerTypeDef Handler);
+void EXTI0_IRQHandler(void);
+
+#endif /* __BUTTON_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
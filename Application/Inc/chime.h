@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    chime.h
+  * @author  MCD Application Team
+  * @brief   Header for chime.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CHIME_H
+#define __CHIME_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Sounds of the clock
+  */
+typedef enum
+{
+  CHIME_HOUR = 0,          /*!< Four bell notes on the hour            */
+  CHIME_ALARM,             /*!< Beeps at the end of the countdown      */
+  CHIME_TICK,              /*!< Click of the time setting, ADPCM       */
+  CHIME_COUNT
+} CHIME_TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* DAC update rate */
+#define CHIME_SAMPLE_RATE       8000U
+
+/* Samples of the DMA ping-pong buffer, refilled half at a time: 16 ms */
+#define CHIME_BUFFER_SAMPLES    256U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     CHIME_Init(void);
+void     CHIME_Play(CHIME_TypeDef Chime);
+void     CHIME_Stop(void);
+uint32_t CHIME_IsPlaying(void);
+void     CHIME_ClockUpdate(void);
+
+#endif /* __CHIME_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    chrono.h
+  * @author  MCD Application Team
+  * @brief   Header for chrono.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CHRONO_H
+#define __CHRONO_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  CHRONO_STOPPED = 0,
+  CHRONO_RUNNING,
+  CHRONO_EXPIRED           /*!< Countdown only: reached zero           */
+} CHRONO_StateTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Countdown preset until CHRONO_CountdownSet() */
+#define CHRONO_COUNTDOWN_DEFAULT_S  300U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     CHRONO_Init(void);
+
+void     CHRONO_StopwatchStart(void);
+void     CHRONO_StopwatchStop(void);
+void     CHRONO_StopwatchReset(void);
+uint32_t CHRONO_StopwatchElapsed(void);
+CHRONO_StateTypeDef CHRONO_StopwatchState(void);
+
+void     CHRONO_CountdownSet(uint32_t seconds);
+void     CHRONO_CountdownReset(void);
+uint32_t CHRONO_CountdownPreset(void);
+void     CHRONO_CountdownStart(void);
+void     CHRONO_CountdownStop(void);
+void     CHRONO_CountdownExpired(void);
+uint32_t CHRONO_CountdownRemaining(void);
+CHRONO_StateTypeDef CHRONO_CountdownState(void);
+
+void     CHRONO_Save(void);
+void     CHRONO_Restore(void);
+
+void     CHRONO_Format(uint8_t *str, uint32_t stamps, uint8_t running);
+
+#endif /* __CHRONO_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
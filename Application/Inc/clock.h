@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    clock.h
+  * @author  MCD Application Team
+  * @brief   Header for clock.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "display.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  What the glass shows
+  */
+typedef enum
+{
+  CLOCK_MODE_TIME = 0,     /*!< Time of day, HH:MM:SS                  */
+  CLOCK_MODE_STOPWATCH,    /*!< Stopwatch                              */
+  CLOCK_MODE_COUNTDOWN,    /*!< Countdown timer                        */
+  CLOCK_MODE_SENSE,        /*!< Temperature and supply, alternately    */
+  CLOCK_MODE_COUNT
+} CLOCK_ModeTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void CLOCK_Init(void);
+void CLOCK_SetMode(CLOCK_ModeTypeDef Mode);
+CLOCK_ModeTypeDef CLOCK_GetMode(void);
+void CLOCK_Refresh(void);
+void CLOCK_TimeFrame(DISPLAY_FrameTypeDef *Frame);
+
+#endif /* __CLOCK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    clock_ll.h
+  * @author  MCD Application Team
+  * @brief   Register-level inline access to the RTC time register, for the
+  *          clock refresh on the RTC wake-up.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The RTC is still initialized by the HAL: only the time read of the
+        refresh goes through these functions, in the build where
+        USE_CLOCK_LL is defined (see main.h). The glass LCD RAM writes of
+        that build are in glass_ll.h.
+    (#) The RTC shadow registers are bypassed, so TR is read once and its
+        BCD digits go to the display as they are, without HAL_RTC_GetTime()
+        and its BCD conversions.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_LL_H
+#define __CLOCK_LL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "stm32l1xx_ll_rtc.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Time of day digits in TR, already in the LL_RTC_TIME_Get() 0x00HHMMSS
+   layout in 24 hour format */
+#define CLOCK_LL_TR_DIGITS      (RTC_TR_HT | RTC_TR_HU | RTC_TR_MNT | RTC_TR_MNU | \
+                                 RTC_TR_ST | RTC_TR_SU)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  Read the time of day.
+  * @note   Shadow registers are bypassed (see RTC_Init()): TR is the running
+  *         counter, consistent in a single read, and DR needs not be read
+  *         to unlock it.
+  * @param  None
+  * @retval Time in BCD, 0x00HHMMSS
+  */
+__STATIC_INLINE uint32_t CLOCK_LL_GetTime(void)
+{
+  return READ_BIT(RTC->TR, CLOCK_LL_TR_DIGITS);
+}
+
+/**
+  * @brief  Convert a duration to the layout of CLOCK_LL_GetTime().
+  * @param  Seconds: Duration, the hours are shown modulo 100
+  * @retval Duration in BCD, 0x00HHMMSS
+  */
+__STATIC_INLINE uint32_t CLOCK_LL_SecondsToBCD(uint32_t Seconds)
+{
+  return ((uint32_t)__LL_RTC_CONVERT_BIN2BCD((Seconds / 3600U) % 100U) << 16U) |
+         ((uint32_t)__LL_RTC_CONVERT_BIN2BCD((Seconds / 60U) % 60U) << 8U) |
+          (uint32_t)__LL_RTC_CONVERT_BIN2BCD(Seconds % 60U);
+}
+
+#endif /* __CLOCK_LL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    display.h
+  * @author  MCD Application Team
+  * @brief   Header for display.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DISPLAY_H
+#define __DISPLAY_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Digits of a time frame, HH:MM:SS */
+#define DISPLAY_DIGITS          6U
+
+/* Dirty cells: one per digit, with the separator after it, and the bar */
+#define DISPLAY_CELL(__POS__)   (1UL << (__POS__))
+#define DISPLAY_CELL_BAR        (1UL << DISPLAY_DIGITS)
+#define DISPLAY_CELL_ALL        ((1UL << (DISPLAY_DIGITS + 1U)) - 1U)
+
+/* Battery bar levels, lit bars out of 4 */
+#define DISPLAY_BAR_OFF         0U
+#define DISPLAY_BAR_1_4         1U
+#define DISPLAY_BAR_1_2         2U
+#define DISPLAY_BAR_3_4         3U
+#define DISPLAY_BAR_FULL        4U
+
+/* Contrast levels */
+#define DISPLAY_CONTRAST_MAX    7U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Time frame: what the digits show
+  */
+typedef struct
+{
+  uint8_t Char[DISPLAY_DIGITS];  /*!< ASCII character of each digit      */
+  uint8_t Colon;                 /*!< DISPLAY_CELL() bits, colon after   */
+  uint8_t Point;                 /*!< DISPLAY_CELL() bits, point after   */
+} DISPLAY_FrameTypeDef;
+
+/**
+  * @brief  Blinking of the digits
+  */
+typedef enum
+{
+  DISPLAY_BLINK_OFF = 0,
+  DISPLAY_BLINK_SLOW,            /*!< Alarm, about 1 Hz                  */
+  DISPLAY_BLINK_FAST             /*!< Field being set, about 2 Hz        */
+} DISPLAY_BlinkTypeDef;
+
+/**
+  * @brief  Display backend
+  */
+typedef struct
+{
+  void (*Init)(void);
+  /* Draw the dirty cells of a frame, the bar being a cell of its own */
+  void (*Render)(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t DirtyCells);
+  void (*Blink)(DISPLAY_BlinkTypeDef Blink);
+  void (*Contrast)(uint32_t Level);
+  /* Blank the panel, called from the PVD interrupt before STANDBY */
+  void (*Off)(void);
+  /* Light the panel again after Off, with the content it had */
+  void (*On)(void);
+  /* Initialize the panel after STANDBY, on the MSI clock, showing a frame
+     from the first refresh on */
+  void (*Resume)(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t Contrast);
+} DISPLAY_DrvTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void DISPLAY_Init(void);
+void DISPLAY_ShowFrame(const DISPLAY_FrameTypeDef *Frame);
+void DISPLAY_ShowString(const uint8_t *str);
+void DISPLAY_SetBar(uint32_t Bar);
+void DISPLAY_Blink(DISPLAY_BlinkTypeDef Blink);
+void DISPLAY_Contrast(uint32_t Level);
+void DISPLAY_Off(void);
+void DISPLAY_Blank(FunctionalState State);
+void DISPLAY_Save(void);
+void DISPLAY_GetSaved(DISPLAY_FrameTypeDef *Frame);
+void DISPLAY_Resume(const DISPLAY_FrameTypeDef *Frame);
+
+#endif /* __DISPLAY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
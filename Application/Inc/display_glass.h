@@ -0,0 +1,37 @@
+/**
+  ******************************************************************************
+  * @file    display_glass.h
+  * @author  MCD Application Team
+  * @brief   Header for display_glass.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DISPLAY_GLASS_H
+#define __DISPLAY_GLASS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "display.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+extern DISPLAY_DrvTypeDef GlassDisplayDrv;
+
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __DISPLAY_GLASS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
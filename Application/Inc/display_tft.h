@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    display_tft.h
+  * @author  MCD Application Team
+  * @brief   Header for display_tft.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DISPLAY_TFT_H
+#define __DISPLAY_TFT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "display.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Sprites of display_tft_sprites.c, written by Utilities/Sprites/sprites.py:
+   RGB565 with the bytes swapped, column after column */
+#define TFT_SPRITE_HEIGHT               32U
+#define TFT_SPRITE_DIGIT_WIDTH          18U
+#define TFT_SPRITE_SEP_WIDTH            6U
+
+/* Digit sprites: '0' to '9', then these */
+#define TFT_SPRITE_BLANK                10U
+#define TFT_SPRITE_MINUS                11U
+#define TFT_SPRITE_DIGITS               12U
+
+/* Separator sprites: bit 0 for the colon, bit 1 for the point */
+#define TFT_SPRITE_SEP_COLON            1U
+#define TFT_SPRITE_SEP_POINT            2U
+#define TFT_SPRITE_SEPS                 4U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+extern DISPLAY_DrvTypeDef TftDisplayDrv;
+
+extern const uint16_t TftDigitSprites[TFT_SPRITE_DIGITS][TFT_SPRITE_DIGIT_WIDTH * TFT_SPRITE_HEIGHT];
+extern const uint16_t TftSepSprites[TFT_SPRITE_SEPS][TFT_SPRITE_SEP_WIDTH * TFT_SPRITE_HEIGHT];
+
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __DISPLAY_TFT_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    event.h
+  * @author  MCD Application Team
+  * @brief   Header for event.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __EVENT_H
+#define __EVENT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Event identifiers, one handler each
+  */
+typedef enum
+{
+  EVT_RTC_WAKEUP = 0,      /*!< RTC periodic wake-up (1 s)             */
+  EVT_COUNTDOWN_EXPIRED,   /*!< RTC Alarm B, end of the countdown      */
+  EVT_BATTERY_LOW,         /*!< PVD, supply under the warning level    */
+  EVT_BUTTON_EDGE,         /*!< User button pressed, EXTI wake-up      */
+  EVT_BUTTON_TICK,         /*!< RTC fast tick, user button sampling    */
+  EVT_TOUCH_TICK,          /*!< RTC fast tick, touch slider burst      */
+  EVT_LIGHT,               /*!< COMP1, ambient light level changed     */
+  EVT_ID_COUNT
+} EVT_IdTypeDef;
+
+/**
+  * @brief  Event producers. Each interrupt source posting events owns one
+  *         queue, so every queue has a single producer and a single
+  *         consumer (the main loop). Lower values are dispatched first.
+  */
+typedef enum
+{
+  EVT_SRC_RTC = 0,         /*!< RTC_WKUP_IRQHandler                    */
+  EVT_SRC_RTC_ALARM,       /*!< RTC_Alarm_IRQHandler                   */
+  EVT_SRC_PVD,             /*!< PVD_IRQHandler                         */
+  EVT_SRC_BUTTON,          /*!< EXTI0_IRQHandler                       */
+  EVT_SRC_COMP,            /*!< COMP_IRQHandler                        */
+  EVT_SRC_COUNT
+} EVT_SourceTypeDef;
+
+/**
+  * @brief  Fixed-size event record
+  */
+typedef struct
+{
+  EVT_IdTypeDef Id;        /*!< Event identifier                       */
+  uint32_t      Param;     /*!< Event specific parameter               */
+} EVT_TypeDef;
+
+/**
+  * @brief  Event handler, run to completion from the main loop
+  */
+typedef void (*EVT_HandlerTypeDef)(uint32_t Param);
+
+/* Exported constants --------------------------------------------------------*/
+/* Events per queue, must be a power of 2 */
+#define EVT_QUEUE_SIZE     8U
+
+/* Users of EVT_InhibitStop(): their peripherals need the bus clocks, the
+   core only enters SLEEP mode while any of them runs */
+#define EVT_STOP_CHIME     0x01U
+
+/* Priority of the interrupts posting events as soon as they occur. The
+   FreeRTOS build posts to the task queues: no higher than
+   configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#if defined(USE_FREERTOS)
+#define EVT_IRQ_PRIORITY   0x05U
+#else
+#define EVT_IRQ_PRIORITY   0x00U
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     EVT_Init(void);
+void     EVT_Register(EVT_IdTypeDef Id, EVT_HandlerTypeDef Handler);
+HAL_StatusTypeDef EVT_Post(EVT_SourceTypeDef Source, EVT_IdTypeDef Id, uint32_t Param);
+uint32_t EVT_Dispatch(void);
+void     EVT_Run(const EVT_TypeDef *Event);
+void     EVT_Idle(void);
+void     EVT_Sleep(void);
+void     EVT_InhibitStop(uint32_t User, FunctionalState State);
+uint32_t EVT_GetDropped(EVT_SourceTypeDef Source);
+
+#endif /* __EVENT_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    fault.h
+  * @author  MCD Application Team
+  * @brief   Header for fault.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FAULT_H
+#define __FAULT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Fault record, 8 words of the data EEPROM. The header is written
+  *         last: a record torn by a reset has no magic.
+  */
+typedef struct
+{
+  uint32_t Header;         /*!< FAULT_MAGIC, exception number, sequence */
+  uint32_t Pc;             /*!< Stacked PC, the faulting instruction    */
+  uint32_t Lr;             /*!< Stacked LR                              */
+  uint32_t Psr;            /*!< Stacked xPSR                            */
+  uint32_t Cfsr;           /*!< SCB->CFSR                               */
+  uint32_t Hfsr;           /*!< SCB->HFSR                               */
+  uint32_t Address;        /*!< SCB->MMFAR or SCB->BFAR if valid, or 0  */
+  uint32_t Info;           /*!< RCC_CSR reset flags, EXC_RETURN, stage  */
+} FAULT_RecordTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Ring of the last faults, in the data EEPROM after the sync.c words */
+#define FAULT_RING_ADDRESS      (FLASH_EEPROM_BASE + 0x100U)
+#define FAULT_RECORDS           8U
+
+/* Header: magic in the upper byte, exception number (IPSR) in bits 16-23,
+   sequence number, counting the faults, below */
+#define FAULT_MAGIC             0xFAU
+#define FAULT_MAGIC_SHIFT       24U
+#define FAULT_EXCEPTION_SHIFT   16U
+#define FAULT_EXCEPTION         0x00FF0000U
+#define FAULT_SEQUENCE          0x0000FFFFU
+
+/* Info: RCC_CSR reset flags in the upper byte, low byte of EXC_RETURN in
+   bits 16-23, RTC_BKP_WDG_STAGE below */
+#define FAULT_INFO_FLAGS        0xFE000000U
+#define FAULT_INFO_RETURN_SHIFT 16U
+#define FAULT_INFO_STAGE        0x0000FFFFU
+
+/* RTC_BKP_FAULT: set by the capture, cleared once logged after the reset,
+   with the ring slot written in the low byte */
+#define FAULT_PENDING           0x80000000U
+#define FAULT_PENDING_SLOT      0x000000FFU
+
+/* Exported macro ------------------------------------------------------------*/
+/* Fault handlers: no prologue may move the stack pointer before the stacked
+   frame is located */
+#if defined(__ICCARM__)
+#define FAULT_HANDLER           __stackless
+#elif defined(__GNUC__)
+#define FAULT_HANDLER           __attribute__((naked))
+#else
+#define FAULT_HANDLER
+#endif
+
+/* Body of a fault handler: the stack pointer in use when the fault occurred
+   and EXC_RETURN passed to FAULT_Capture(), which does not return */
+#if defined(__ICCARM__) || defined(__GNUC__)
+#define FAULT_ENTRY()           __ASM volatile ("TST   LR, #4        \n" \
+                                                "ITE   EQ            \n" \
+                                                "MRSEQ R0, MSP       \n" \
+                                                "MRSNE R0, PSP       \n" \
+                                                "MOV   R1, LR        \n" \
+                                                "B     FAULT_Capture \n")
+#else
+#define FAULT_ENTRY()           FAULT_Capture(NULL, 0U)
+#endif
+
+/* Exported functions ------------------------------------------------------- */
+void FAULT_Init(void);
+void FAULT_Capture(const uint32_t *Frame, uint32_t ExcReturn);
+
+#endif /* __FAULT_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file    glass_ll.h
+  * @author  MCD Application Team
+  * @brief   Register-level inline access to the glass LCD RAM, for the
+  *          refresh of the 6 digits on the RTC wake-up.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The LCD is still initialized by the HAL and the BSP: only the
+        refresh of the 6 digits goes through these functions, in the build
+        where USE_CLOCK_LL is defined (see main.h and display_glass.c).
+    (#) The 6 digits are built in a GLASS_LL_FrameTypeDef, one word per
+        COM, with the segment mapping of the BSP glass driver. The frame is
+        then written with 4 masked accesses to the LCD RAM and a single
+        update request: the update completes at the next LCD frame, while
+        the part sleeps, instead of being waited for.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __GLASS_LL_H
+#define __GLASS_LL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  LCD RAM image of the 6 digits
+  */
+typedef struct
+{
+  uint32_t Com[COM_PER_DIGIT_NB];  /*!< Segments of COM0 to COM3          */
+} GLASS_LL_FrameTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Character code of the colon after a digit, see the BSP Convert() */
+#define GLASS_LL_COLON          0x0020U
+#define GLASS_LL_POINT          0x0002U
+
+/* Segments of the 6 digits in each COM word, the battery bar included */
+#define GLASS_LL_SEG_MASK       (LCD_SEG0  | LCD_SEG1  | LCD_SEG2  | LCD_SEG3  | \
+                                 LCD_SEG4  | LCD_SEG5  | LCD_SEG6  | LCD_SEG7  | \
+                                 LCD_SEG8  | LCD_SEG9  | LCD_SEG10 | LCD_SEG11 | \
+                                 LCD_SEG12 | LCD_SEG13 | LCD_SEG14 | LCD_SEG15 | \
+                                 LCD_SEG16 | LCD_SEG17 | LCD_SEG18 | LCD_SEG19 | \
+                                 LCD_SEG20 | LCD_SEG21 | LCD_SEG22 | LCD_SEG23)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Defined in stm32l152c_discovery_glass_lcd.c */
+extern const uint16_t NumberMap[10];
+extern uint8_t LCDBar;
+
+/* Exported functions ------------------------------------------------------- */
+
+/**
+  * @brief  Place the 4 bits of a character on one COM of a digit.
+  * @param  Nibble: Character bits of the COM, see the BSP Convert()
+  * @param  Seg0: Shift of the segment of bit 0
+  * @param  Seg1: Shift of the segment of bit 1
+  * @param  Seg2: Shift of the segment of bit 2
+  * @param  Seg3: Shift of the segment of bit 3
+  * @retval Segments to set in the COM word
+  */
+__STATIC_INLINE uint32_t GLASS_LL_Segments(uint32_t Nibble, uint32_t Seg0, uint32_t Seg1,
+                                           uint32_t Seg2, uint32_t Seg3)
+{
+  return ((Nibble & 0x1U) << Seg0) | (((Nibble >> 1U) & 0x1U) << Seg1) |
+         (((Nibble >> 2U) & 0x1U) << Seg2) | (((Nibble >> 3U) & 0x1U) << Seg3);
+}
+
+/**
+  * @brief  Add a character to a frame.
+  * @param  Frame: Frame, cleared before the first character
+  * @param  Position: LCD_DIGIT_POSITION_1 to LCD_DIGIT_POSITION_6
+  * @param  Char: Character code, e.g. NumberMap[] | GLASS_LL_COLON
+  * @retval None
+  */
+__STATIC_INLINE void GLASS_LL_PutChar(GLASS_LL_FrameTypeDef *Frame, uint32_t Position, uint32_t Char)
+{
+  uint32_t com, nibble;
+
+  for (com = 0U; com < COM_PER_DIGIT_NB; com++)
+  {
+    /* COM0 takes the 4 upper bits of the character */
+    nibble = (Char >> (12U - (4U * com))) & 0x0FU;
+
+    switch (Position)
+    {
+    case LCD_DIGIT_POSITION_1:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG0_SHIFT, LCD_SEG1_SHIFT,
+                                           LCD_SEG22_SHIFT, LCD_SEG23_SHIFT);
+      break;
+    case LCD_DIGIT_POSITION_2:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG2_SHIFT, LCD_SEG3_SHIFT,
+                                           LCD_SEG20_SHIFT, LCD_SEG21_SHIFT);
+      break;
+    case LCD_DIGIT_POSITION_3:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG4_SHIFT, LCD_SEG5_SHIFT,
+                                           LCD_SEG18_SHIFT, LCD_SEG19_SHIFT);
+      break;
+    case LCD_DIGIT_POSITION_4:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG6_SHIFT, LCD_SEG7_SHIFT,
+                                           LCD_SEG16_SHIFT, LCD_SEG17_SHIFT);
+      break;
+    case LCD_DIGIT_POSITION_5:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG8_SHIFT, LCD_SEG9_SHIFT,
+                                           LCD_SEG14_SHIFT, LCD_SEG15_SHIFT);
+      break;
+    default:
+      Frame->Com[com] |= GLASS_LL_Segments(nibble, LCD_SEG10_SHIFT, LCD_SEG11_SHIFT,
+                                           LCD_SEG12_SHIFT, LCD_SEG13_SHIFT);
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Set the battery bar of a frame, as BSP_LCD_GLASS_BarLevelConfig().
+  * @note   The bar shares its segments with digits 5 and 6.
+  * @param  Frame: Frame holding the 6 digits
+  * @param  Level: BATTERYLEVEL_xxx
+  * @retval None
+  */
+__STATIC_INLINE void GLASS_LL_PutBar(GLASS_LL_FrameTypeDef *Frame, uint32_t Level)
+{
+  Frame->Com[3] &= ~(LCD_BAR0_SEG | LCD_BAR2_SEG);
+  Frame->Com[2] &= ~(LCD_BAR1_SEG | LCD_BAR3_SEG);
+
+  if (Level >= BATTERYLEVEL_1_4)
+  {
+    Frame->Com[3] |= LCD_BAR0_SEG;
+  }
+  if (Level >= BATTERYLEVEL_1_2)
+  {
+    Frame->Com[2] |= LCD_BAR1_SEG;
+  }
+  if (Level >= BATTERYLEVEL_3_4)
+  {
+    Frame->Com[3] |= LCD_BAR2_SEG;
+  }
+  if (Level >= BATTERYLEVEL_FULL)
+  {
+    Frame->Com[2] |= LCD_BAR3_SEG;
+  }
+}
+
+/**
+  * @brief  Write a frame to the LCD RAM and request the display update.
+  * @note   The update is not waited for. The LCD RAM is write protected
+  *         until the previous update is done, which is then reported
+  *         instead of waited for.
+  * @param  Frame: Frame holding the 6 digits and the bar
+  * @retval Non zero if written, zero if the previous update is pending
+  */
+__STATIC_INLINE uint32_t GLASS_LL_WriteFrame(const GLASS_LL_FrameTypeDef *Frame)
+{
+  if (READ_BIT(LCD->SR, LCD_SR_UDR) != 0U)
+  {
+    return 0U;
+  }
+
+  MODIFY_REG(LCD->RAM[LCD_COM0], GLASS_LL_SEG_MASK, Frame->Com[0]);
+  MODIFY_REG(LCD->RAM[LCD_COM1], GLASS_LL_SEG_MASK, Frame->Com[1]);
+  MODIFY_REG(LCD->RAM[LCD_COM2], GLASS_LL_SEG_MASK, Frame->Com[2]);
+  MODIFY_REG(LCD->RAM[LCD_COM3], GLASS_LL_SEG_MASK, Frame->Com[3]);
+
+  WRITE_REG(LCD->CLR, LCD_CLR_UDDC);
+  SET_BIT(LCD->SR, LCD_SR_UDR);
+  return 1U;
+}
+
+#endif /* __GLASS_LL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
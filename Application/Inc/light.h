@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    light.h
+  * @author  MCD Application Team
+  * @brief   Header for light.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LIGHT_H
+#define __LIGHT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Seconds of continuous darkness before the display is blanked */
+#define LIGHT_DARK_DELAY_S      30U
+
+/* COMP1 non-inverting input: the external channel of sense.c. COMP1 only
+   takes the inputs of the ADC switch matrix, and on the 32L152CDISCOVERY
+   the glass, the touch slider, the button and the chime hold all of them
+   but PA4, the output of the IDD measurement circuit. Free PA4 as told in
+   sense.h before building with USE_LIGHT_SENSOR: otherwise the current
+   amplifier, not the sensor, drives the comparator. The touch slider
+   opens the comparator switches during its acquisitions (touch.c) */
+#if defined(USE_STM32L1XX_NUCLEO)
+#define LIGHT_COMP_INPUT        COMP_NONINVERTINGINPUT_PA1
+#else
+#define LIGHT_COMP_INPUT        COMP_NONINVERTINGINPUT_PA4
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     LIGHT_Init(void);
+void     LIGHT_OnSecond(void);
+uint32_t LIGHT_IsDark(void);
+
+#endif /* __LIGHT_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
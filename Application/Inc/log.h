@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    log.h
+  * @author  MCD Application Team
+  * @brief   Header for log.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LOG_H
+#define __LOG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Logged events
+  */
+typedef enum
+{
+  LOG_RESET = 1,           /*!< Arg: 1 after STANDBY, Value: RCC_CSR    */
+  LOG_TIME_SET,            /*!< Arg: SYNC_TIME if synced, Value: time
+                                before, seconds since 2000               */
+  LOG_BATTERY,             /*!< Arg: DISPLAY_BAR_xxx, Value: VDDA in mV */
+  LOG_SHUTDOWN,            /*!< Brown-out, entering STANDBY             */
+  LOG_SYNC,                /*!< Arg: packet type, SYNC_LOG_REJECTED,
+                                Value: packet counter, or packets
+                                rejected since the last entry            */
+  LOG_DISPLAY,             /*!< Arg: 1 blanked in the dark, 0 lit again,
+                                Value: seconds it stayed blanked         */
+  LOG_DEEP_IDLE,           /*!< Entering STANDBY, display off, Value:
+                                seconds without user input               */
+  LOG_WATCHDOG,            /*!< Watchdog reset, Arg: stage reached,
+                                Value: RTC_BKP_WDG_RESET                 */
+  LOG_FAULT,               /*!< Fault reset, Arg: exception number,
+                                Value: faulting PC                       */
+} LOG_TypeDef;
+
+/**
+  * @brief  Log record, 32 per sector. A torn record fails its CRC.
+  */
+typedef struct
+{
+  uint32_t Time;           /*!< Seconds since 2000-01-01 00:00:00      */
+  uint8_t  Type;           /*!< LOG_TypeDef                            */
+  uint8_t  Seq;            /*!< Record counter, shows lost records     */
+  uint16_t Arg;            /*!< Event specific                         */
+  uint32_t Value;          /*!< Event specific                         */
+  uint32_t Crc;            /*!< CRC unit (CRC-32/MPEG-2) of the 3 words above */
+} LOG_RecordTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define LOG_SECTOR_SIZE         512U
+#define LOG_RECORDS_PER_SECTOR  (LOG_SECTOR_SIZE / sizeof(LOG_RecordTypeDef))
+
+/* Records carried across STANDBY in the backup registers, 4 registers each */
+#define LOG_BKP_RECORDS         4U
+
+/* Log file on the card */
+#define LOG_FILE_NAME           "CLOCK.LOG"
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     LOG_Init(void);
+void     LOG_Write(LOG_TypeDef Type, uint16_t Arg, uint32_t Value);
+HAL_StatusTypeDef LOG_Flush(void);
+void     LOG_Save(void);
+uint32_t LOG_Now(void);
+
+#endif /* __LOG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
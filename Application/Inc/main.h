@@ -1,36 +1,78 @@
-/**
-  ******************************************************************************
-  * @file    LCD/LCD_SegmentsDrive/Inc/main.h 
-  * @author  MCD Application Team
-  * @brief   Header for main.c module
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
-  * All rights reserved.</center></h2>
-  *
-  * This software component is licensed by ST under BSD 3-Clause license,
-  * the "License"; You may not use this file except in compliance with the
-  * License. You may obtain a copy of the License at:
-  *                        opensource.org/licenses/BSD-3-Clause
-  *
-  ******************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __MAIN_H
-#define __MAIN_H
-
-/* Includes ------------------------------------------------------------------*/
-#include "stm32l1xx_hal.h"
-#include "stm32l152c_discovery.h"
-#include "stm32l152c_discovery_glass_lcd.h"
-
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-
-#endif /* __MAIN_H */
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+  ******************************************************************************
+  * @file    LCD/LCD_SegmentsDrive/Inc/main.h 
+  * @author  MCD Application Team
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+/* The board is chosen in the project options: USE_STM32L1XX_NUCLEO for the
+   NUCLEO-L152RE with the Adafruit 1.8" TFT shield, the 32L152CDISCOVERY
+   otherwise */
+#if defined(USE_STM32L1XX_NUCLEO)
+#include "stm32l1xx_nucleo.h"
+#else
+#include "stm32l152c_discovery.h"
+#include "stm32l152c_discovery_glass_lcd.h"
+#endif
+
+/* The FreeRTOS build is chosen in the project options as well: USE_FREERTOS,
+   with the kernel sources listed in rtos.c and Inc/FreeRTOSConfig.h */
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#if defined(USE_STM32L1XX_NUCLEO)
+/* SPI TFT backend of display.c, the touch slider is a Discovery sensor */
+#define USE_DISPLAY_TFT
+#else
+#define USE_TOUCH_SLIDER
+#endif
+
+/* Refresh the clock digits through the register-level paths of clock_ll.h
+   and glass_ll.h instead of the HAL and BSP glass drivers: uncomment, or
+   define it in the project options, for the battery builds.
+   PROF_CLOCK_REFRESH compares both. */
+/* #define USE_CLOCK_LL */
+
+/* Append the event log of log.c to a uSD card: define it on a board with a
+   card slot, in a project linking FatFs and the SD disk I/O driver of
+   Projects/STM32L152D-EVAL/Applications/FatFs/FatFs_uSD. A card supply
+   switch is driven by LOG_SD_POWER_ON() and LOG_SD_POWER_OFF() if they are
+   defined here as well. */
+/* #define USE_LOG_SD */
+
+/* Time the software and, on the STM32L162xx, the AES peripheral check of a
+   sync packet at start-up: results in ProfStats[PROF_SYNC_SW/HW]. */
+/* #define USE_SYNC_BENCHMARK */
+
+/* Blank the display in the dark: define it when a light sensor drives the
+   external channel of sense.c, rising above VREFINT in the light. */
+/* #define USE_LIGHT_SENSOR */
+
+/* Enter STANDBY, display off, after POWER_DEEP_IDLE_S seconds without a
+   button press or touch, counted in the dark only with USE_LIGHT_SENSOR.
+   The button or the countdown alarm resumes with the frame restored. */
+/* #define USE_DEEP_IDLE */
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
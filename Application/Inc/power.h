@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    power.h
+  * @author  MCD Application Team
+  * @brief   Header for power.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __POWER_H
+#define __POWER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Clock state saved by POWER_ClockHSI()
+  */
+typedef struct
+{
+  uint32_t CoreClock;      /*!< SystemCoreClock on entry               */
+  uint32_t Latency;        /*!< Flash latency on entry                 */
+  uint8_t  HsiWasOn;       /*!< HSI already on, e.g. as the PLL input  */
+  uint8_t  Switched;       /*!< Core moved from the MSI to the HSI     */
+  uint16_t Reserved;
+} POWER_ClockTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* PVD levels: battery low warning, then save and shut down */
+#define POWER_PVD_WARNING       PWR_PVDLEVEL_3   /* about 2.5 V */
+#define POWER_PVD_SHUTDOWN      PWR_PVDLEVEL_1   /* about 2.1 V */
+
+/* Supply above which the warning level is armed again, in mV */
+#define POWER_REARM_MV          2650U
+
+/* Period of the STANDBY wake-ups checking whether the supply is back */
+#define POWER_RECHECK_S         10U
+
+/* Seconds without a button press or touch before deep idle, USE_DEEP_IDLE */
+#define POWER_DEEP_IDLE_S       3600U
+
+/* Deep idle wake-up pin, on the user button. The NUCLEO B1 pulls PC13 low:
+   its rising edge, as the button is released, wakes the part up */
+#if defined(USE_STM32L1XX_NUCLEO)
+#define POWER_WAKEUP_PIN        PWR_WAKEUP_PIN2   /* PC13 */
+#else
+#define POWER_WAKEUP_PIN        PWR_WAKEUP_PIN1   /* PA0 */
+#endif
+
+/* Bound of the HSI start-up and of a system clock switch */
+#define POWER_CLOCK_TIMEOUT_MS  1U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     POWER_CheckSupply(void);
+uint32_t POWER_Resume(void);
+void     POWER_Init(void);
+void     POWER_Restore(void);
+void     POWER_SupplyUpdate(uint32_t mv);
+void     POWER_Shutdown(void);
+void     POWER_OnSecond(void);
+void     POWER_Activity(void);
+void     POWER_DeepIdle(void);
+HAL_StatusTypeDef POWER_ClockHSI(POWER_ClockTypeDef *Saved);
+void     POWER_ClockRestore(const POWER_ClockTypeDef *Saved);
+void     PVD_IRQHandler(void);
+
+#endif /* __POWER_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,69 @@
+/**
+  ******************************************************************************
+  * @file    profile.h
+  * @author  MCD Application Team
+  * @brief   Header for profile.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Cycle statistics of one measured code section
+  */
+typedef struct
+{
+  uint32_t Count;   /*!< Number of samples recorded            */
+  uint32_t Last;    /*!< Cycles of the last sample             */
+  uint32_t Max;     /*!< Worst case cycles seen since reset    */
+} PROF_StatTypeDef;
+
+/**
+  * @brief  Measured code sections
+  */
+typedef enum
+{
+  PROF_ISR_RTC_WKUP = 0,   /*!< RTC wake-up interrupt, entry to exit   */
+  PROF_EVT_DISPATCH,       /*!< One event handler, run to completion   */
+  PROF_TOUCH_CHECK,        /*!< Touch slider idle check                */
+  PROF_HAL_WAIT,           /*!< HAL flag wait, in spins, not cycles    */
+  PROF_CLOCK_REFRESH,      /*!< Glass refresh on the RTC wake-up       */
+  PROF_SYNC_SW,            /*!< Sync packet check, software AES        */
+  PROF_SYNC_HW,            /*!< Sync packet check, AES peripheral      */
+  PROF_SENSE,              /*!< Sample set, sensors on to off, in us   */
+  PROF_ID_COUNT
+} PROF_IdTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* DWT cycle counter, running at HCLK while the core is awake */
+#define PROF_CYCLES()      (DWT->CYCCNT)
+
+/* Exported variables --------------------------------------------------------*/
+extern PROF_StatTypeDef ProfStats[PROF_ID_COUNT];
+
+/* Exported functions ------------------------------------------------------- */
+void PROF_Init(void);
+void PROF_Record(PROF_IdTypeDef Id, uint32_t StartCycles);
+void PROF_RecordValue(PROF_IdTypeDef Id, uint32_t Value);
+
+#endif /* __PROFILE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
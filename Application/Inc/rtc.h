@@ -1,54 +1,98 @@
-/**
-  ******************************************************************************
-  * @file    lcd_7seg.h 
-  * @author  MCD Application Team
-  * @brief   Header for main.c module
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __RTC_H
-#define __RTC_H
-
-/* Includes ------------------------------------------------------------------*/
-#include "stm32l1xx_hal.h"
-
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-void RTC_WKUP_IRQHandler(void);
-void RTC_Init(void);
-void RTC_SetTime(uint8_t hour, uint8_t min);
-void RTC_GetTime(uint8_t *hour, uint8_t *min, uint8_t *sec);
-
-#endif /* __RTC_H */
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+  ******************************************************************************
+  * @file    lcd_7seg.h 
+  * @author  MCD Application Team
+  * @brief   Header for main.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RTC_H
+#define __RTC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#define RTC_ASYNCH_PREDIV  0x7F   /* LSE as RTC clock */
+#define RTC_SYNCH_PREDIV   0x00FF /* LSE as RTC clock */   
+
+/* RTC time stamps count sub-seconds: RTC_STAMP_FREQ per second */
+#define RTC_STAMP_FREQ     (RTC_SYNCH_PREDIV + 1U)
+#define RTC_STAMP_PER_DAY  (86400U * RTC_STAMP_FREQ)
+
+/* Wake-up timer reloads at RTCCLK/16 (2048 Hz): 1 s, and the fast tick
+   used while the user button is pressed */
+#define RTC_WAKEUP_PERIOD  0x800U
+#define RTC_FAST_PER_S     32U    /* 31.25 ms */
+
+/* Fast tick users, it runs while any of them needs it */
+#define RTC_FAST_BUTTON    0x01U
+#define RTC_FAST_TOUCH     0x02U
+
+/* Backup registers allocation */
+#define RTC_BKP_INIT       RTC_BKP_DR0   /* RTC_BKP_INIT_MAGIC once the calendar runs */
+#define RTC_BKP_POWER      RTC_BKP_DR1   /* Power loss snapshot header, power.c      */
+#define RTC_BKP_CHRONO     RTC_BKP_DR2   /* 5 registers, chrono.c                    */
+#define RTC_BKP_LOG        RTC_BKP_DR7   /* 1 + 4 x LOG_BKP_RECORDS registers, log.c */
+#define RTC_BKP_DISPLAY    RTC_BKP_DR24  /* 3 registers, frame on the panel, display.c */
+#define RTC_BKP_WDG_STAGE  RTC_BKP_DR27  /* Stage reached, watchdog.c                */
+#define RTC_BKP_WDG_RESET  RTC_BKP_DR28  /* Cause and stage of the last reset        */
+#define RTC_BKP_FAULT      RTC_BKP_DR29  /* Fault captured before the reset, fault.c */
+
+#define RTC_BKP_INIT_MAGIC 0x32F2U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void RTC_WKUP_IRQHandler(void);
+void RTC_Alarm_IRQHandler(void);
+void RTC_Init(void);
+void RTC_SetTime(uint8_t hour, uint8_t min);
+void RTC_SetSeconds(uint32_t Seconds);
+void RTC_GetTime(uint8_t *hour, uint8_t *min, uint8_t *sec);
+uint32_t RTC_GetStamp(void);
+void RTC_SetAlarmB(uint32_t stamp);
+void RTC_CancelAlarmB(void);
+void RTC_SetWakeUpFast(uint32_t user, uint8_t fast);
+uint32_t RTC_WakeUpFast(void);
+void RTC_SetWakeUp(uint32_t Counts);
+void RTC_SetWakeUpSeconds(uint32_t Seconds);
+void RTC_BackupWrite(uint32_t reg, uint32_t data);
+uint32_t RTC_BackupRead(uint32_t reg);
+
+/* Implemented in stm32l1xx_hal_timebase_rtc.c */
+void RTC_TickStart(void);
+void RTC_TickHold(void);
+void RTC_TickRebase(void);
+
+#endif /* __RTC_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
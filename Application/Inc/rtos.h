@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file    rtos.h
+  * @author  MCD Application Team
+  * @brief   Header for rtos.c and rtos_tick.c modules
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RTOS_H
+#define __RTOS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "event.h"
+#include "rtc.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Tasks of the FreeRTOS build, highest priority first
+  */
+typedef enum
+{
+  RTOS_TASK_INPUT = 0,     /*!< User button and touch slider events    */
+  RTOS_TASK_DISPLAY,       /*!< 1 s wake-up, countdown, supply, light  */
+  RTOS_TASK_SYNC,          /*!< Sync packets, SYNC_Receive()           */
+  RTOS_TASK_COUNT
+} RTOS_TaskTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Kernel tick: the RTC fast tick */
+#define RTOS_TICK_HZ            RTC_FAST_PER_S
+
+/* RTC time stamps and wake-up timer counts (RTCCLK/16) per tick */
+#define RTOS_STAMPS_PER_TICK    (RTC_STAMP_FREQ / RTOS_TICK_HZ)
+#define RTOS_COUNTS_PER_TICK    (RTC_WAKEUP_PERIOD / RTOS_TICK_HZ)
+#define RTOS_COUNTS_PER_STAMP   (RTC_WAKEUP_PERIOD / RTC_STAMP_FREQ)
+
+/* Longer steps of the RTC stamps are calendar changes, not elapsed time */
+#define RTOS_TICKS_MAX_STEP     (4U * RTOS_TICK_HZ)
+#define RTOS_TICKS_JUMP         0xFFFFFFFFU
+
+/* Events waiting per task, sync packets waiting */
+#define RTOS_QUEUE_SIZE         EVT_QUEUE_SIZE
+#define RTOS_SYNC_QUEUE_SIZE    2U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              RTOS_Start(void);
+uint32_t          RTOS_IsRunning(void);
+HAL_StatusTypeDef RTOS_Post(const EVT_TypeDef *Event);
+HAL_StatusTypeDef RTOS_Sync(const uint8_t *Packet, uint32_t Size);
+uint32_t          RTOS_TicksElapsed(uint32_t From, uint32_t To);
+
+/* Implemented in rtos_tick.c */
+void              RTOS_TickHandler(void);
+
+#endif /* __RTOS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
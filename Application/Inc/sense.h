@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    sense.h
+  * @author  MCD Application Team
+  * @brief   Header for sense.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SENSE_H
+#define __SENSE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  One sample set, calibrated
+  */
+typedef struct
+{
+  uint32_t Stamp;          /*!< RTC_GetStamp() when sampled            */
+  uint16_t Vdda;           /*!< Analog supply, in mV                   */
+  int16_t  Temperature;    /*!< Die temperature, in 0.1 degree C       */
+  uint16_t External;       /*!< External channel, in mV                */
+  uint16_t Reserved;
+} SENSE_SnapshotTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Seconds between two sample sets, counted on the RTC wake-up */
+#define SENSE_PERIOD_S          10U
+
+/* External channel: PA1, A1 on the Arduino header of the NUCLEO, whose PA4
+   is the chime output.
+   PA4 on the 32L152CDISCOVERY: every other ADC input is taken by the glass
+   (PA1-3, PB12-15, PC0-3), the touch slider (PA6-7, PB0-1, PC4-5), the user
+   button (PA0) or the chime (PA5). PA4 is the output of the IDD measurement
+   circuit, which must be freed before wiring the sensor: close JP1 on ON so
+   the supply bypasses the shunt, and disconnect the current amplifier from
+   PA4 as described in the IDD section of the board user manual (UM1079).
+   COMP1 of light.c watches the same pin */
+#if defined(USE_STM32L1XX_NUCLEO)
+#define SENSE_EXT_CHANNEL       ADC_CHANNEL_1
+#define SENSE_EXT_PIN           GPIO_PIN_1
+#else
+#define SENSE_EXT_CHANNEL       ADC_CHANNEL_4
+#define SENSE_EXT_PIN           GPIO_PIN_4
+#endif
+#define SENSE_EXT_GPIO_PORT     GPIOA
+#define SENSE_EXT_GPIO_CLK_ENABLE() __HAL_RCC_GPIOA_CLK_ENABLE()
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     SENSE_Init(void);
+void     SENSE_OnSecond(void);
+void     SENSE_Sample(void);
+uint32_t SENSE_Read(SENSE_SnapshotTypeDef *Snapshot);
+
+#endif /* __SENSE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
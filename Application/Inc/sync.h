@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    sync.h
+  * @author  MCD Application Team
+  * @brief   Header for sync.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SYNC_H
+#define __SYNC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Packet types
+  */
+typedef enum
+{
+  SYNC_TIME = 1,           /*!< SYNC_TimeTypeDef                       */
+  SYNC_SETTINGS,           /*!< SYNC_SettingsTypeDef                   */
+} SYNC_TypeDef;
+
+/**
+  * @brief  Packet header, in clear and authenticated. The payload follows,
+  *         encrypted, then the tag. Little endian.
+  */
+typedef struct
+{
+  uint8_t  Version;        /*!< SYNC_VERSION                           */
+  uint8_t  Type;           /*!< SYNC_TypeDef                           */
+  uint8_t  Length;         /*!< Payload bytes, up to SYNC_PAYLOAD_MAX  */
+  uint8_t  Reserved;
+  uint32_t Counter;        /*!< Must grow from packet to packet        */
+} SYNC_HeaderTypeDef;
+
+/**
+  * @brief  SYNC_TIME payload
+  */
+typedef struct
+{
+  uint32_t Seconds;        /*!< Seconds since 2000-01-01 00:00:00      */
+} SYNC_TimeTypeDef;
+
+/**
+  * @brief  SYNC_SETTINGS payload
+  */
+typedef struct
+{
+  uint8_t  Contrast;       /*!< Up to DISPLAY_CONTRAST_MAX, or SYNC_KEEP */
+  uint8_t  Reserved[3];
+  uint32_t Countdown;      /*!< Countdown preset in seconds, 0 to keep */
+} SYNC_SettingsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define SYNC_VERSION            1U
+#define SYNC_BLOCK_SIZE         16U
+#define SYNC_PAYLOAD_MAX        SYNC_BLOCK_SIZE
+#define SYNC_TAG_SIZE           SYNC_BLOCK_SIZE
+#define SYNC_PACKET_MAX         (sizeof(SYNC_HeaderTypeDef) + SYNC_PAYLOAD_MAX + SYNC_TAG_SIZE)
+
+/* Setting left unchanged */
+#define SYNC_KEEP               0xFFU
+
+/* Provisioned in the data EEPROM: the 128-bit device key, all zero until
+   provisioned (sync disabled), then the last accepted counter */
+#define SYNC_KEY_ADDRESS        FLASH_EEPROM_BASE
+#define SYNC_COUNTER_ADDRESS    (FLASH_EEPROM_BASE + 16U)
+
+/* LOG_SYNC Arg bit of rejected packets, with the type of the last one in the
+   low byte: the Value is then the number rejected since the previous entry */
+#define SYNC_LOG_REJECTED       0x8000U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              SYNC_Init(void);
+HAL_StatusTypeDef SYNC_Receive(const uint8_t *Packet, uint32_t Size);
+uint32_t          SYNC_GetRejected(void);
+void              SYNC_Benchmark(void);
+
+#endif /* __SYNC_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
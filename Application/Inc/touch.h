@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    touch.h
+  * @author  MCD Application Team
+  * @brief   Header for touch.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TOUCH_H
+#define __TOUCH_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "event.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Slider positions passed to the handler, 0 at the left end */
+#define TOUCH_POSITION_MAX      255U
+#define TOUCH_RELEASED          0xFFFFFFFFU
+
+/* Touch thresholds, as a fraction of the untouched count: count >> shift */
+#define TOUCH_DETECT_SHIFT      4U    /* 1/16, burst acquisition          */
+#define TOUCH_COARSE_SHIFT      5U    /* 1/32, once a second check        */
+
+/* Burst end: fast ticks without a touch */
+#define TOUCH_RELEASE_TICKS     4U
+
+/* Idle checks cycles per second: 1 uA average is about 4300 cycles per
+   second at 230 uA/MHz in Run mode, calibrations take the rest */
+#define TOUCH_BUDGET_CYCLES     3500U
+
+/* Period of the untouched counts calibration */
+#define TOUCH_CALIBRATION_S     600U
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void TOUCH_Init(EVT_HandlerTypeDef Handler);
+void TOUCH_OnSecond(void);
+
+#endif /* __TOUCH_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
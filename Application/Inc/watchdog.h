@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    watchdog.h
+  * @author  MCD Application Team
+  * @brief   Header for watchdog.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __WATCHDOG_H
+#define __WATCHDOG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+#include "rtc.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Stages of the application, kept in RTC_BKP_WDG_STAGE
+  */
+typedef enum
+{
+  WDG_STAGE_BOOT = 1,      /*!< Initialization, before the main loop   */
+  WDG_STAGE_IDLE,          /*!< STOP or SLEEP mode                     */
+  WDG_STAGE_EVENT,         /*!< Event handler, detail: event id        */
+  WDG_STAGE_WAKEUP,        /*!< Periodic services of the 1 s wake-up   */
+  WDG_STAGE_SENSE,         /*!< ADC scan                               */
+  WDG_STAGE_DISPLAY,       /*!< Panel update                           */
+  WDG_STAGE_LOG,           /*!< Log sector write                       */
+} WDG_StageTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Longest planned sleep, the 1 s RTC wake-up, and longest run between two
+   wake-ups: the IWDG timeout is twice their sum */
+#define WDG_SLEEP_MAX_MS        1000U
+#define WDG_RUN_MAX_MS          1000U
+
+/* Fastest LSI of the datasheet: the IWDG timeout is never shorter */
+#define WDG_LSI_MAX_HZ          56000U
+
+/* Budget of the WWDG window, from the RTC wake-up interrupt to the next
+   STOP mode. Clipped to the 64 WWDG periods: 1 s on the 2.1 MHz MSI, the
+   clock of WDG_Arm(). The WWDG counts 8 times faster while the core runs
+   on the HSI (POWER_ClockHSI()): the longest run, a full TFT repaint on
+   the NUCLEO, takes about 10 ms on it, some 75 ms of the budget */
+#define WDG_WWDG_BUDGET_MS      1000U
+
+/* RTC_BKP_WDG_STAGE: stage in the low byte, detail above */
+#define WDG_STAGE_DETAIL_SHIFT  8U
+
+/* RTC_BKP_WDG_RESET: RCC_CSR reset flags in the upper byte, watchdog
+   resets count in bits 8-15, stage reached before the reset below */
+#define WDG_RESET_FLAGS         0xFE000000U
+#define WDG_RESET_COUNT_SHIFT   8U
+#define WDG_RESET_COUNT         0x0000FF00U
+#define WDG_RESET_STAGE         0x000000FFU
+
+/* Exported macro ------------------------------------------------------------*/
+/* Record the stage reached: a single backup register write */
+#define WDG_STAGE(__STAGE__)    RTC_BackupWrite(RTC_BKP_WDG_STAGE, (uint32_t)(__STAGE__))
+
+/* Exported functions ------------------------------------------------------- */
+void     WDG_Init(void);
+void     WDG_Start(void);
+void     WDG_OnSecond(void);
+void     WDG_Arm(void);
+void     WDG_Idle(void);
+uint32_t WDG_IsRunning(void);
+
+#endif /* __WATCHDOG_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
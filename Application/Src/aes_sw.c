@@ -0,0 +1,225 @@
+/**
+  ******************************************************************************
+  * @file    aes_sw.c
+  * @author  MCD Application Team
+  * @brief   AES-128 block encryption in software, for the parts without the
+  *          AES peripheral (all but the STM32L162xx) and for host builds.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) AESSW_SetKey() expands the key once, AESSW_Encrypt() then ciphers
+        one 16-byte block. Only the forward cipher is provided: CTR and
+        CMAC, the modes of sync.c, never decrypt a block.
+    (#) Byte oriented, without T-tables: 256 bytes of S-box in flash and
+        no data dependent branch.
+    (#) The module only depends on stdint.h, so that it also builds on the
+        host.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "aes_sw.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Multiplication by x in GF(2^8), without branch */
+#define AESSW_XTIME(b)          ((uint8_t)(((b) << 1) ^ ((((b) >> 7) & 1U) * 0x1BU)))
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t AesSbox[256] =
+{
+  0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+  0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+  0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+  0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+  0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+  0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+  0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+  0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+  0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+  0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+  0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+  0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+  0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+  0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+  0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+  0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+static const uint8_t AesRcon[AESSW_ROUNDS] =
+{
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void AESSW_AddRoundKey(uint8_t *State, const uint8_t *RoundKey);
+static void AESSW_SubShift(uint8_t *State);
+static void AESSW_MixColumns(uint8_t *State);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  XOR a round key into the state.
+  * @param  State: 16 bytes, column after column
+  * @param  RoundKey: 16 bytes
+  * @retval None
+  */
+static void AESSW_AddRoundKey(uint8_t *State, const uint8_t *RoundKey)
+{
+  uint32_t i;
+
+  for (i = 0U; i < AESSW_BLOCK_SIZE; i++)
+  {
+    State[i] ^= RoundKey[i];
+  }
+}
+
+/**
+  * @brief  SubBytes and ShiftRows in one pass.
+  * @param  State: 16 bytes, column after column
+  * @retval None
+  */
+static void AESSW_SubShift(uint8_t *State)
+{
+  uint8_t t;
+
+  /* Row 0 is not shifted */
+  State[0]  = AesSbox[State[0]];
+  State[4]  = AesSbox[State[4]];
+  State[8]  = AesSbox[State[8]];
+  State[12] = AesSbox[State[12]];
+
+  /* Row 1 by one column */
+  t         = State[1];
+  State[1]  = AesSbox[State[5]];
+  State[5]  = AesSbox[State[9]];
+  State[9]  = AesSbox[State[13]];
+  State[13] = AesSbox[t];
+
+  /* Row 2 by two columns */
+  t         = State[2];
+  State[2]  = AesSbox[State[10]];
+  State[10] = AesSbox[t];
+  t         = State[6];
+  State[6]  = AesSbox[State[14]];
+  State[14] = AesSbox[t];
+
+  /* Row 3 by three columns */
+  t         = State[15];
+  State[15] = AesSbox[State[11]];
+  State[11] = AesSbox[State[7]];
+  State[7]  = AesSbox[State[3]];
+  State[3]  = AesSbox[t];
+}
+
+/**
+  * @brief  MixColumns.
+  * @param  State: 16 bytes, column after column
+  * @retval None
+  */
+static void AESSW_MixColumns(uint8_t *State)
+{
+  uint8_t a0, a1, a2, a3, all;
+  uint32_t c;
+
+  for (c = 0U; c < AESSW_BLOCK_SIZE; c += 4U)
+  {
+    a0 = State[c];
+    a1 = State[c + 1U];
+    a2 = State[c + 2U];
+    a3 = State[c + 3U];
+    all = a0 ^ a1 ^ a2 ^ a3;
+
+    State[c]      = a0 ^ all ^ AESSW_XTIME(a0 ^ a1);
+    State[c + 1U] = a1 ^ all ^ AESSW_XTIME(a1 ^ a2);
+    State[c + 2U] = a2 ^ all ^ AESSW_XTIME(a2 ^ a3);
+    State[c + 3U] = a3 ^ all ^ AESSW_XTIME(a3 ^ a0);
+  }
+}
+
+/**
+  * @brief  Expand an AES-128 key.
+  * @param  Ctx: Expanded key
+  * @param  Key: AESSW_KEY_SIZE bytes
+  * @retval None
+  */
+void AESSW_SetKey(AESSW_ContextTypeDef *Ctx, const uint8_t *Key)
+{
+  uint8_t *w = Ctx->RoundKey;
+  uint32_t i;
+
+  for (i = 0U; i < AESSW_KEY_SIZE; i++)
+  {
+    w[i] = Key[i];
+  }
+
+  for (i = AESSW_KEY_SIZE; i < sizeof(Ctx->RoundKey); i += 4U)
+  {
+    if ((i % AESSW_KEY_SIZE) == 0U)
+    {
+      /* RotWord, SubWord and the round constant */
+      w[i]      = w[i - 16U] ^ AesSbox[w[i - 3U]] ^ AesRcon[(i / AESSW_KEY_SIZE) - 1U];
+      w[i + 1U] = w[i - 15U] ^ AesSbox[w[i - 2U]];
+      w[i + 2U] = w[i - 14U] ^ AesSbox[w[i - 1U]];
+      w[i + 3U] = w[i - 13U] ^ AesSbox[w[i - 4U]];
+    }
+    else
+    {
+      w[i]      = w[i - 16U] ^ w[i - 4U];
+      w[i + 1U] = w[i - 15U] ^ w[i - 3U];
+      w[i + 2U] = w[i - 14U] ^ w[i - 2U];
+      w[i + 3U] = w[i - 13U] ^ w[i - 1U];
+    }
+  }
+}
+
+/**
+  * @brief  Encrypt one block.
+  * @param  Ctx: Expanded key
+  * @param  In: AESSW_BLOCK_SIZE bytes
+  * @param  Out: AESSW_BLOCK_SIZE bytes, may be In
+  * @retval None
+  */
+void AESSW_Encrypt(const AESSW_ContextTypeDef *Ctx, const uint8_t *In, uint8_t *Out)
+{
+  uint8_t state[AESSW_BLOCK_SIZE];
+  uint32_t round, i;
+
+  for (i = 0U; i < AESSW_BLOCK_SIZE; i++)
+  {
+    state[i] = In[i] ^ Ctx->RoundKey[i];
+  }
+
+  for (round = 1U; round < AESSW_ROUNDS; round++)
+  {
+    AESSW_SubShift(state);
+    AESSW_MixColumns(state);
+    AESSW_AddRoundKey(state, &Ctx->RoundKey[round * AESSW_BLOCK_SIZE]);
+  }
+  AESSW_SubShift(state);
+  AESSW_AddRoundKey(state, &Ctx->RoundKey[AESSW_ROUNDS * AESSW_BLOCK_SIZE]);
+
+  for (i = 0U; i < AESSW_BLOCK_SIZE; i++)
+  {
+    Out[i] = state[i];
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * @file    battery.c
+  * @author  MCD Application Team
+  * @brief   Supply monitor: VDDA measured through VREFINT, shown on the
+  *          battery bar, low supply flagged by the PVD.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) BATT_OnSecond() is called on every RTC wake-up and measures once
+        every BATT_PERIOD_S seconds, so sampling never adds a wake-up.
+    (#) A measurement takes a sample set of the sensing pipeline (sense.c),
+        which measures VDDA through VREFINT in integer math. The supply is
+        filtered across measurements.
+    (#) The PVD (see power.c) flags a supply falling under the warning
+        level between two measurements and posts EVT_BATTERY_LOW.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "battery.h"
+#include "display.h"
+#include "event.h"
+#include "power.h"
+#include "log.h"
+#include "sense.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Fractional bits of the filtered supply value */
+#define BATT_FILTER_SHIFT       4U
+
+/* BattBar before the first measurement */
+#define BATT_BAR_NONE           0xFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint32_t BattSeconds;      /* Seconds since the last measurement     */
+static uint32_t BattVdd;          /* Filtered VDDA, mV << BATT_FILTER_SHIFT */
+static uint32_t BattBar;          /* Level last shown and logged            */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t BATT_Level(uint32_t mv);
+static void    BATT_OnLow(uint32_t Param);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Map a supply voltage to a battery bar level.
+  * @param  mv: Supply, in mV
+  * @retval DISPLAY_BAR_xxx value
+  */
+static uint8_t BATT_Level(uint32_t mv)
+{
+  if (mv >= BATT_FULL_MV)
+  {
+    return DISPLAY_BAR_FULL;
+  }
+  if (mv >= BATT_3_4_MV)
+  {
+    return DISPLAY_BAR_3_4;
+  }
+  if (mv >= BATT_1_2_MV)
+  {
+    return DISPLAY_BAR_1_2;
+  }
+  if (mv >= BATT_1_4_MV)
+  {
+    return DISPLAY_BAR_1_4;
+  }
+  return DISPLAY_BAR_OFF;
+}
+
+/**
+  * @brief  Low supply, handler of EVT_BATTERY_LOW.
+  * @note   Measure right away rather than waiting for the next period, and
+  *         write the log to the card while the supply still allows it.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void BATT_OnLow(uint32_t Param)
+{
+  BATT_Measure();
+  LOG_Flush();
+}
+
+/**
+  * @brief  Take a first measurement.
+  * @note   The sensing pipeline must be initialized first (SENSE_Init()).
+  * @param  None
+  * @retval None
+  */
+void BATT_Init(void)
+{
+  EVT_Register(EVT_BATTERY_LOW, BATT_OnLow);
+
+  BattSeconds = 0U;
+  BattVdd = 0U;
+  BattBar = BATT_BAR_NONE;
+  BATT_Measure();
+}
+
+/**
+  * @brief  Count the RTC wake-ups and measure once a period.
+  * @param  None
+  * @retval None
+  */
+void BATT_OnSecond(void)
+{
+  if (++BattSeconds >= BATT_PERIOD_S)
+  {
+    BATT_Measure();
+  }
+}
+
+/**
+  * @brief  Measure VDDA and update the battery bar.
+  * @param  None
+  * @retval None
+  */
+void BATT_Measure(void)
+{
+  SENSE_SnapshotTypeDef snapshot;
+  uint32_t i, mv;
+
+  BattSeconds = 0U;
+
+  SENSE_Sample();
+  if (SENSE_Read(&snapshot) == 0U)
+  {
+    return;
+  }
+  mv = snapshot.Vdda;
+
+  /* First order filter: new = old + (sample - old) / 4 */
+  if (BattVdd == 0U)
+  {
+    BattVdd = mv << BATT_FILTER_SHIFT;
+  }
+  else
+  {
+    BattVdd = BattVdd - (BattVdd >> 2U) + ((mv << BATT_FILTER_SHIFT) >> 2U);
+  }
+
+  POWER_SupplyUpdate(BATT_GetVdd());
+
+  /* The display layer only redraws the bar when the level changes */
+  i = BATT_Level(BATT_GetVdd());
+  if (__HAL_PWR_GET_FLAG(PWR_FLAG_PVDO) != RESET)
+  {
+    i = DISPLAY_BAR_OFF;
+  }
+  DISPLAY_SetBar(i);
+
+  if (i != BattBar)
+  {
+    BattBar = i;
+    LOG_Write(LOG_BATTERY, (uint16_t)i, BATT_GetVdd());
+  }
+}
+
+/**
+  * @brief  Filtered supply voltage.
+  * @param  None
+  * @retval VDDA, in mV
+  */
+uint32_t BATT_GetVdd(void)
+{
+  return BattVdd >> BATT_FILTER_SHIFT;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
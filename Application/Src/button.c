@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * @file    button.c
+  * @author  MCD Application Team
+  * @brief   User button: EXTI wake-up, debouncing and auto-repeat timed by
+  *          the RTC wake-up timer.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The press edge wakes the part up from STOP through EXTI0, EXTI13
+        on the NUCLEO-L152RE. The
+        interrupt masks the line, so that bounces cannot wake it up again,
+        and posts EVT_BUTTON_EDGE.
+    (#) The RTC wake-up timer then runs the fast tick (RTC_FAST_PER_S per
+        second). Each tick samples the pin once: a level is accepted after
+        BTN_DEBOUNCE_TICKS equal samples. The part goes back to STOP between
+        two ticks, so the button is never polled in a loop.
+    (#) The action handler receives BTN_SHORT on release, BTN_LONG after
+        BTN_LONG_TICKS, then BTN_REPEAT every BTN_REPEAT_TICKS while held.
+    (#) Once the button is released, the wake-up timer is back to 1 s and
+        the EXTI line is unmasked.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "button.h"
+#include "rtc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Pin level of a pressed button: the NUCLEO B1 pulls PC13 low */
+#if defined(USE_STM32L1XX_NUCLEO)
+#define BTN_PRESSED_STATE       0U
+#define BTN_IRQHandler          EXTI15_10_IRQHandler
+#else
+#define BTN_PRESSED_STATE       1U
+#define BTN_IRQHandler          EXTI0_IRQHandler
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static EVT_HandlerTypeDef BtnHandler;
+
+static uint8_t  BtnSample;      /* Last sampled level                      */
+static uint8_t  BtnSamples;     /* Consecutive samples at that level       */
+static uint8_t  BtnPressed;     /* Debounced level                         */
+static uint32_t BtnHeld;        /* Ticks since the debounced press         */
+
+/* Private function prototypes -----------------------------------------------*/
+static void BTN_OnEdge(uint32_t Param);
+static void BTN_OnTick(uint32_t Param);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Press edge, handler of EVT_BUTTON_EDGE: start sampling.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void BTN_OnEdge(uint32_t Param)
+{
+  BtnSample = 1U;
+  BtnSamples = 1U;
+  RTC_SetWakeUpFast(RTC_FAST_BUTTON, 1U);
+}
+
+/**
+  * @brief  Sample the button, handler of EVT_BUTTON_TICK.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void BTN_OnTick(uint32_t Param)
+{
+  uint8_t level;
+
+  /* A tick queued before the switch back to the 1 s period */
+  if ((RTC_WakeUpFast() & RTC_FAST_BUTTON) == 0U)
+  {
+    return;
+  }
+
+  level = (BSP_PB_GetState(BUTTON_USER) == BTN_PRESSED_STATE) ? 1U : 0U;
+  if (level != BtnSample)
+  {
+    BtnSample = level;
+    BtnSamples = 1U;
+    return;
+  }
+  if (BtnSamples < BTN_DEBOUNCE_TICKS)
+  {
+    if (++BtnSamples < BTN_DEBOUNCE_TICKS)
+    {
+      return;
+    }
+  }
+
+  if (level != BtnPressed)
+  {
+    BtnPressed = level;
+    if ((BtnPressed == 0U) && (BtnHeld < BTN_LONG_TICKS))
+    {
+      BtnHandler(BTN_SHORT);
+    }
+    BtnHeld = 0U;
+  }
+
+  if (BtnPressed != 0U)
+  {
+    BtnHeld++;
+    if (BtnHeld == BTN_LONG_TICKS)
+    {
+      BtnHandler(BTN_LONG);
+    }
+    else if ((BtnHeld > BTN_LONG_TICKS) &&
+             (((BtnHeld - BTN_LONG_TICKS) % BTN_REPEAT_TICKS) == 0U))
+    {
+      BtnHandler(BTN_REPEAT);
+    }
+  }
+  else
+  {
+    /* Released, or only a glitch: wait for the next edge in STOP mode */
+    RTC_SetWakeUpFast(RTC_FAST_BUTTON, 0U);
+    __HAL_GPIO_EXTI_CLEAR_IT(USER_BUTTON_PIN);
+    SET_BIT(EXTI->IMR, USER_BUTTON_PIN);
+  }
+}
+
+/**
+  * @brief  Configure the user button as an EXTI wake-up source.
+  * @param  Handler: Called from the main loop with a BTN_ActionTypeDef
+  * @retval None
+  */
+void BTN_Init(EVT_HandlerTypeDef Handler)
+{
+  BtnHandler = Handler;
+  BtnPressed = 0U;
+  BtnHeld = 0U;
+
+  EVT_Register(EVT_BUTTON_EDGE, BTN_OnEdge);
+  EVT_Register(EVT_BUTTON_TICK, BTN_OnTick);
+
+  /* Press edge on PA0 (PC13 on the NUCLEO), lowest priority */
+  BSP_PB_Init(BUTTON_USER, BUTTON_MODE_EXTI);
+}
+
+/**
+  * @brief  EXTI line detection callback, called from BTN_IRQHandler().
+  * @param  GPIO_Pin: Pin of the EXTI line
+  * @retval None
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == USER_BUTTON_PIN)
+  {
+    /* Bounces must not wake the part up: the RTC tick samples from now on */
+    CLEAR_BIT(EXTI->IMR, USER_BUTTON_PIN);
+    EVT_Post(EVT_SRC_BUTTON, EVT_BUTTON_EDGE, 0U);
+  }
+}
+
+/**
+  * @brief  This function handles the EXTI interrupt request of the button.
+  * @param  None
+  * @retval None
+  */
+void BTN_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(USER_BUTTON_PIN);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,665 @@
+/**
+  ******************************************************************************
+  * @file    chime.c
+  * @author  MCD Application Team
+  * @brief   Chime and alarm sounds, synthesised into a DMA ping-pong buffer
+  *          played by the DAC.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) A chime is a sequence of steps: a sine note with a bell decay, a
+        square beep, a rest, or a short IMA ADPCM sample kept in flash.
+        Nothing is read from a file system.
+    (#) TIM6 triggers the DAC at CHIME_SAMPLE_RATE, and the DMA feeds it
+        in circular mode from a buffer of CHIME_BUFFER_SAMPLES. The half
+        and complete transfer interrupts synthesise the half just played:
+        16 ms of sound per interrupt, a few percent of the CPU at the MSI
+        clock the core runs on after STOP mode.
+    (#) While a chime plays, EVT_Idle() enters SLEEP mode instead of STOP:
+        TIM6, the DAC and the DMA need their clocks. The chime stops by
+        itself once the last half with sound has been played, then the
+        peripheral clocks are gated and STOP mode is allowed again.
+    (#) Output on PA4 (DAC_OUT1, A2 of the Arduino connector) on the
+        NUCLEO-L152RE, PA5 is the TFT SPI clock. Output on PA5 (DAC_OUT2)
+        on the 32L152CDISCOVERY, PA4 is its IDD measurement.
+    (#) Utilities/HostTest/chime_test.c plays every chime on the host and
+        writes the samples the DAC would output as WAV files.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "chime.h"
+#include "event.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Step waveforms
+  */
+typedef enum
+{
+  CHIME_WAVE_END = 0,      /*!< End of the sequence                    */
+  CHIME_WAVE_SINE,         /*!< Arg: Hz, decaying like a bell          */
+  CHIME_WAVE_SQUARE,       /*!< Arg: Hz, constant level                */
+  CHIME_WAVE_REST,         /*!< Silence                                */
+  CHIME_WAVE_SAMPLE,       /*!< Arg: CHIME_SAMPLE_xxx, Ms not used     */
+} CHIME_WaveTypeDef;
+
+/**
+  * @brief  Sequence step
+  */
+typedef struct
+{
+  uint16_t Wave;           /*!< CHIME_WaveTypeDef                      */
+  uint16_t Arg;            /*!< Depends on the waveform                */
+  uint16_t Ms;             /*!< Duration                               */
+} CHIME_StepTypeDef;
+
+/**
+  * @brief  Chime, a sequence played Repeat times
+  */
+typedef struct
+{
+  const CHIME_StepTypeDef *Steps;
+  uint32_t                 Repeat;
+} CHIME_SequenceTypeDef;
+
+/**
+  * @brief  IMA ADPCM sample, 4 bits per sample, low nibble first
+  */
+typedef struct
+{
+  const uint8_t *Data;
+  uint32_t       Samples;
+} CHIME_SampleTypeDef;
+
+/**
+  * @brief  Synthesiser state, owned by the DMA interrupt while playing
+  */
+typedef struct
+{
+  const CHIME_SequenceTypeDef *Sequence;
+  const CHIME_StepTypeDef     *Step;
+  uint32_t       Repeat;   /*!< Passes left, current one included      */
+  uint32_t       Left;     /*!< Samples left in the step               */
+  uint32_t       Phase;    /*!< Tones: one period over 2^32            */
+  uint32_t       PhaseInc;
+  int32_t        Level;    /*!< Sine: amplitude, Q23                   */
+  const uint8_t *Adpcm;    /*!< Sample: data                           */
+  uint32_t       Nibble;   /*!< Sample: next code                      */
+  int32_t        Predictor;
+  int32_t        Index;
+} CHIME_SynthTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#if defined(USE_STM32L1XX_NUCLEO)
+#define CHIME_DAC_CHANNEL               DAC_CHANNEL_1
+#define CHIME_DAC_PIN                   GPIO_PIN_4
+#define CHIME_DAC_DMA_HANDLE            DMA_Handle1
+#define CHIME_DMA_CHANNEL               DMA1_Channel2
+#define CHIME_DMA_IRQn                  DMA1_Channel2_IRQn
+#define CHIME_DMA_IRQHandler            DMA1_Channel2_IRQHandler
+#else
+#define CHIME_DAC_CHANNEL               DAC_CHANNEL_2
+#define CHIME_DAC_PIN                   GPIO_PIN_5
+#define CHIME_DAC_DMA_HANDLE            DMA_Handle2
+#define CHIME_DMA_CHANNEL               DMA1_Channel3
+#define CHIME_DMA_IRQn                  DMA1_Channel3_IRQn
+#define CHIME_DMA_IRQHandler            DMA1_Channel3_IRQHandler
+#endif
+#define CHIME_DAC_GPIO_PORT             GPIOA
+
+/* Samples per half of the buffer */
+#define CHIME_HALF_SAMPLES              (CHIME_BUFFER_SAMPLES / 2U)
+
+/* DAC code of the silence, 12-bit right aligned */
+#define CHIME_DAC_MID                   2048
+
+/* Phase increment of 1 Hz */
+#define CHIME_PHASE_PER_HZ              ((uint32_t)(0x100000000ULL / CHIME_SAMPLE_RATE))
+
+/* Levels, Q15 of the DAC half range */
+#define CHIME_SINE_LEVEL                0x6000
+#define CHIME_SQUARE_LEVEL              0x3000
+#define CHIME_SAMPLE_SHIFT              4U      /* 16-bit samples to 12-bit */
+
+/* Bell decay: the level loses 1/1024 per sample, a time constant of 128 ms.
+   It is kept in Q23 so that it still decays below 1/1024. */
+#define CHIME_DECAY_SHIFT               10U
+#define CHIME_LEVEL_SHIFT               8U      /* Q23 to Q15 */
+
+/* Sequence passes of the countdown alarm, 1.2 s each */
+#define CHIME_ALARM_REPEAT              10U
+
+/* ADPCM samples */
+#define CHIME_SAMPLE_TICK               0U
+
+/* Private macro -------------------------------------------------------------*/
+#define CHIME_MS(ms)                    ((ms) * (CHIME_SAMPLE_RATE / 1000U))
+
+/* Private variables ---------------------------------------------------------*/
+static DAC_HandleTypeDef ChimeDacHandle;
+static DMA_HandleTypeDef ChimeDmaHandle;
+static TIM_HandleTypeDef ChimeTimHandle;
+static CHIME_SynthTypeDef ChimeSynth;
+static uint16_t ChimeBuffer[CHIME_BUFFER_SAMPLES];
+static __IO uint32_t ChimePlaying;
+static uint32_t ChimeDrain;              /* Halves left once the sequence ended */
+
+/* One sine period, 12-bit */
+static const int16_t ChimeSine[64] =
+{
+      0,   201,   399,   594,   783,   965,  1137,  1299,
+   1447,  1582,  1702,  1805,  1891,  1959,  2008,  2037,
+   2047,  2037,  2008,  1959,  1891,  1805,  1702,  1582,
+   1447,  1299,  1137,   965,   783,   594,   399,   201,
+      0,  -201,  -399,  -594,  -783,  -965, -1137, -1299,
+  -1447, -1582, -1702, -1805, -1891, -1959, -2008, -2037,
+  -2047, -2037, -2008, -1959, -1891, -1805, -1702, -1582,
+  -1447, -1299, -1137,  -965,  -783,  -594,  -399,  -201,
+};
+
+/* IMA ADPCM quantizer */
+static const int16_t ChimeAdpcmStep[89] =
+{
+      7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+     19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+     50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+   2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+   5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t ChimeAdpcmIndex[8] =
+{
+  -1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+/* Wood block tick, 50 ms at 8 kHz */
+static const uint8_t ChimeTickData[] =
+{
+  0x7F, 0x77, 0xF7, 0x7F, 0x7F, 0xE2, 0x08, 0x3B, 0x85, 0x09, 0x9C, 0x84,
+  0x21, 0xAB, 0xA0, 0x71, 0x88, 0xB0, 0x3A, 0x01, 0xA5, 0x0B, 0x8A, 0x17,
+  0x09, 0xBA, 0x12, 0x40, 0xC8, 0x98, 0x59, 0x92, 0xA0, 0x0C, 0x83, 0x14,
+  0x9D, 0xA0, 0x43, 0x88, 0xC9, 0x28, 0x21, 0xD3, 0x8A, 0x3A, 0x05, 0x88,
+  0x9D, 0x02, 0x32, 0xDA, 0x98, 0x60, 0x80, 0xA8, 0x2B, 0x21, 0x94, 0x9C,
+  0x09, 0x25, 0x09, 0xCB, 0x20, 0x42, 0xC8, 0x99, 0x59, 0x82, 0xA0, 0x0D,
+  0x11, 0x13, 0xAC, 0x99, 0x53, 0x00, 0xDA, 0x29, 0x31, 0xB2, 0x9C, 0x2A,
+  0x07, 0x90, 0xAB, 0x21, 0x43, 0xCA, 0xA9, 0x51, 0x82, 0xC8, 0x1B, 0x32,
+  0x94, 0xBB, 0x8A, 0x27, 0x80, 0xCB, 0x28, 0x42, 0xB0, 0xAB, 0x59, 0x04,
+  0xA8, 0x9C, 0x22, 0x23, 0xDB, 0x9A, 0x53, 0x01, 0xDA, 0x19, 0x41, 0x91,
+  0xAB, 0x2A, 0x25, 0x90, 0xAD, 0x20, 0x33, 0xD8, 0xAA, 0x50, 0x12, 0xC9,
+  0x0B, 0x32, 0x04, 0xAC, 0x8A, 0x34, 0x81, 0xCC, 0x18, 0x33, 0xB1, 0xBC,
+  0x49, 0x24, 0xA8, 0x9E, 0x21, 0x13, 0xC9, 0xAA, 0x52, 0x02, 0xCA, 0x0A,
+  0x42, 0x93, 0xBC, 0x09, 0x25, 0x91, 0xBC, 0x10, 0x34, 0xB8, 0xCB, 0x40,
+  0x23, 0xC9, 0x8C, 0x31, 0x04, 0xCA, 0x8A, 0x43, 0x82, 0xDB, 0x19, 0x42,
+  0x91, 0xAC, 0x29, 0x15, 0x90, 0x9D, 0x20, 0x23, 0xC9, 0x9B, 0x51, 0x12,
+  0xCA, 0x0B, 0x42, 0x83, 0xDB, 0x1A, 0x43, 0x91,
+};
+
+static const CHIME_SampleTypeDef ChimeSamples[] =
+{
+  { ChimeTickData, sizeof(ChimeTickData) * 2U },
+};
+
+/* E5 C5 D5 G4 */
+static const CHIME_StepTypeDef ChimeHourSteps[] =
+{
+  { CHIME_WAVE_SINE,   659U,  500U },
+  { CHIME_WAVE_SINE,   523U,  500U },
+  { CHIME_WAVE_SINE,   587U,  500U },
+  { CHIME_WAVE_SINE,   392U, 1000U },
+  { CHIME_WAVE_END,      0U,    0U },
+};
+
+/* Three 2 kHz beeps */
+static const CHIME_StepTypeDef ChimeAlarmSteps[] =
+{
+  { CHIME_WAVE_SQUARE, 2000U,  80U },
+  { CHIME_WAVE_REST,      0U,  80U },
+  { CHIME_WAVE_SQUARE, 2000U,  80U },
+  { CHIME_WAVE_REST,      0U,  80U },
+  { CHIME_WAVE_SQUARE, 2000U,  80U },
+  { CHIME_WAVE_REST,      0U, 800U },
+  { CHIME_WAVE_END,       0U,   0U },
+};
+
+static const CHIME_StepTypeDef ChimeTickSteps[] =
+{
+  { CHIME_WAVE_SAMPLE, CHIME_SAMPLE_TICK, 0U },
+  { CHIME_WAVE_END,    0U,                0U },
+};
+
+static const CHIME_SequenceTypeDef ChimeSequences[CHIME_COUNT] =
+{
+  { ChimeHourSteps,  1U },
+  { ChimeAlarmSteps, CHIME_ALARM_REPEAT },
+  { ChimeTickSteps,  1U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void     CHIME_StartStep(void);
+static uint32_t CHIME_NextStep(void);
+static int32_t  CHIME_AdpcmDecode(void);
+static uint32_t CHIME_Fill(uint16_t *Dest, uint32_t Count);
+static void     CHIME_Refill(uint16_t *Half);
+static void     CHIME_Halt(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Load the synthesiser with the current step.
+  * @param  None
+  * @retval None
+  */
+static void CHIME_StartStep(void)
+{
+  const CHIME_StepTypeDef *step = ChimeSynth.Step;
+
+  ChimeSynth.Left     = CHIME_MS(step->Ms);
+  ChimeSynth.Phase    = 0U;
+  ChimeSynth.PhaseInc = step->Arg * CHIME_PHASE_PER_HZ;
+
+  switch (step->Wave)
+  {
+  case CHIME_WAVE_SINE:
+    ChimeSynth.Level = CHIME_SINE_LEVEL << CHIME_LEVEL_SHIFT;
+    break;
+  case CHIME_WAVE_SAMPLE:
+    ChimeSynth.Left      = ChimeSamples[step->Arg].Samples;
+    ChimeSynth.Adpcm     = ChimeSamples[step->Arg].Data;
+    ChimeSynth.Nibble    = 0U;
+    ChimeSynth.Predictor = 0;
+    ChimeSynth.Index     = 0;
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  Move to the next step, back to the first one for a repeat.
+  * @note   The end step is kept once the last pass is over.
+  * @param  None
+  * @retval Zero at the end of the chime
+  */
+static uint32_t CHIME_NextStep(void)
+{
+  if (ChimeSynth.Step->Wave == CHIME_WAVE_END)
+  {
+    return 0U;
+  }
+
+  ChimeSynth.Step++;
+  if (ChimeSynth.Step->Wave == CHIME_WAVE_END)
+  {
+    if (--ChimeSynth.Repeat == 0U)
+    {
+      return 0U;
+    }
+    ChimeSynth.Step = ChimeSynth.Sequence->Steps;
+  }
+  CHIME_StartStep();
+  return 1U;
+}
+
+/**
+  * @brief  Decode the next sample of the ADPCM step.
+  * @param  None
+  * @retval 16-bit sample
+  */
+static int32_t CHIME_AdpcmDecode(void)
+{
+  uint32_t code = (ChimeSynth.Adpcm[ChimeSynth.Nibble >> 1U] >> ((ChimeSynth.Nibble & 1U) * 4U)) & 0x0FU;
+  int32_t step = ChimeAdpcmStep[ChimeSynth.Index];
+  int32_t diff = step >> 3;
+
+  ChimeSynth.Nibble++;
+
+  if ((code & 4U) != 0U)
+  {
+    diff += step;
+  }
+  if ((code & 2U) != 0U)
+  {
+    diff += step >> 1;
+  }
+  if ((code & 1U) != 0U)
+  {
+    diff += step >> 2;
+  }
+  ChimeSynth.Predictor += ((code & 8U) != 0U) ? -diff : diff;
+  if (ChimeSynth.Predictor > 32767)
+  {
+    ChimeSynth.Predictor = 32767;
+  }
+  else if (ChimeSynth.Predictor < -32768)
+  {
+    ChimeSynth.Predictor = -32768;
+  }
+
+  ChimeSynth.Index += ChimeAdpcmIndex[code & 7U];
+  if (ChimeSynth.Index < 0)
+  {
+    ChimeSynth.Index = 0;
+  }
+  else if (ChimeSynth.Index > 88)
+  {
+    ChimeSynth.Index = 88;
+  }
+
+  return ChimeSynth.Predictor;
+}
+
+/**
+  * @brief  Synthesise samples, silence after the end of the chime.
+  * @param  Dest: DAC codes
+  * @param  Count: Samples to write
+  * @retval Non zero if the chime ended in these samples
+  */
+static uint32_t CHIME_Fill(uint16_t *Dest, uint32_t Count)
+{
+  int32_t value;
+  uint32_t i;
+
+  for (i = 0U; i < Count; i++)
+  {
+    while (ChimeSynth.Left == 0U)
+    {
+      if (CHIME_NextStep() == 0U)
+      {
+        for (; i < Count; i++)
+        {
+          Dest[i] = CHIME_DAC_MID;
+        }
+        return 1U;
+      }
+    }
+    ChimeSynth.Left--;
+
+    switch (ChimeSynth.Step->Wave)
+    {
+    case CHIME_WAVE_SINE:
+      value = (ChimeSine[ChimeSynth.Phase >> 26U] * (ChimeSynth.Level >> CHIME_LEVEL_SHIFT)) >> 15;
+      ChimeSynth.Level -= ChimeSynth.Level >> CHIME_DECAY_SHIFT;
+      break;
+    case CHIME_WAVE_SQUARE:
+      value = ((ChimeSynth.Phase & 0x80000000U) != 0U) ? (2047 * CHIME_SQUARE_LEVEL) >> 15
+                                                        : -((2047 * CHIME_SQUARE_LEVEL) >> 15);
+      break;
+    case CHIME_WAVE_SAMPLE:
+      value = CHIME_AdpcmDecode() >> CHIME_SAMPLE_SHIFT;
+      break;
+    default:
+      value = 0;
+      break;
+    }
+    ChimeSynth.Phase += ChimeSynth.PhaseInc;
+
+    Dest[i] = (uint16_t)(CHIME_DAC_MID + value);
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Refill the half of the buffer the DMA has just played.
+  * @note   Once the chime has ended, the other half still has to be played:
+  *         the chime is stopped on the second interrupt after its end.
+  * @param  Half: First sample of the half
+  * @retval None
+  */
+static void CHIME_Refill(uint16_t *Half)
+{
+  if (ChimeDrain != 0U)
+  {
+    if (--ChimeDrain == 0U)
+    {
+      CHIME_Halt();
+      return;
+    }
+    CHIME_Fill(Half, CHIME_HALF_SAMPLES);
+    return;
+  }
+
+  if (CHIME_Fill(Half, CHIME_HALF_SAMPLES) != 0U)
+  {
+    ChimeDrain = 2U;
+  }
+}
+
+/**
+  * @brief  Stop the timer, the DAC and its DMA, and gate their clocks.
+  * @param  None
+  * @retval None
+  */
+static void CHIME_Halt(void)
+{
+  HAL_TIM_Base_Stop(&ChimeTimHandle);
+  HAL_DAC_Stop_DMA(&ChimeDacHandle, CHIME_DAC_CHANNEL);
+  __HAL_RCC_TIM6_CLK_DISABLE();
+  __HAL_RCC_DAC_CLK_DISABLE();
+
+  ChimePlaying = 0U;
+  EVT_InhibitStop(EVT_STOP_CHIME, DISABLE);
+}
+
+/**
+  * @brief  Initialize the DAC, its DMA channel and TIM6, then gate them.
+  * @param  None
+  * @retval None
+  */
+void CHIME_Init(void)
+{
+  DAC_ChannelConfTypeDef channel = {0};
+  TIM_MasterConfigTypeDef master = {0};
+
+  ChimeDacHandle.Instance = DAC;
+  HAL_DAC_Init(&ChimeDacHandle);
+
+  channel.DAC_Trigger      = DAC_TRIGGER_T6_TRGO;
+  channel.DAC_OutputBuffer = DAC_OUTPUTBUFFER_ENABLE;
+  HAL_DAC_ConfigChannel(&ChimeDacHandle, &channel, CHIME_DAC_CHANNEL);
+
+  /* The sample period is set when a chime starts, from the current clock */
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  ChimeTimHandle.Instance               = TIM6;
+  ChimeTimHandle.Init.Prescaler         = 0U;
+  ChimeTimHandle.Init.CounterMode       = TIM_COUNTERMODE_UP;
+  ChimeTimHandle.Init.Period            = 0xFFFFU;
+  ChimeTimHandle.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;
+  ChimeTimHandle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  HAL_TIM_Base_Init(&ChimeTimHandle);
+
+  master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  master.MasterSlaveMode     = TIM_MASTERSLAVEMODE_DISABLE;
+  HAL_TIMEx_MasterConfigSynchronization(&ChimeTimHandle, &master);
+
+  __HAL_RCC_TIM6_CLK_DISABLE();
+  __HAL_RCC_DAC_CLK_DISABLE();
+}
+
+/**
+  * @brief  Play a chime, from its start if it is already playing.
+  * @param  Chime: Sound to play
+  * @retval None
+  */
+void CHIME_Play(CHIME_TypeDef Chime)
+{
+  __disable_irq();
+
+  ChimeSynth.Sequence = &ChimeSequences[Chime];
+  ChimeSynth.Step     = ChimeSynth.Sequence->Steps;
+  ChimeSynth.Repeat   = ChimeSynth.Sequence->Repeat;
+  CHIME_StartStep();
+  ChimeDrain = 0U;
+
+  if (ChimePlaying != 0U)
+  {
+    /* The DMA interrupt goes on with the new sequence */
+    __enable_irq();
+    return;
+  }
+  ChimePlaying = 1U;
+  __enable_irq();
+
+  CHIME_Refill(&ChimeBuffer[0]);
+  CHIME_Refill(&ChimeBuffer[CHIME_HALF_SAMPLES]);
+
+  /* TIM6 counts at PCLK1: the APB1 prescaler is 1 */
+  __HAL_RCC_DAC_CLK_ENABLE();
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  __HAL_TIM_SET_AUTORELOAD(&ChimeTimHandle, (HAL_RCC_GetPCLK1Freq() / CHIME_SAMPLE_RATE) - 1U);
+
+  EVT_InhibitStop(EVT_STOP_CHIME, ENABLE);
+  HAL_DAC_Start_DMA(&ChimeDacHandle, CHIME_DAC_CHANNEL, (uint32_t *)ChimeBuffer,
+                    CHIME_BUFFER_SAMPLES, DAC_ALIGN_12B_R);
+  HAL_TIM_Base_Start(&ChimeTimHandle);
+}
+
+/**
+  * @brief  Stop the chime being played, if any.
+  * @param  None
+  * @retval None
+  */
+void CHIME_Stop(void)
+{
+  __disable_irq();
+  if (ChimePlaying != 0U)
+  {
+    CHIME_Halt();
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  Whether a chime is being played.
+  * @param  None
+  * @retval Non zero while playing
+  */
+uint32_t CHIME_IsPlaying(void)
+{
+  return ChimePlaying;
+}
+
+/**
+  * @brief  Follow a change of the core clock while a chime plays.
+  * @note   The counter restarts on the new period: one sample at most is
+  *         played for a wrong time.
+  * @param  None
+  * @retval None
+  */
+void CHIME_ClockUpdate(void)
+{
+  __disable_irq();
+  if (ChimePlaying != 0U)
+  {
+    __HAL_TIM_SET_AUTORELOAD(&ChimeTimHandle, (HAL_RCC_GetPCLK1Freq() / CHIME_SAMPLE_RATE) - 1U);
+    __HAL_TIM_SET_COUNTER(&ChimeTimHandle, 0U);
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  DAC MSP initialization: analog output pin and DMA channel.
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_MspInit(DAC_HandleTypeDef *hdac)
+{
+  GPIO_InitTypeDef gpio = {0};
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  __HAL_RCC_DAC_CLK_ENABLE();
+
+  gpio.Pin  = CHIME_DAC_PIN;
+  gpio.Mode = GPIO_MODE_ANALOG;
+  gpio.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(CHIME_DAC_GPIO_PORT, &gpio);
+
+  ChimeDmaHandle.Instance                 = CHIME_DMA_CHANNEL;
+  ChimeDmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  ChimeDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  ChimeDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  ChimeDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  ChimeDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  ChimeDmaHandle.Init.Mode                = DMA_CIRCULAR;
+  ChimeDmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&ChimeDmaHandle);
+  __HAL_LINKDMA(hdac, CHIME_DAC_DMA_HANDLE, ChimeDmaHandle);
+
+  HAL_NVIC_SetPriority(CHIME_DMA_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(CHIME_DMA_IRQn);
+}
+
+/**
+  * @brief  First half played: refill it.
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+  CHIME_Refill(&ChimeBuffer[0]);
+}
+
+/**
+  * @brief  Second half played: refill it.
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+  CHIME_Refill(&ChimeBuffer[CHIME_HALF_SAMPLES]);
+}
+
+/**
+  * @brief  First half played on channel 2: refill it.
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+  CHIME_Refill(&ChimeBuffer[0]);
+}
+
+/**
+  * @brief  Second half played on channel 2: refill it.
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+  CHIME_Refill(&ChimeBuffer[CHIME_HALF_SAMPLES]);
+}
+
+/**
+  * @brief  This function handles the DAC DMA channel interrupt request.
+  * @param  None
+  * @retval None
+  */
+void CHIME_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&ChimeDmaHandle);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,364 @@
+/**
+  ******************************************************************************
+  * @file    chrono.c
+  * @author  MCD Application Team
+  * @brief   Stopwatch and countdown timer based on the RTC sub-seconds.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Elapsed time is the difference of two RTC time stamps (RTC_TR plus
+        RTC_SSR, 1/256 s resolution), so no timer or SysTick runs while the
+        stopwatch counts and the core can stay in STOP mode.
+    (#) The countdown end is programmed in RTC Alarm B with all sub-second
+        bits compared. HAL_RTCEx_AlarmBEventCallback() posts
+        EVT_COUNTDOWN_EXPIRED and the handler calls CHRONO_CountdownExpired().
+    (#) The countdown starts from its preset, CHRONO_COUNTDOWN_DEFAULT_S
+        until CHRONO_CountdownSet() is called. CHRONO_CountdownReset() goes
+        back to it.
+
+    [..]
+    (@) A running stopwatch must be read at least once a day, a running
+        countdown is limited to less than 24 hours (Alarm B date is masked).
+    (@) The preset is not saved across STANDBY: it is back to its default
+        after the power loss snapshot is restored.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono.h"
+#include "rtc.h"
+#include "event.h"
+#include "stdio.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define CHRONO_COUNTDOWN_MAX   (RTC_STAMP_PER_DAY - RTC_STAMP_FREQ)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static CHRONO_StateTypeDef SwState;
+static uint32_t SwStart;        /* Stamp of the last start or fold         */
+static uint32_t SwElapsed;      /* Stamps counted before SwStart           */
+
+static CHRONO_StateTypeDef CdState;
+static uint32_t CdStart;        /* Stamp of the last start                 */
+static uint32_t CdRemaining;    /* Stamps left at CdStart                  */
+static uint32_t CdPreset;       /* Stamps of a countdown reset             */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CHRONO_Since(uint32_t start, uint32_t now);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Stamps elapsed between two time stamps, across midnight.
+  * @param  start: Earlier stamp
+  * @param  now: Later stamp
+  * @retval Elapsed stamps, less than one day
+  */
+static uint32_t CHRONO_Since(uint32_t start, uint32_t now)
+{
+  return (now + RTC_STAMP_PER_DAY - start) % RTC_STAMP_PER_DAY;
+}
+
+/**
+  * @brief  Reset the stopwatch and the countdown.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_Init(void)
+{
+  SwState = CHRONO_STOPPED;
+  SwElapsed = 0U;
+  CdState = CHRONO_STOPPED;
+  CdPreset = CHRONO_COUNTDOWN_DEFAULT_S * RTC_STAMP_FREQ;
+  CdRemaining = CdPreset;
+}
+
+/**
+  * @brief  Start or resume the stopwatch.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_StopwatchStart(void)
+{
+  if (SwState != CHRONO_RUNNING)
+  {
+    SwStart = RTC_GetStamp();
+    SwState = CHRONO_RUNNING;
+  }
+}
+
+/**
+  * @brief  Stop the stopwatch, keeping the elapsed time.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_StopwatchStop(void)
+{
+  if (SwState == CHRONO_RUNNING)
+  {
+    SwElapsed += CHRONO_Since(SwStart, RTC_GetStamp());
+    SwState = CHRONO_STOPPED;
+  }
+}
+
+/**
+  * @brief  Clear the stopwatch. A running stopwatch restarts from zero.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_StopwatchReset(void)
+{
+  SwElapsed = 0U;
+  SwStart = RTC_GetStamp();
+}
+
+/**
+  * @brief  Stopwatch time.
+  * @note   The running interval is folded into the total on each call so
+  *         that it never spans more than a day.
+  * @param  None
+  * @retval Elapsed time, in 1/RTC_STAMP_FREQ s
+  */
+uint32_t CHRONO_StopwatchElapsed(void)
+{
+  uint32_t now;
+
+  if (SwState == CHRONO_RUNNING)
+  {
+    now = RTC_GetStamp();
+    SwElapsed += CHRONO_Since(SwStart, now);
+    SwStart = now;
+  }
+  return SwElapsed;
+}
+
+/**
+  * @brief  Stopwatch state.
+  * @param  None
+  * @retval CHRONO_STOPPED or CHRONO_RUNNING
+  */
+CHRONO_StateTypeDef CHRONO_StopwatchState(void)
+{
+  return SwState;
+}
+
+/**
+  * @brief  Set the countdown preset and reset the countdown to it. A running
+  *         countdown is stopped.
+  * @param  seconds: Duration, less than 24 hours
+  * @retval None
+  */
+void CHRONO_CountdownSet(uint32_t seconds)
+{
+  CdPreset = seconds * RTC_STAMP_FREQ;
+  if (CdPreset > CHRONO_COUNTDOWN_MAX)
+  {
+    CdPreset = CHRONO_COUNTDOWN_MAX;
+  }
+  CHRONO_CountdownReset();
+}
+
+/**
+  * @brief  Stop the countdown and bring it back to its preset.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_CountdownReset(void)
+{
+  if (CdState == CHRONO_RUNNING)
+  {
+    RTC_CancelAlarmB();
+  }
+
+  CdRemaining = CdPreset;
+  CdState = CHRONO_STOPPED;
+}
+
+/**
+  * @brief  Countdown preset.
+  * @param  None
+  * @retval Duration a reset brings the countdown back to, in seconds
+  */
+uint32_t CHRONO_CountdownPreset(void)
+{
+  return CdPreset / RTC_STAMP_FREQ;
+}
+
+/**
+  * @brief  Start or resume the countdown: Alarm B is set to its end.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_CountdownStart(void)
+{
+  if ((CdState == CHRONO_STOPPED) && (CdRemaining != 0U))
+  {
+    CdStart = RTC_GetStamp();
+    RTC_SetAlarmB(CdStart + CdRemaining);
+    CdState = CHRONO_RUNNING;
+  }
+}
+
+/**
+  * @brief  Pause the countdown, keeping the remaining time.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_CountdownStop(void)
+{
+  if (CdState == CHRONO_RUNNING)
+  {
+    RTC_CancelAlarmB();
+    CdRemaining = CHRONO_CountdownRemaining();
+    CdState = CHRONO_STOPPED;
+  }
+}
+
+/**
+  * @brief  Mark the countdown as expired, called on EVT_COUNTDOWN_EXPIRED.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_CountdownExpired(void)
+{
+  CdRemaining = 0U;
+  CdState = CHRONO_EXPIRED;
+}
+
+/**
+  * @brief  Countdown time left.
+  * @param  None
+  * @retval Remaining time, in 1/RTC_STAMP_FREQ s
+  */
+uint32_t CHRONO_CountdownRemaining(void)
+{
+  uint32_t elapsed;
+
+  if (CdState != CHRONO_RUNNING)
+  {
+    return CdRemaining;
+  }
+
+  elapsed = CHRONO_Since(CdStart, RTC_GetStamp());
+  return (elapsed < CdRemaining) ? (CdRemaining - elapsed) : 0U;
+}
+
+/**
+  * @brief  Countdown state.
+  * @param  None
+  * @retval CHRONO_STOPPED, CHRONO_RUNNING or CHRONO_EXPIRED
+  */
+CHRONO_StateTypeDef CHRONO_CountdownState(void)
+{
+  return CdState;
+}
+
+/**
+  * @brief  Save the stopwatch and countdown in the backup registers.
+  * @note   Time stamps stay valid across STANDBY since the RTC keeps
+  *         running, so a running timer resumes as if nothing happened. The
+  *         countdown end is still held by Alarm B.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_Save(void)
+{
+  RTC_BackupWrite(RTC_BKP_CHRONO, (uint32_t)SwState | ((uint32_t)CdState << 8U));
+  RTC_BackupWrite(RTC_BKP_CHRONO + 1U, SwStart);
+  RTC_BackupWrite(RTC_BKP_CHRONO + 2U, SwElapsed);
+  RTC_BackupWrite(RTC_BKP_CHRONO + 3U, CdStart);
+  RTC_BackupWrite(RTC_BKP_CHRONO + 4U, CdRemaining);
+}
+
+/**
+  * @brief  Restore what CHRONO_Save() stored.
+  * @note   A countdown that ended meanwhile expires right away: its event
+  *         is handled once the main loop runs.
+  * @param  None
+  * @retval None
+  */
+void CHRONO_Restore(void)
+{
+  uint32_t states = RTC_BackupRead(RTC_BKP_CHRONO);
+
+  SwState = (CHRONO_StateTypeDef)(states & 0xFFU);
+  CdState = (CHRONO_StateTypeDef)((states >> 8U) & 0xFFU);
+  SwStart = RTC_BackupRead(RTC_BKP_CHRONO + 1U);
+  SwElapsed = RTC_BackupRead(RTC_BKP_CHRONO + 2U);
+  CdStart = RTC_BackupRead(RTC_BKP_CHRONO + 3U);
+  CdRemaining = RTC_BackupRead(RTC_BKP_CHRONO + 4U);
+
+  /* The alarm interrupt setup did not survive the reset */
+  if (CdState == CHRONO_RUNNING)
+  {
+    if (CHRONO_CountdownRemaining() != 0U)
+    {
+      RTC_SetAlarmB(CdStart + CdRemaining);
+    }
+    else
+    {
+      /* The alarm interrupt is the only producer of its event ring: keep
+         it out while posting in its place */
+      HAL_NVIC_DisableIRQ(RTC_Alarm_IRQn);
+      EVT_Post(EVT_SRC_RTC_ALARM, EVT_COUNTDOWN_EXPIRED, 0U);
+      HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
+    }
+  }
+}
+
+/**
+  * @brief  Format a duration for the 6 digits glass.
+  * @note   Hundredths are only rendered when they can be read: the display
+  *         of a running timer is refreshed once a second, so it shows
+  *         "HH:MM:SS", while a frozen time below one hour shows "MM:SS.hh".
+  * @param  str: Output buffer, at least 9 characters
+  * @param  stamps: Duration, in 1/RTC_STAMP_FREQ s
+  * @param  running: Non zero if the timer is running
+  * @retval None
+  */
+void CHRONO_Format(uint8_t *str, uint32_t stamps, uint8_t running)
+{
+  uint32_t sec = stamps / RTC_STAMP_FREQ;
+  uint32_t hundredths = ((stamps % RTC_STAMP_FREQ) * 100U) / RTC_STAMP_FREQ;
+
+  if ((running == 0U) && (sec < 3600U))
+  {
+    sprintf((char *)str, "%.2d:%.2d.%.2d",
+            (int)(sec / 60U), (int)(sec % 60U), (int)hundredths);
+  }
+  else
+  {
+    sprintf((char *)str, "%.2d:%.2d:%.2d",
+            (int)((sec / 3600U) % 100U), (int)((sec / 60U) % 60U), (int)(sec % 60U));
+  }
+}
+
+/**
+  * @brief  Alarm B callback, called from RTC_Alarm_IRQHandler.
+  * @param  hrtc: RTC handle
+  * @retval None
+  */
+void HAL_RTCEx_AlarmBEventCallback(RTC_HandleTypeDef *hrtc)
+{
+  EVT_Post(EVT_SRC_RTC_ALARM, EVT_COUNTDOWN_EXPIRED, 0U);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
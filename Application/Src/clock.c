@@ -0,0 +1,654 @@
+/**
+  ******************************************************************************
+  * @file    clock.c
+  * @author  MCD Application Team
+  * @brief   Clock application: display modes and their rendering through
+  *          the display layer, driven by the RTC events, and time setting
+  *          with the user button.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to set the time #####
+  ==============================================================================
+    [..]
+    (#) In the time or the sense mode, hold the user button for
+        BTN_LONG_TICKS: the hours are edited.
+    (#) Each press adds one, holding the button repeats. Sliding a finger
+        on the touch slider also steps the field up or down.
+    (#) After CLOCK_SET_TIMEOUT_S without a press, the minutes are edited,
+        then the time is written to the RTC with the seconds cleared.
+    (#) Only the edited field is shown, blinked by the LCD controller on
+        the glass: no refresh is needed while the part sleeps. The TFT
+        highlights it instead.
+    (#) Outside time setting, the slider position sets the glass contrast,
+        except on a countdown that is not running (see below). The slider
+        is only on the 32L152CDISCOVERY (USE_TOUCH_SLIDER).
+
+  ==============================================================================
+                        ##### Display modes #####
+  ==============================================================================
+    [..]
+    (#) Outside time setting, a short press goes to the next mode: time,
+        stopwatch, countdown, then the die temperature and supply shown
+        alternately for CLOCK_SENSE_SHOW_S seconds each from the last
+        sample set, and back to the time.
+    (#) In the stopwatch and countdown modes, a long press starts or stops
+        the timer. A second long press within CLOCK_RESET_S seconds of the
+        one that stopped it resets it instead: the stopwatch to zero, the
+        countdown to its preset. A long press on an expired countdown
+        resets it too.
+    (#) On a countdown that is not running, sliding a finger steps the
+        preset by CLOCK_COUNTDOWN_STEP_S every CLOCK_TOUCH_STEP. Without
+        the slider, the preset is CHRONO_COUNTDOWN_DEFAULT_S or the one of
+        a sync packet.
+    (#) A stopped timer shows its frozen time with hundredths below one
+        hour (CHRONO_Format()).
+
+  ==============================================================================
+                        ##### Chimes #####
+  ==============================================================================
+    [..]
+    (#) The hours are chimed, the end of the countdown sounds the alarm and
+        each step of the time setting ticks (chime.c).
+    (#) A press on the user button silences a chime.
+
+    [..]
+    (@) Utilities/HostTest/clock_test.c drives the modes from button and
+        slider events on the host, with the RTC and Alarm B simulated: the
+        stopwatch, the preset and a countdown expiring in the time mode.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "clock.h"
+#include "display.h"
+#include "chrono.h"
+#include "battery.h"
+#include "button.h"
+#include "touch.h"
+#include "event.h"
+#include "rtc.h"
+#include "profile.h"
+#include "log.h"
+#include "chime.h"
+#include "sense.h"
+#include "light.h"
+#include "power.h"
+#include "watchdog.h"
+#include "stdio.h"
+#include "clock_ll.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Seconds without a press before moving to the next field */
+#define CLOCK_SET_TIMEOUT_S     3U
+
+/* Slider travel for one step of the field being set */
+#define CLOCK_TOUCH_STEP        32U
+
+/* Field being set, CLOCK_SET_NONE when not setting the time */
+#define CLOCK_SET_NONE          0U
+#define CLOCK_SET_HOURS         1U
+#define CLOCK_SET_MINUTES       2U
+
+/* Seconds the temperature, then the supply, stay on in CLOCK_MODE_SENSE */
+#define CLOCK_SENSE_SHOW_S      2U
+
+/* Seconds after a timer stop during which a long press resets it */
+#define CLOCK_RESET_S           5U
+
+/* Countdown preset step of the slider, and lowest preset */
+#define CLOCK_COUNTDOWN_STEP_S  60U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static CLOCK_ModeTypeDef ClockMode = CLOCK_MODE_TIME;
+
+static uint8_t ClockSetField = CLOCK_SET_NONE;
+static uint8_t ClockSetHours;
+static uint8_t ClockSetMinutes;
+static uint8_t ClockSetIdle;    /* Seconds since the last press            */
+static uint32_t ClockStopped;   /* RTC second of the last timer stop, + 1  */
+#if defined(USE_TOUCH_SLIDER)
+static uint32_t ClockTouchRef = TOUCH_RELEASED; /* Slider position of the last step */
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void CLOCK_OnWakeUp(uint32_t Param);
+static void CLOCK_OnCountdownExpired(uint32_t Param);
+static void CLOCK_OnButton(uint32_t Param);
+static void CLOCK_OnTimerButton(void);
+#if defined(USE_TOUCH_SLIDER)
+static void CLOCK_OnTouch(uint32_t Param);
+static void CLOCK_StepCountdown(uint8_t up);
+#endif
+static void CLOCK_StepField(uint8_t up);
+static void CLOCK_ShowSetTime(void);
+static void CLOCK_FormatSense(uint8_t *str);
+static void CLOCK_FrameBCD(DISPLAY_FrameTypeDef *frame, uint32_t hms);
+#if defined(USE_CLOCK_LL)
+static uint32_t CLOCK_RefreshLL(void);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Refresh the display on the 1 s wake-up, handler of EVT_RTC_WAKEUP.
+  * @note   A stopped stopwatch or countdown shows a frozen time: the display
+  *         is left untouched.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void CLOCK_OnWakeUp(uint32_t Param)
+{
+  uint32_t start, before;
+
+  /* Periodic services ride on this wake-up */
+  WDG_OnSecond();
+  SENSE_OnSecond();
+  BATT_OnSecond();
+#if defined(USE_LIGHT_SENSOR)
+  LIGHT_OnSecond();
+#endif
+#if defined(USE_TOUCH_SLIDER)
+  TOUCH_OnSecond();
+#endif
+#if defined(USE_DEEP_IDLE)
+  POWER_OnSecond();
+#endif
+
+  if (ClockSetField != CLOCK_SET_NONE)
+  {
+    if (++ClockSetIdle < CLOCK_SET_TIMEOUT_S)
+    {
+      return;
+    }
+    ClockSetIdle = 0U;
+    if (ClockSetField == CLOCK_SET_HOURS)
+    {
+      ClockSetField = CLOCK_SET_MINUTES;
+      CLOCK_ShowSetTime();
+      return;
+    }
+    before = LOG_Now();
+    RTC_SetTime(ClockSetHours, ClockSetMinutes);
+    LOG_Write(LOG_TIME_SET, 0U, before);
+    ClockSetField = CLOCK_SET_NONE;
+    CLOCK_SetMode(ClockMode);
+    return;
+  }
+
+  if (((RTC_GetStamp() / RTC_STAMP_FREQ) % 3600U) == 0U)
+  {
+    CHIME_Play(CHIME_HOUR);
+  }
+
+  if (((ClockMode == CLOCK_MODE_STOPWATCH) && (CHRONO_StopwatchState() != CHRONO_RUNNING)) ||
+      ((ClockMode == CLOCK_MODE_COUNTDOWN) && (CHRONO_CountdownState() != CHRONO_RUNNING)))
+  {
+    return;
+  }
+
+  start = PROF_CYCLES();
+  CLOCK_Refresh();
+  PROF_Record(PROF_CLOCK_REFRESH, start);
+}
+
+/**
+  * @brief  Countdown end, handler of EVT_COUNTDOWN_EXPIRED.
+  * @note   The countdown is brought on the display, which blinks until the
+  *         mode is changed, and the alarm sounds.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void CLOCK_OnCountdownExpired(uint32_t Param)
+{
+  /* The alarm takes precedence over an unfinished time setting */
+  ClockSetField = CLOCK_SET_NONE;
+  CHRONO_CountdownExpired();
+  CLOCK_SetMode(CLOCK_MODE_COUNTDOWN);
+  DISPLAY_Blink(DISPLAY_BLINK_SLOW);
+  CHIME_Play(CHIME_ALARM);
+}
+
+/**
+  * @brief  User button action handler.
+  * @param  Param: BTN_ActionTypeDef value
+  * @retval None
+  */
+static void CLOCK_OnButton(uint32_t Param)
+{
+  uint8_t sec;
+
+#if defined(USE_DEEP_IDLE)
+  POWER_Activity();
+#endif
+
+  if (ClockSetField == CLOCK_SET_NONE)
+  {
+    if ((Param == BTN_SHORT) && (CHIME_IsPlaying() != 0U))
+    {
+      CHIME_Stop();
+      return;
+    }
+    if (Param == BTN_SHORT)
+    {
+      ClockStopped = 0U;
+      CLOCK_SetMode((CLOCK_ModeTypeDef)((ClockMode + 1U) % CLOCK_MODE_COUNT));
+      return;
+    }
+    if ((Param == BTN_LONG) &&
+        ((ClockMode == CLOCK_MODE_STOPWATCH) || (ClockMode == CLOCK_MODE_COUNTDOWN)))
+    {
+      CLOCK_OnTimerButton();
+      return;
+    }
+    if (Param == BTN_LONG)
+    {
+      RTC_GetTime(&ClockSetHours, &ClockSetMinutes, &sec);
+      ClockSetField = CLOCK_SET_HOURS;
+      ClockSetIdle = 0U;
+      CLOCK_ShowSetTime();
+      DISPLAY_Blink(DISPLAY_BLINK_FAST);
+    }
+    return;
+  }
+
+  /* Short press, long press and repeats all step the edited field */
+  CLOCK_StepField(1U);
+}
+
+/**
+  * @brief  Long press in the stopwatch or countdown mode: start, stop, or
+  *         reset within CLOCK_RESET_S of a stop.
+  * @param  None
+  * @retval None
+  */
+static void CLOCK_OnTimerButton(void)
+{
+  uint32_t now = (RTC_GetStamp() / RTC_STAMP_FREQ) + 1U;
+  uint32_t reset = ((ClockStopped != 0U) &&
+                    (((now + 86400U - ClockStopped) % 86400U) <= CLOCK_RESET_S)) ? 1U : 0U;
+
+  ClockStopped = 0U;
+  if (ClockMode == CLOCK_MODE_STOPWATCH)
+  {
+    if (CHRONO_StopwatchState() == CHRONO_RUNNING)
+    {
+      CHRONO_StopwatchStop();
+      ClockStopped = now;
+    }
+    else if (reset != 0U)
+    {
+      CHRONO_StopwatchReset();
+    }
+    else
+    {
+      CHRONO_StopwatchStart();
+    }
+  }
+  else
+  {
+    if (CHRONO_CountdownState() == CHRONO_RUNNING)
+    {
+      CHRONO_CountdownStop();
+      ClockStopped = now;
+    }
+    else if ((reset != 0U) || (CHRONO_CountdownState() == CHRONO_EXPIRED))
+    {
+      CHRONO_CountdownReset();
+    }
+    else
+    {
+      CHRONO_CountdownStart();
+    }
+  }
+
+  /* Blink of an expired countdown off, frozen or running time shown */
+  CLOCK_SetMode(ClockMode);
+  CHIME_Play(CHIME_TICK);
+}
+
+#if defined(USE_TOUCH_SLIDER)
+/**
+  * @brief  Touch slider handler.
+  * @note   While setting the time, sliding steps the edited field up or
+  *         down every CLOCK_TOUCH_STEP, and on a countdown that is not
+  *         running the preset. Otherwise the slider position sets the glass
+  *         contrast.
+  * @param  Param: Slider position or TOUCH_RELEASED
+  * @retval None
+  */
+static void CLOCK_OnTouch(uint32_t Param)
+{
+  uint32_t preset = ((ClockSetField == CLOCK_SET_NONE) && (ClockMode == CLOCK_MODE_COUNTDOWN) &&
+                     (CHRONO_CountdownState() != CHRONO_RUNNING)) ? 1U : 0U;
+
+#if defined(USE_DEEP_IDLE)
+  POWER_Activity();
+#endif
+
+  if ((Param == TOUCH_RELEASED) || (ClockTouchRef == TOUCH_RELEASED))
+  {
+    ClockTouchRef = Param;
+    if ((Param == TOUCH_RELEASED) || (ClockSetField != CLOCK_SET_NONE) || (preset != 0U))
+    {
+      return;
+    }
+  }
+
+  if ((ClockSetField == CLOCK_SET_NONE) && (preset == 0U))
+  {
+    DISPLAY_Contrast(Param * (DISPLAY_CONTRAST_MAX + 1U) / (TOUCH_POSITION_MAX + 1U));
+    return;
+  }
+
+  while ((Param + CLOCK_TOUCH_STEP) <= ClockTouchRef)
+  {
+    ClockTouchRef -= CLOCK_TOUCH_STEP;
+    if (preset != 0U)
+    {
+      CLOCK_StepCountdown(0U);
+    }
+    else
+    {
+      CLOCK_StepField(0U);
+    }
+  }
+  while (Param >= (ClockTouchRef + CLOCK_TOUCH_STEP))
+  {
+    ClockTouchRef += CLOCK_TOUCH_STEP;
+    if (preset != 0U)
+    {
+      CLOCK_StepCountdown(1U);
+    }
+    else
+    {
+      CLOCK_StepField(1U);
+    }
+  }
+}
+
+/**
+  * @brief  Step the countdown preset and show it.
+  * @param  up: Non zero to add CLOCK_COUNTDOWN_STEP_S, zero to subtract it
+  * @retval None
+  */
+static void CLOCK_StepCountdown(uint8_t up)
+{
+  uint32_t preset = CHRONO_CountdownPreset();
+
+  if (up != 0U)
+  {
+    preset += CLOCK_COUNTDOWN_STEP_S;
+  }
+  else if (preset >= (2U * CLOCK_COUNTDOWN_STEP_S))
+  {
+    preset -= CLOCK_COUNTDOWN_STEP_S;
+  }
+  ClockStopped = 0U;
+  CHRONO_CountdownSet(preset);
+  CLOCK_SetMode(CLOCK_MODE_COUNTDOWN);
+  CHIME_Play(CHIME_TICK);
+}
+#endif /* USE_TOUCH_SLIDER */
+
+/**
+  * @brief  Step the field being set and show it.
+  * @param  up: Non zero to add one, zero to subtract one
+  * @retval None
+  */
+static void CLOCK_StepField(uint8_t up)
+{
+  ClockSetIdle = 0U;
+  if (ClockSetField == CLOCK_SET_HOURS)
+  {
+    ClockSetHours = (ClockSetHours + ((up != 0U) ? 1U : 23U)) % 24U;
+  }
+  else
+  {
+    ClockSetMinutes = (ClockSetMinutes + ((up != 0U) ? 1U : 59U)) % 60U;
+  }
+  CLOCK_ShowSetTime();
+  CHIME_Play(CHIME_TICK);
+}
+
+/**
+  * @brief  Show the field being set alone.
+  * @note   The LCD blink mode blinks all the lit segments, so blanking the
+  *         other digits makes the edited ones blink.
+  * @param  None
+  * @retval None
+  */
+static void CLOCK_ShowSetTime(void)
+{
+  uint8_t str[] = "00:00:00";
+
+  if (ClockSetField == CLOCK_SET_HOURS)
+  {
+    sprintf((char *)str, "%.2d:  :  ", ClockSetHours);
+  }
+  else
+  {
+    sprintf((char *)str, "  :%.2d:  ", ClockSetMinutes);
+  }
+  DISPLAY_ShowString(str);
+}
+
+/**
+  * @brief  Format the last sample set: "  23.5C" then "  3.01V".
+  * @param  str: Receives the string, 8 characters at least
+  * @retval None
+  */
+static void CLOCK_FormatSense(uint8_t *str)
+{
+  SENSE_SnapshotTypeDef snapshot;
+  uint32_t value, pos;
+
+  if (SENSE_Read(&snapshot) == 0U)
+  {
+    sprintf((char *)str, "  ----");
+    return;
+  }
+
+  if ((((RTC_GetStamp() / RTC_STAMP_FREQ) / CLOCK_SENSE_SHOW_S) & 1U) != 0U)
+  {
+    value = snapshot.Vdda;
+    sprintf((char *)str, "%3d.%.2dV", (int)(value / 1000U), (int)((value % 1000U) / 10U));
+    return;
+  }
+
+  value = (snapshot.Temperature < 0) ? (uint32_t)(-snapshot.Temperature) : (uint32_t)snapshot.Temperature;
+  sprintf((char *)str, "%4d.%dC", (int)(value / 10U), (int)(value % 10U));
+  if (snapshot.Temperature < 0)
+  {
+    /* Sign just before the first digit */
+    for (pos = 0U; str[pos + 1U] == ' '; pos++)
+    {
+    }
+    str[pos] = '-';
+  }
+}
+
+#if defined(USE_CLOCK_LL)
+/**
+  * @brief  Render "HH:MM:SS" from BCD, without formatting a string.
+  * @note   Frozen timers show hundredths and are formatted as strings: they
+  *         are only rendered on a mode change.
+  * @param  None
+  * @retval Non zero if rendered, zero if the mode has to be formatted
+  */
+static uint32_t CLOCK_RefreshLL(void)
+{
+  DISPLAY_FrameTypeDef frame;
+  uint32_t hms;
+
+  switch (ClockMode)
+  {
+  case CLOCK_MODE_STOPWATCH:
+    if (CHRONO_StopwatchState() != CHRONO_RUNNING)
+    {
+      return 0U;
+    }
+    hms = CLOCK_LL_SecondsToBCD(CHRONO_StopwatchElapsed() / RTC_STAMP_FREQ);
+    break;
+
+  case CLOCK_MODE_COUNTDOWN:
+    if (CHRONO_CountdownState() != CHRONO_RUNNING)
+    {
+      return 0U;
+    }
+    /* Rounded up as in CLOCK_Refresh() */
+    hms = CLOCK_LL_SecondsToBCD((CHRONO_CountdownRemaining() + RTC_STAMP_FREQ - 1U) /
+                                RTC_STAMP_FREQ);
+    break;
+
+  case CLOCK_MODE_SENSE:
+    return 0U;
+
+  default:
+    hms = CLOCK_LL_GetTime();
+    break;
+  }
+
+  CLOCK_FrameBCD(&frame, hms);
+  DISPLAY_ShowFrame(&frame);
+  return 1U;
+}
+#endif /* USE_CLOCK_LL */
+
+/**
+  * @brief  Build a "HH:MM:SS" frame from BCD.
+  * @param  frame: Output frame
+  * @param  hms: Time in BCD, 0x00HHMMSS
+  * @retval None
+  */
+static void CLOCK_FrameBCD(DISPLAY_FrameTypeDef *frame, uint32_t hms)
+{
+  uint32_t pos;
+
+  /* One BCD digit per position, colons after the hours and the minutes */
+  for (pos = 0U; pos < DISPLAY_DIGITS; pos++)
+  {
+    frame->Char[pos] = (uint8_t)('0' + ((hms >> (20U - (4U * pos))) & 0x0FU));
+  }
+  frame->Colon = (uint8_t)(DISPLAY_CELL(1U) | DISPLAY_CELL(3U));
+  frame->Point = 0U;
+}
+
+/**
+  * @brief  Register the clock event handlers.
+  * @param  None
+  * @retval None
+  */
+void CLOCK_Init(void)
+{
+  ClockMode = CLOCK_MODE_TIME;
+  CHRONO_Init();
+
+  EVT_Register(EVT_RTC_WAKEUP, CLOCK_OnWakeUp);
+  EVT_Register(EVT_COUNTDOWN_EXPIRED, CLOCK_OnCountdownExpired);
+
+  BTN_Init(CLOCK_OnButton);
+#if defined(USE_TOUCH_SLIDER)
+  TOUCH_Init(CLOCK_OnTouch);
+#endif
+}
+
+/**
+  * @brief  Select what the display shows and refresh it.
+  * @param  Mode: Display mode
+  * @retval None
+  */
+void CLOCK_SetMode(CLOCK_ModeTypeDef Mode)
+{
+  ClockMode = Mode;
+  DISPLAY_Blink(DISPLAY_BLINK_OFF);
+  CLOCK_Refresh();
+}
+
+/**
+  * @brief  Current display mode.
+  * @param  None
+  * @retval Display mode
+  */
+CLOCK_ModeTypeDef CLOCK_GetMode(void)
+{
+  return ClockMode;
+}
+
+/**
+  * @brief  Time of day frame, as CLOCK_MODE_TIME shows it.
+  * @note   Read from the RTC registers: usable right after STANDBY,
+  *         before RTC_Init().
+  * @param  Frame: Output frame
+  * @retval None
+  */
+void CLOCK_TimeFrame(DISPLAY_FrameTypeDef *Frame)
+{
+  CLOCK_FrameBCD(Frame, CLOCK_LL_GetTime());
+}
+
+/**
+  * @brief  Render the current mode.
+  * @param  None
+  * @retval None
+  */
+void CLOCK_Refresh(void)
+{
+  uint8_t h, m, s;
+  uint8_t str[]= "00:00:00";
+  uint32_t remaining;
+
+#if defined(USE_CLOCK_LL)
+  if (CLOCK_RefreshLL() != 0U)
+  {
+    return;
+  }
+#endif
+
+  switch (ClockMode)
+  {
+  case CLOCK_MODE_STOPWATCH:
+    CHRONO_Format(str, CHRONO_StopwatchElapsed(),
+                  (CHRONO_StopwatchState() == CHRONO_RUNNING));
+    break;
+
+  case CLOCK_MODE_COUNTDOWN:
+    remaining = CHRONO_CountdownRemaining();
+    if (CHRONO_CountdownState() == CHRONO_RUNNING)
+    {
+      /* Whole seconds are shown: round up so that 00:00:00 means expired */
+      remaining += RTC_STAMP_FREQ - 1U;
+    }
+    CHRONO_Format(str, remaining, (CHRONO_CountdownState() == CHRONO_RUNNING));
+    break;
+
+  case CLOCK_MODE_SENSE:
+    CLOCK_FormatSense(str);
+    break;
+
+  default:
+    RTC_GetTime(&h, &m, &s);
+    sprintf((char *)str,"%.2d:%.2d:%.2d",h, m, s);
+    break;
+  }
+
+  DISPLAY_ShowString(str);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
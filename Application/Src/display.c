@@ -0,0 +1,351 @@
+/**
+  ******************************************************************************
+  * @file    display.c
+  * @author  MCD Application Team
+  * @brief   Display abstraction: the clock renders time frames, the backend
+  *          of the board only redraws the cells that changed.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The backend is chosen at build time: the segment glass of the
+        32L152CDISCOVERY (display_glass.c), or the ST7735 SPI TFT of the
+        Adafruit 1.8" shield on the NUCLEO-L152RE when USE_DISPLAY_TFT is
+        defined (display_tft.c, see main.h).
+    (#) DISPLAY_ShowFrame() and DISPLAY_ShowString() compare the new frame
+        with the one on the panel. Only the dirty cells, one per digit with
+        its separator and one for the battery bar, are passed to the
+        backend: a second tick usually redraws a single digit.
+    (#) DISPLAY_Blank() switches the panel off while nobody can see it.
+        The frame kept here goes on following the updates meanwhile, and
+        the cells that changed are redrawn as the panel is lit again.
+    (#) DISPLAY_Save() keeps the frame, the bar and the contrast in RTC
+        backup registers before STANDBY. After the wake-up, the frame got
+        with DISPLAY_GetSaved() and brought up to date is passed to
+        DISPLAY_Resume(), first thing after HAL_Init(): the backend shows
+        it without the full panel initialization, and DISPLAY_Init() then
+        leaves the panel as it is.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "display.h"
+#include "rtc.h"
+#include "watchdog.h"
+#if defined(USE_DISPLAY_TFT)
+#include "display_tft.h"
+#else
+#include "display_glass.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if defined(USE_DISPLAY_TFT)
+#define DISPLAY_DRV             TftDisplayDrv
+#else
+#define DISPLAY_DRV             GlassDisplayDrv
+#endif
+
+/* Contrast set by the backend initialization, LCD_CONTRASTLEVEL_5 */
+#define DISPLAY_CONTRAST_INIT   5U
+
+/* RTC_BKP_DISPLAY + 2: bar in the low byte, contrast above */
+#define DISPLAY_SAVED_BAR       0xFFU
+#define DISPLAY_SAVED_CONTRAST_SHIFT 8U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static DISPLAY_FrameTypeDef DisplayFrame;  /* Frame on the panel            */
+static uint32_t DisplayBar;
+static uint32_t DisplayStale;              /* Cells to redraw in any case   */
+static DISPLAY_BlinkTypeDef DisplayBlink;
+static uint32_t DisplayBlanked;
+static uint32_t DisplayContrast;
+static uint32_t DisplayResumed;            /* Panel set up by DISPLAY_Resume */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the backend of the board.
+  * @note   After DISPLAY_Resume(), the panel and the frame are kept.
+  * @param  None
+  * @retval None
+  */
+void DISPLAY_Init(void)
+{
+  uint32_t pos;
+
+  DisplayBlink = DISPLAY_BLINK_OFF;
+  DisplayBlanked = 0U;
+  if (DisplayResumed != 0U)
+  {
+    DisplayResumed = 0U;
+    return;
+  }
+
+  for (pos = 0U; pos < DISPLAY_DIGITS; pos++)
+  {
+    DisplayFrame.Char[pos] = ' ';
+  }
+  DisplayFrame.Colon = 0U;
+  DisplayFrame.Point = 0U;
+  DisplayBar = DISPLAY_BAR_OFF;
+  DisplayStale = DISPLAY_CELL_ALL;
+  DisplayContrast = DISPLAY_CONTRAST_INIT;
+
+  DISPLAY_DRV.Init();
+}
+
+/**
+  * @brief  Show a time frame, redrawing the cells that changed.
+  * @param  Frame: Frame to show
+  * @retval None
+  */
+void DISPLAY_ShowFrame(const DISPLAY_FrameTypeDef *Frame)
+{
+  uint32_t pos;
+  uint32_t dirty = DisplayStale & ~DISPLAY_CELL_BAR;
+  uint32_t marks = (uint32_t)(Frame->Colon ^ DisplayFrame.Colon) |
+                   (uint32_t)(Frame->Point ^ DisplayFrame.Point);
+
+  for (pos = 0U; pos < DISPLAY_DIGITS; pos++)
+  {
+    if (Frame->Char[pos] != DisplayFrame.Char[pos])
+    {
+      dirty |= DISPLAY_CELL(pos);
+    }
+  }
+  dirty |= marks & (DISPLAY_CELL_ALL & ~DISPLAY_CELL_BAR);
+
+  if (dirty == 0U)
+  {
+    return;
+  }
+
+  DisplayFrame = *Frame;
+  if (DisplayBlanked != 0U)
+  {
+    DisplayStale |= dirty;
+    return;
+  }
+  DisplayStale = 0U;
+  WDG_STAGE(WDG_STAGE_DISPLAY);
+  DISPLAY_DRV.Render(&DisplayFrame, DisplayBar, dirty);
+}
+
+/**
+  * @brief  Show a string such as "12:34:56" or "05:12.40".
+  * @note   As BSP_LCD_GLASS_DisplayString(): ':' and '.' do not take a
+  *         digit, they mark the digit before them.
+  * @param  str: Null terminated string
+  * @retval None
+  */
+void DISPLAY_ShowString(const uint8_t *str)
+{
+  DISPLAY_FrameTypeDef frame;
+  uint32_t pos = 0U;
+
+  frame.Colon = 0U;
+  frame.Point = 0U;
+
+  for (; (*str != 0U) && (pos <= DISPLAY_DIGITS); str++)
+  {
+    if ((*str == ':') && (pos != 0U))
+    {
+      frame.Colon |= (uint8_t)DISPLAY_CELL(pos - 1U);
+    }
+    else if ((*str == '.') && (pos != 0U))
+    {
+      frame.Point |= (uint8_t)DISPLAY_CELL(pos - 1U);
+    }
+    else if (pos < DISPLAY_DIGITS)
+    {
+      frame.Char[pos++] = *str;
+    }
+    else
+    {
+      break;
+    }
+  }
+  for (; pos < DISPLAY_DIGITS; pos++)
+  {
+    frame.Char[pos] = ' ';
+  }
+
+  DISPLAY_ShowFrame(&frame);
+}
+
+/**
+  * @brief  Show the battery level.
+  * @param  Bar: DISPLAY_BAR_xxx
+  * @retval None
+  */
+void DISPLAY_SetBar(uint32_t Bar)
+{
+  if (Bar == DisplayBar)
+  {
+    return;
+  }
+  DisplayBar = Bar;
+  if (DisplayBlanked != 0U)
+  {
+    DisplayStale |= DISPLAY_CELL_BAR;
+    return;
+  }
+  DISPLAY_DRV.Render(&DisplayFrame, DisplayBar, DISPLAY_CELL_BAR);
+}
+
+/**
+  * @brief  Blink the digits.
+  * @note   A backend without hardware blinking highlights the digits
+  *         instead, so the digits are redrawn.
+  * @param  Blink: Blinking mode
+  * @retval None
+  */
+void DISPLAY_Blink(DISPLAY_BlinkTypeDef Blink)
+{
+  if (Blink == DisplayBlink)
+  {
+    return;
+  }
+  DisplayBlink = Blink;
+  DISPLAY_DRV.Blink(Blink);
+  if (DisplayBlanked != 0U)
+  {
+    DisplayStale |= DISPLAY_CELL_ALL & ~DISPLAY_CELL_BAR;
+    return;
+  }
+  DISPLAY_DRV.Render(&DisplayFrame, DisplayBar, DISPLAY_CELL_ALL & ~DISPLAY_CELL_BAR);
+}
+
+/**
+  * @brief  Set the contrast, on the panels that have one.
+  * @param  Level: 0 to DISPLAY_CONTRAST_MAX
+  * @retval None
+  */
+void DISPLAY_Contrast(uint32_t Level)
+{
+  DisplayContrast = (Level > DISPLAY_CONTRAST_MAX) ? DISPLAY_CONTRAST_MAX : Level;
+  DISPLAY_DRV.Contrast(DisplayContrast);
+}
+
+/**
+  * @brief  Blank the panel before STANDBY.
+  * @note   Called from the PVD interrupt. The glass backend writes LCD_CR;
+  *         the TFT backend polls two SPI commands (see POWER_Shutdown()).
+  * @param  None
+  * @retval None
+  */
+void DISPLAY_Off(void)
+{
+  DISPLAY_DRV.Off();
+}
+
+/**
+  * @brief  Blank the panel, or light it again with the current frame.
+  * @param  State: ENABLE to blank, DISABLE to light
+  * @retval None
+  */
+void DISPLAY_Blank(FunctionalState State)
+{
+  if ((State != DISABLE) == (DisplayBlanked != 0U))
+  {
+    return;
+  }
+
+  if (State != DISABLE)
+  {
+    DisplayBlanked = 1U;
+    DISPLAY_DRV.Off();
+    return;
+  }
+
+  DisplayBlanked = 0U;
+  DISPLAY_DRV.On();
+  if (DisplayStale != 0U)
+  {
+    DISPLAY_DRV.Render(&DisplayFrame, DisplayBar, DisplayStale);
+    DisplayStale = 0U;
+  }
+}
+
+/**
+  * @brief  Keep the frame, the bar and the contrast across STANDBY.
+  * @param  None
+  * @retval None
+  */
+void DISPLAY_Save(void)
+{
+  const uint8_t *ch = DisplayFrame.Char;
+
+  RTC_BackupWrite(RTC_BKP_DISPLAY, (uint32_t)ch[0] | ((uint32_t)ch[1] << 8U) |
+                                   ((uint32_t)ch[2] << 16U) | ((uint32_t)ch[3] << 24U));
+  RTC_BackupWrite(RTC_BKP_DISPLAY + 1U, (uint32_t)ch[4] | ((uint32_t)ch[5] << 8U) |
+                                        ((uint32_t)DisplayFrame.Colon << 16U) |
+                                        ((uint32_t)DisplayFrame.Point << 24U));
+  RTC_BackupWrite(RTC_BKP_DISPLAY + 2U, DisplayBar |
+                                        (DisplayContrast << DISPLAY_SAVED_CONTRAST_SHIFT));
+}
+
+/**
+  * @brief  Frame kept by DISPLAY_Save().
+  * @param  Frame: Output frame
+  * @retval None
+  */
+void DISPLAY_GetSaved(DISPLAY_FrameTypeDef *Frame)
+{
+  uint32_t lo = RTC_BackupRead(RTC_BKP_DISPLAY);
+  uint32_t hi = RTC_BackupRead(RTC_BKP_DISPLAY + 1U);
+
+  Frame->Char[0] = (uint8_t)lo;
+  Frame->Char[1] = (uint8_t)(lo >> 8U);
+  Frame->Char[2] = (uint8_t)(lo >> 16U);
+  Frame->Char[3] = (uint8_t)(lo >> 24U);
+  Frame->Char[4] = (uint8_t)hi;
+  Frame->Char[5] = (uint8_t)(hi >> 8U);
+  Frame->Colon = (uint8_t)(hi >> 16U);
+  Frame->Point = (uint8_t)(hi >> 24U);
+}
+
+/**
+  * @brief  Show a frame on the panel after STANDBY, with the saved bar and
+  *         contrast.
+  * @note   To be called before DISPLAY_Init(), on the MSI clock.
+  * @param  Frame: Frame to show
+  * @retval None
+  */
+void DISPLAY_Resume(const DISPLAY_FrameTypeDef *Frame)
+{
+  uint32_t saved = RTC_BackupRead(RTC_BKP_DISPLAY + 2U);
+
+  DisplayFrame = *Frame;
+  DisplayBar = saved & DISPLAY_SAVED_BAR;
+  DisplayContrast = saved >> DISPLAY_SAVED_CONTRAST_SHIFT;
+  if (DisplayContrast > DISPLAY_CONTRAST_MAX)
+  {
+    DisplayContrast = DISPLAY_CONTRAST_MAX;
+  }
+  DisplayStale = 0U;
+  DisplayResumed = 1U;
+
+  DISPLAY_DRV.Resume(&DisplayFrame, DisplayBar, DisplayContrast);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
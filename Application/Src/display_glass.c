@@ -0,0 +1,342 @@
+/**
+  ******************************************************************************
+  * @file    display_glass.c
+  * @author  MCD Application Team
+  * @brief   Display backend for the segment glass LCD of the
+  *          32L152CDISCOVERY, on top of the BSP glass driver.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Each dirty digit is written with BSP_LCD_GLASS_WriteChar(), which
+        also restores the battery bar sharing segments with digits 5 and 6.
+    (#) In the USE_CLOCK_LL build, frames of digits and blanks are written
+        to the LCD RAM at once through glass_ll.h, without waiting for the
+        display update: the BSP only draws the other characters.
+    (#) Blinking and contrast are done by the LCD controller.
+    (#) After STANDBY, GLASS_Resume() sets the LCD controller up at register
+        level with the settings of BSP_LCD_GLASS_Init(): the LSE and the RTC
+        clock selection are still running, and the LCD RAM is written with
+        the frame instead of being cleared. Neither the VLCD capacitor nor
+        the booster ready flag are waited for: the contrast settles during
+        the first frames. The controller is enabled with
+        the update already requested, so the first frame driven is the
+        right one.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "display_glass.h"
+#include "glass_ll.h"
+
+#if !defined(USE_DISPLAY_TFT)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+extern LCD_HandleTypeDef LCDHandle;
+
+/* Private function prototypes -----------------------------------------------*/
+static void GLASS_Init(void);
+static void GLASS_Render(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t DirtyCells);
+static void GLASS_Blink(DISPLAY_BlinkTypeDef Blink);
+static void GLASS_Contrast(uint32_t Level);
+static void GLASS_Off(void);
+static void GLASS_On(void);
+static void GLASS_Resume(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t Contrast);
+static uint32_t GLASS_BuildLL(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar,
+                              GLASS_LL_FrameTypeDef *Image);
+#if defined(USE_CLOCK_LL)
+static uint32_t GLASS_RenderLL(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar);
+#endif
+
+DISPLAY_DrvTypeDef GlassDisplayDrv =
+{
+  GLASS_Init,
+  GLASS_Render,
+  GLASS_Blink,
+  GLASS_Contrast,
+  GLASS_Off,
+  GLASS_On,
+  GLASS_Resume,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the glass.
+  * @param  None
+  * @retval None
+  */
+static void GLASS_Init(void)
+{
+  BSP_LCD_GLASS_Init();
+
+  /* Sleep rather than spin while a frame is transferred to the glass: the
+     interrupt stays disabled in the NVIC and only ends HAL_WaitFlagEvent() */
+  __HAL_LCD_ENABLE_IT(&LCDHandle, LCD_IT_UDD);
+}
+
+/**
+  * @brief  Build the LCD RAM image of a frame through glass_ll.h.
+  * @param  Frame: Frame to draw
+  * @param  Bar: Battery level
+  * @param  Image: Output image
+  * @retval Non zero if built, zero if the frame has other characters than
+  *         digits and blanks
+  */
+static uint32_t GLASS_BuildLL(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar,
+                              GLASS_LL_FrameTypeDef *Image)
+{
+  uint32_t pos, ch;
+
+  for (pos = 0U; pos < COM_PER_DIGIT_NB; pos++)
+  {
+    Image->Com[pos] = 0U;
+  }
+
+  for (pos = 0U; pos < DISPLAY_DIGITS; pos++)
+  {
+    if ((Frame->Char[pos] >= '0') && (Frame->Char[pos] <= '9'))
+    {
+      ch = NumberMap[Frame->Char[pos] - '0'];
+    }
+    else if (Frame->Char[pos] == ' ')
+    {
+      ch = 0U;
+    }
+    else
+    {
+      return 0U;
+    }
+    if ((Frame->Colon & DISPLAY_CELL(pos)) != 0U)
+    {
+      ch |= GLASS_LL_COLON;
+    }
+    if ((Frame->Point & DISPLAY_CELL(pos)) != 0U)
+    {
+      ch |= GLASS_LL_POINT;
+    }
+    GLASS_LL_PutChar(Image, LCD_DIGIT_POSITION_1 + pos, ch);
+  }
+  GLASS_LL_PutBar(Image, Bar);
+  return 1U;
+}
+
+#if defined(USE_CLOCK_LL)
+/**
+  * @brief  Write a whole frame to the LCD RAM through glass_ll.h.
+  * @param  Frame: Frame to draw
+  * @param  Bar: Battery level
+  * @retval Non zero if written, zero if the BSP has to draw the frame
+  */
+static uint32_t GLASS_RenderLL(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar)
+{
+  GLASS_LL_FrameTypeDef image;
+
+  if ((GLASS_BuildLL(Frame, Bar, &image) == 0U) || (GLASS_LL_WriteFrame(&image) == 0U))
+  {
+    return 0U;
+  }
+  /* Keep the BSP bar level in step for its next character writes */
+  LCDBar = (uint8_t)Bar;
+  return 1U;
+}
+#endif /* USE_CLOCK_LL */
+
+/**
+  * @brief  Draw the dirty digits and the battery bar.
+  * @param  Frame: Frame to draw
+  * @param  Bar: DISPLAY_BAR_xxx, same values as BATTERYLEVEL_xxx
+  * @param  DirtyCells: DISPLAY_CELL() bits to draw
+  * @retval None
+  */
+static void GLASS_Render(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t DirtyCells)
+{
+  uint32_t pos;
+  uint8_t ch;
+
+#if defined(USE_CLOCK_LL)
+  if (GLASS_RenderLL(Frame, Bar) != 0U)
+  {
+    return;
+  }
+#endif
+
+  if ((DirtyCells & DISPLAY_CELL_BAR) != 0U)
+  {
+    BSP_LCD_GLASS_BarLevelConfig((uint8_t)Bar);
+  }
+
+  for (pos = 0U; pos < DISPLAY_DIGITS; pos++)
+  {
+    if ((DirtyCells & DISPLAY_CELL(pos)) != 0U)
+    {
+      ch = Frame->Char[pos];
+      BSP_LCD_GLASS_WriteChar(&ch,
+                              ((Frame->Point & DISPLAY_CELL(pos)) != 0U) ? POINT_ON : POINT_OFF,
+                              ((Frame->Colon & DISPLAY_CELL(pos)) != 0U) ? DOUBLEPOINT_ON : DOUBLEPOINT_OFF,
+                              LCD_DIGIT_POSITION_1 + pos);
+    }
+  }
+}
+
+/**
+  * @brief  Blink all the lit segments.
+  * @param  Blink: Blinking mode
+  * @retval None
+  */
+static void GLASS_Blink(DISPLAY_BlinkTypeDef Blink)
+{
+  switch (Blink)
+  {
+  case DISPLAY_BLINK_SLOW:
+    BSP_LCD_GLASS_BlinkConfig(LCD_BLINKMODE_ALLSEG_ALLCOM, LCD_BLINKFREQUENCY_DIV512);
+    break;
+  case DISPLAY_BLINK_FAST:
+    BSP_LCD_GLASS_BlinkConfig(LCD_BLINKMODE_ALLSEG_ALLCOM, LCD_BLINKFREQUENCY_DIV256);
+    break;
+  default:
+    BSP_LCD_GLASS_BlinkConfig(LCD_BLINKMODE_OFF, LCD_BLINKFREQUENCY_DIV512);
+    break;
+  }
+}
+
+/**
+  * @brief  Set the glass contrast.
+  * @param  Level: 0 to DISPLAY_CONTRAST_MAX, as the LCD_FCR CC field
+  * @retval None
+  */
+static void GLASS_Contrast(uint32_t Level)
+{
+  BSP_LCD_GLASS_Contrast(Level << LCD_FCR_CC_Pos);
+}
+
+/**
+  * @brief  Disable the LCD: no more bias current through the segments.
+  * @param  None
+  * @retval None
+  */
+static void GLASS_Off(void)
+{
+  CLEAR_BIT(LCD->CR, LCD_CR_LCDEN);
+}
+
+/**
+  * @brief  Enable the LCD again: the LCD RAM kept the frame.
+  * @param  None
+  * @retval None
+  */
+static void GLASS_On(void)
+{
+  SET_BIT(LCD->CR, LCD_CR_LCDEN);
+  while ((LCD->SR & LCD_SR_ENS) == 0U)
+  {
+  }
+}
+
+/**
+  * @brief  Set the glass up after STANDBY, the frame shown from the first
+  *         LCD frame on.
+  * @note   The LCD controller was reset with the rest of the part. Its
+  *         handle is left as BSP_LCD_GLASS_Init() leaves it, for the BSP
+  *         calls that follow.
+  * @param  Frame: Frame to show
+  * @param  Bar: Battery level
+  * @param  Contrast: 0 to DISPLAY_CONTRAST_MAX
+  * @retval None
+  */
+static void GLASS_Resume(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t Contrast)
+{
+  GPIO_InitTypeDef gpioinitstruct = {0};
+  GLASS_LL_FrameTypeDef image;
+  uint32_t built;
+
+  LCDHandle.Instance              = LCD;
+  LCDHandle.Init.Prescaler        = LCD_PRESCALER_1;
+  LCDHandle.Init.Divider          = LCD_DIVIDER_31;
+  LCDHandle.Init.Duty             = LCD_DUTY_1_4;
+  LCDHandle.Init.Bias             = LCD_BIAS_1_3;
+  LCDHandle.Init.VoltageSource    = LCD_VOLTAGESOURCE_INTERNAL;
+  LCDHandle.Init.Contrast         = Contrast << LCD_FCR_CC_Pos;
+  LCDHandle.Init.DeadTime         = LCD_DEADTIME_0;
+  LCDHandle.Init.PulseOnDuration  = LCD_PULSEONDURATION_4;
+  LCDHandle.Init.BlinkMode        = LCD_BLINKMODE_OFF;
+  LCDHandle.Init.BlinkFrequency   = LCD_BLINKFREQUENCY_DIV32;
+  LCDHandle.Init.MuxSegment       = LCD_MUXSEGMENT_ENABLE;
+
+  /* Pins and LCD clock, as LCD_MspInit() */
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  gpioinitstruct.Mode       = GPIO_MODE_AF_PP;
+  gpioinitstruct.Pull       = GPIO_NOPULL;
+  gpioinitstruct.Speed      = GPIO_SPEED_FREQ_VERY_HIGH;
+  gpioinitstruct.Alternate  = GPIO_AF11_LCD;
+  gpioinitstruct.Pin        = LCD_GPIO_BANKA_PINS;
+  HAL_GPIO_Init(GPIOA, &gpioinitstruct);
+  gpioinitstruct.Pin        = LCD_GPIO_BANKB_PINS;
+  HAL_GPIO_Init(GPIOB, &gpioinitstruct);
+  gpioinitstruct.Pin        = LCD_GPIO_BANKC_PINS;
+  HAL_GPIO_Init(GPIOC, &gpioinitstruct);
+  __HAL_RCC_LCD_CLK_ENABLE();
+
+  /* The frame takes the place of the LCD RAM clearing of HAL_LCD_Init():
+     the update requested now is done as the controller is enabled */
+  built = GLASS_BuildLL(Frame, Bar, &image);
+  if (built != 0U)
+  {
+    (void)GLASS_LL_WriteFrame(&image);
+  }
+
+  /* Then the registers in the order of HAL_LCD_Init() */
+  MODIFY_REG(LCD->FCR,
+             (LCD_FCR_PS | LCD_FCR_DIV | LCD_FCR_BLINK | LCD_FCR_BLINKF |
+              LCD_FCR_DEAD | LCD_FCR_PON | LCD_FCR_CC),
+             (LCDHandle.Init.Prescaler | LCDHandle.Init.Divider | LCDHandle.Init.BlinkMode |
+              LCDHandle.Init.BlinkFrequency | LCDHandle.Init.DeadTime |
+              LCDHandle.Init.PulseOnDuration | LCDHandle.Init.Contrast));
+  while ((LCD->SR & LCD_SR_FCRSR) == 0U)
+  {
+  }
+  MODIFY_REG(LCD->CR, (LCD_CR_DUTY | LCD_CR_BIAS | LCD_CR_VSEL | LCD_CR_MUX_SEG),
+             (LCDHandle.Init.Duty | LCDHandle.Init.Bias | LCDHandle.Init.VoltageSource |
+              LCDHandle.Init.MuxSegment));
+  GLASS_On();
+
+  LCDHandle.Lock = HAL_UNLOCKED;
+  LCDHandle.ErrorCode = HAL_LCD_ERROR_NONE;
+  LCDHandle.State = HAL_LCD_STATE_READY;
+  __HAL_LCD_ENABLE_IT(&LCDHandle, LCD_IT_UDD);
+
+  /* Other characters than digits: drawn by the BSP, one update each */
+  if (built == 0U)
+  {
+    GLASS_Render(Frame, Bar, DISPLAY_CELL_ALL);
+  }
+  else
+  {
+    LCDBar = (uint8_t)Bar;
+  }
+}
+
+#endif /* !USE_DISPLAY_TFT */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,720 @@
+/**
+  ******************************************************************************
+  * @file    display_tft.c
+  * @author  MCD Application Team
+  * @brief   Display backend for the ST7735 1.8" TFT of the Adafruit shield
+  *          on the NUCLEO-L152RE: digit sprites streamed from flash over
+  *          SPI1 with DMA, one window per repaint.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The panel is driven directly on SPI1 (PA5 SCK, PA7 MOSI, AF5) with
+        its chip select on PB6 and its data/command line on PA9, as wired by
+        the shield. The panel reset is the board reset.
+    (#) The clock face is seen in landscape, 160 x 128 pixels in RGB565,
+        but the panel keeps its portrait scan: each panel row is a column
+        of the face, so the RAM is filled column after column. The digit
+        sprites of display_tft_sprites.c are stored in that order, so the
+        digits of a window follow each other in the pixel stream.
+    (#) A repaint sets one window over the dirty digits, from the first to
+        the last, then queues the digit and separator sprites. The DMA
+        interrupt starts each queued chunk as soon as the previous one is
+        sent, straight from flash, and the CPU sleeps until the queue is
+        empty. The SPI clock is half the APB2 clock: 16 MHz on the PLL
+        after reset, but only 1 MHz on the 2.1 MHz MSI, the system clock
+        after the first STOP mode (EVT_Sleep()). A repaint then runs the
+        core on the 16 MHz HSI (POWER_ClockHSI()), for an 8 MHz SPI clock:
+        16 MHz would need the PLL, 32 MHz and the voltage range 1. HH:MM:SS
+        is 9216 bytes: 9.2 ms at 8 MHz, about 9.5 ms with the polled
+        window commands, against 71 ms on the MSI. The core mostly sleeps
+        on WFI meanwhile: about 1 mA in SLEEP on the HSI against 0.2 mA on
+        the MSI, for an eighth of the time, so some two thirds of the
+        charge (datasheet figures), and STOP mode 60 ms sooner. The SPI is
+        the bound: a cell is tinted in less time than it takes to send.
+        The repaints are in PROF_CLOCK_REFRESH, in core cycles, mostly of
+        the HSI.
+    (#) The panel has no blinking: the digits being set are drawn in
+        another color. The sprites are then tinted into two RAM cell
+        buffers, one being drawn while the other is sent.
+    (#) The backlight is wired to 3.3 V: there is no contrast.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "display_tft.h"
+#include "power.h"
+
+#if defined(USE_DISPLAY_TFT)
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Chunk of a window, sent by one DMA transfer
+  */
+typedef struct
+{
+  const uint8_t *Data;
+  uint16_t       Size;          /*!< In bytes                               */
+} TFT_ChunkTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Pins of the Adafruit 1.8" shield */
+#define TFT_SPI                         SPI1
+#define TFT_SPI_CLK_ENABLE()            __HAL_RCC_SPI1_CLK_ENABLE()
+#define TFT_SPI_GPIO_PORT               GPIOA
+#define TFT_SPI_SCK_PIN                 GPIO_PIN_5
+#define TFT_SPI_MOSI_PIN                GPIO_PIN_7
+#define TFT_SPI_AF                      GPIO_AF5_SPI1
+#define TFT_CS_GPIO_PORT                GPIOB
+#define TFT_CS_PIN                      GPIO_PIN_6
+#define TFT_DC_GPIO_PORT                GPIOA
+#define TFT_DC_PIN                      GPIO_PIN_9
+
+/* SPI1_TX request */
+#define TFT_DMA_CHANNEL                 DMA1_Channel3
+#define TFT_DMA_IRQn                    DMA1_Channel3_IRQn
+#define TFT_DMA_IRQHandler              DMA1_Channel3_IRQHandler
+
+/* ST7735 commands */
+#define ST7735_SWRESET                  0x01U
+#define ST7735_SLPIN                    0x10U
+#define ST7735_SLPOUT                   0x11U
+#define ST7735_NORON                    0x13U
+#define ST7735_INVOFF                   0x20U
+#define ST7735_DISPOFF                  0x28U
+#define ST7735_DISPON                   0x29U
+#define ST7735_CASET                    0x2AU
+#define ST7735_RASET                    0x2BU
+#define ST7735_RAMWR                    0x2CU
+#define ST7735_MADCTL                   0x36U
+#define ST7735_COLMOD                   0x3AU
+#define ST7735_FRMCTR1                  0xB1U
+#define ST7735_FRMCTR2                  0xB2U
+#define ST7735_FRMCTR3                  0xB3U
+#define ST7735_INVCTR                   0xB4U
+#define ST7735_PWCTR1                   0xC0U
+#define ST7735_PWCTR2                   0xC1U
+#define ST7735_PWCTR3                   0xC2U
+#define ST7735_PWCTR4                   0xC3U
+#define ST7735_PWCTR5                   0xC4U
+#define ST7735_VMCTR1                   0xC5U
+
+/* Portrait scan, columns mirrored so that the face is upright in landscape,
+   BGR panel */
+#define ST7735_MADCTL_COLUMNS           0x48U
+/* 16 bits per pixel */
+#define ST7735_COLMOD_RGB565            0x05U
+/* Delay flag in the init table */
+#define TFT_DELAY                       0x80U
+/* Wait after ST7735_SLPOUT before the next command */
+#define TFT_SLPOUT_DELAY_MS             120U
+
+/* Clock face, in landscape */
+#define TFT_WIDTH                       160U
+#define TFT_HEIGHT                      128U
+
+/* Digit cells, centered, and the bar cell in the top right corner */
+#define TFT_CELL_WIDTH                  (TFT_SPRITE_DIGIT_WIDTH + TFT_SPRITE_SEP_WIDTH)
+#define TFT_CELL_HEIGHT                 TFT_SPRITE_HEIGHT
+#define TFT_CELL_PIXELS                 (TFT_CELL_WIDTH * TFT_CELL_HEIGHT)
+#define TFT_CELL_X                      ((TFT_WIDTH - (DISPLAY_DIGITS * TFT_CELL_WIDTH)) / 2U)
+#define TFT_CELL_Y                      ((TFT_HEIGHT - TFT_CELL_HEIGHT) / 2U)
+/* Columns of the face cleared by one chunk of a cell buffer */
+#define TFT_CLEAR_COLUMNS               4U
+
+#define TFT_BAR_WIDTH                   6U
+#define TFT_BAR_HEIGHT                  12U
+#define TFT_BAR_STEP                    8U
+#define TFT_BAR_CELL_WIDTH              (4U * TFT_BAR_STEP)
+#define TFT_BAR_X                       (TFT_WIDTH - TFT_BAR_CELL_WIDTH - 4U)
+#define TFT_BAR_Y                       8U
+
+/* Colors, RGB565. The sprites are TFT_COLOR_DIGIT on TFT_COLOR_BACK */
+#define TFT_COLOR_BACK                  0x0000U
+#define TFT_COLOR_DIGIT                 0xFFFFU
+#define TFT_COLOR_SLOW                  0xF800U
+#define TFT_COLOR_FAST                  0xFFE0U
+#define TFT_COLOR_BAR_OFF               0x2104U
+#define TFT_COLOR_BAR_ON                0x07E0U
+
+/* Chunks queued ahead of the DMA: a whole HH:MM:SS window fits */
+#define TFT_QUEUE_SIZE                  16U
+
+#define TFT_TIMEOUT                     10U
+
+/* Private macro -------------------------------------------------------------*/
+/* The SPI sends the low address byte first: the panel wants the MSB first */
+#define TFT_PIXEL(__COLOR__)            ((uint16_t)(((__COLOR__) >> 8U) | ((__COLOR__) << 8U)))
+
+#define TFT_CS_LOW()                    HAL_GPIO_WritePin(TFT_CS_GPIO_PORT, TFT_CS_PIN, GPIO_PIN_RESET)
+#define TFT_CS_HIGH()                   HAL_GPIO_WritePin(TFT_CS_GPIO_PORT, TFT_CS_PIN, GPIO_PIN_SET)
+#define TFT_DC_COMMAND()                HAL_GPIO_WritePin(TFT_DC_GPIO_PORT, TFT_DC_PIN, GPIO_PIN_RESET)
+#define TFT_DC_DATA()                   HAL_GPIO_WritePin(TFT_DC_GPIO_PORT, TFT_DC_PIN, GPIO_PIN_SET)
+
+/* Private variables ---------------------------------------------------------*/
+static SPI_HandleTypeDef TftSpiHandle;
+static DMA_HandleTypeDef TftDmaHandle;
+static uint16_t TftDigitColor = TFT_COLOR_DIGIT;
+
+/* Chunks of the current window. Head and tail only grow: the chunk of
+   count n is in TftQueue[n % TFT_QUEUE_SIZE] and is sent once head > n */
+static TFT_ChunkTypeDef TftQueue[TFT_QUEUE_SIZE];
+static volatile uint32_t TftQueueHead;   /* Chunks sent, DMA interrupt     */
+static volatile uint32_t TftQueueTail;   /* Chunks queued                  */
+static volatile uint32_t TftBusy;        /* A chunk is on the DMA          */
+
+/* Cell buffers for tinted digits and the bar, column after column */
+static uint16_t TftCell[2][TFT_CELL_PIXELS];
+static uint32_t TftCellUntil[2];         /* Tail after its last chunk      */
+static uint32_t TftCellNext;
+
+/* Init sequence: command, argument count (| TFT_DELAY), arguments, delay */
+static const uint8_t TftInitTable[] =
+{
+  ST7735_SWRESET, TFT_DELAY, 150U,
+  ST7735_SLPOUT,  TFT_DELAY, 255U,
+  ST7735_FRMCTR1, 3U, 0x01U, 0x2CU, 0x2DU,
+  ST7735_FRMCTR2, 3U, 0x01U, 0x2CU, 0x2DU,
+  ST7735_FRMCTR3, 6U, 0x01U, 0x2CU, 0x2DU, 0x01U, 0x2CU, 0x2DU,
+  ST7735_INVCTR,  1U, 0x07U,
+  ST7735_PWCTR1,  3U, 0xA2U, 0x02U, 0x84U,
+  ST7735_PWCTR2,  1U, 0xC5U,
+  ST7735_PWCTR3,  2U, 0x0AU, 0x00U,
+  ST7735_PWCTR4,  2U, 0x8AU, 0x2AU,
+  ST7735_PWCTR5,  2U, 0x8AU, 0xEEU,
+  ST7735_VMCTR1,  1U, 0x0EU,
+  ST7735_INVOFF,  0U,
+  ST7735_MADCTL,  1U, ST7735_MADCTL_COLUMNS,
+  ST7735_COLMOD,  1U, ST7735_COLMOD_RGB565,
+  ST7735_NORON,   TFT_DELAY, 10U,
+  ST7735_DISPON,  TFT_DELAY, 100U,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void TFT_Init(void);
+static void TFT_Render(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t DirtyCells);
+static void TFT_Blink(DISPLAY_BlinkTypeDef Blink);
+static void TFT_Contrast(uint32_t Level);
+static void TFT_Off(void);
+static void TFT_On(void);
+static void TFT_Resume(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t Contrast);
+static void TFT_WriteCommand(uint8_t Command, const uint8_t *Args, uint32_t Count);
+static void TFT_Window(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+static void TFT_Push(const void *Data, uint32_t Size);
+static void TFT_WaitQueue(uint32_t Count);
+static void TFT_Flush(void);
+static uint16_t *TFT_GetCell(void);
+static void TFT_PushCell(uint16_t *Cell, uint32_t Pixels);
+static void TFT_Tint(uint16_t *Dest, const uint16_t *Sprite, uint32_t Pixels, uint16_t Color);
+static void TFT_Fill(uint16_t *Cell, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height,
+                     uint32_t Rows, uint16_t Pixel);
+static void TFT_PushDigit(const DISPLAY_FrameTypeDef *Frame, uint32_t Pos);
+
+DISPLAY_DrvTypeDef TftDisplayDrv =
+{
+  TFT_Init,
+  TFT_Render,
+  TFT_Blink,
+  TFT_Contrast,
+  TFT_Off,
+  TFT_On,
+  TFT_Resume,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Send a command and its arguments, by polling.
+  * @param  Command: ST7735 command
+  * @param  Args: Arguments, or NULL
+  * @param  Count: Number of arguments
+  * @retval None
+  */
+static void TFT_WriteCommand(uint8_t Command, const uint8_t *Args, uint32_t Count)
+{
+  TFT_CS_LOW();
+  TFT_DC_COMMAND();
+  HAL_SPI_Transmit(&TftSpiHandle, &Command, 1U, TFT_TIMEOUT);
+  if (Count != 0U)
+  {
+    TFT_DC_DATA();
+    HAL_SPI_Transmit(&TftSpiHandle, (uint8_t *)Args, (uint16_t)Count, TFT_TIMEOUT);
+  }
+  TFT_CS_HIGH();
+}
+
+/**
+  * @brief  Open a window of the face for the chunks that follow.
+  * @note   The queue must be empty. The panel stays selected until
+  *         TFT_Flush().
+  * @param  X: Left column of the face
+  * @param  Y: Top row of the face
+  * @param  Width: Width in pixels
+  * @param  Height: Height in pixels
+  * @retval None
+  */
+static void TFT_Window(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+  /* Face rows are panel columns, face columns are panel rows */
+  uint8_t caset[4] = {0U, (uint8_t)Y, 0U, (uint8_t)(Y + Height - 1U)};
+  uint8_t raset[4] = {0U, (uint8_t)X, 0U, (uint8_t)(X + Width - 1U)};
+  uint8_t ramwr = ST7735_RAMWR;
+
+  TFT_WriteCommand(ST7735_CASET, caset, sizeof(caset));
+  TFT_WriteCommand(ST7735_RASET, raset, sizeof(raset));
+
+  TFT_CS_LOW();
+  TFT_DC_COMMAND();
+  HAL_SPI_Transmit(&TftSpiHandle, &ramwr, 1U, TFT_TIMEOUT);
+  TFT_DC_DATA();
+}
+
+/**
+  * @brief  Queue a chunk of the window, and start the DMA if it is idle.
+  * @param  Data: Pixels, in flash or in a cell buffer
+  * @param  Size: Size in bytes
+  * @retval None
+  */
+static void TFT_Push(const void *Data, uint32_t Size)
+{
+  TFT_ChunkTypeDef *chunk;
+
+  TFT_WaitQueue(TftQueueTail - TFT_QUEUE_SIZE + 1U);
+
+  chunk = &TftQueue[TftQueueTail % TFT_QUEUE_SIZE];
+  chunk->Data = (const uint8_t *)Data;
+  chunk->Size = (uint16_t)Size;
+
+  __disable_irq();
+  TftQueueTail++;
+  if (TftBusy == 0U)
+  {
+    TftBusy = 1U;
+    HAL_SPI_Transmit_DMA(&TftSpiHandle, (uint8_t *)chunk->Data, chunk->Size);
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  Sleep until Count chunks are sent.
+  * @note   WFI is entered with the interrupts masked, so that the DMA
+  *         interrupt cannot slip in between the test and the sleep.
+  * @param  Count: Queue count to reach
+  * @retval None
+  */
+static void TFT_WaitQueue(uint32_t Count)
+{
+  __disable_irq();
+  while ((int32_t)(TftQueueHead - Count) < 0)
+  {
+    __WFI();
+    __enable_irq();
+    __disable_irq();
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  Wait for the end of the window and release the panel.
+  * @note   The SPI clock stops in STOP mode: the window must be over
+  *         before the idle loop.
+  * @param  None
+  * @retval None
+  */
+static void TFT_Flush(void)
+{
+  TFT_WaitQueue(TftQueueTail);
+  TFT_CS_HIGH();
+}
+
+/**
+  * @brief  Take the cell buffer not being sent.
+  * @param  None
+  * @retval Cell buffer
+  */
+static uint16_t *TFT_GetCell(void)
+{
+  TFT_WaitQueue(TftCellUntil[TftCellNext]);
+  return TftCell[TftCellNext];
+}
+
+/**
+  * @brief  Queue the cell buffer of TFT_GetCell().
+  * @param  Cell: Cell buffer
+  * @param  Pixels: Pixels drawn
+  * @retval None
+  */
+static void TFT_PushCell(uint16_t *Cell, uint32_t Pixels)
+{
+  TFT_Push(Cell, Pixels * 2U);
+  TftCellUntil[TftCellNext] = TftQueueTail;
+  TftCellNext ^= 1U;
+}
+
+/**
+  * @brief  Copy a sprite in another color.
+  * @note   The sprites are white on black: their green level, 6 bits, is
+  *         the coverage of each pixel.
+  * @param  Dest: Cell buffer
+  * @param  Sprite: Sprite in flash
+  * @param  Pixels: Size of the sprite
+  * @param  Color: RGB565 color of the digit
+  * @retval None
+  */
+static void TFT_Tint(uint16_t *Dest, const uint16_t *Sprite, uint32_t Pixels, uint16_t Color)
+{
+  uint32_t r = (Color >> 11U) & 0x1FU, g = (Color >> 5U) & 0x3FU, b = Color & 0x1FU;
+  uint32_t level;
+
+  for (; Pixels != 0U; Pixels--, Sprite++)
+  {
+    level = (TFT_PIXEL(*Sprite) >> 5U) & 0x3FU;
+    *Dest++ = TFT_PIXEL(((r * level / 63U) << 11U) | ((g * level / 63U) << 5U) | (b * level / 63U));
+  }
+}
+
+/**
+  * @brief  Fill a rectangle of a cell buffer.
+  * @param  Cell: Cell buffer, column after column
+  * @param  X: Left column in the cell
+  * @param  Y: Top row in the cell
+  * @param  Width: Width in pixels
+  * @param  Height: Height in pixels
+  * @param  Rows: Height of the cell
+  * @param  Pixel: Byte swapped color, see TFT_PIXEL()
+  * @retval None
+  */
+static void TFT_Fill(uint16_t *Cell, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height,
+                     uint32_t Rows, uint16_t Pixel)
+{
+  uint16_t *column = &Cell[(X * Rows) + Y];
+  uint32_t i;
+
+  for (; Width != 0U; Width--, column += Rows)
+  {
+    for (i = 0U; i < Height; i++)
+    {
+      column[i] = Pixel;
+    }
+  }
+}
+
+/**
+  * @brief  Queue a digit and its separator.
+  * @param  Frame: Frame to draw
+  * @param  Pos: Digit position
+  * @retval None
+  */
+static void TFT_PushDigit(const DISPLAY_FrameTypeDef *Frame, uint32_t Pos)
+{
+  uint32_t sprite = TFT_SPRITE_BLANK, sep = 0U;
+  uint8_t ch = Frame->Char[Pos];
+  uint16_t *cell;
+
+  if ((ch >= '0') && (ch <= '9'))
+  {
+    sprite = ch - '0';
+  }
+  else if (ch == '-')
+  {
+    sprite = TFT_SPRITE_MINUS;
+  }
+  if ((Frame->Colon & DISPLAY_CELL(Pos)) != 0U)
+  {
+    sep |= TFT_SPRITE_SEP_COLON;
+  }
+  if ((Frame->Point & DISPLAY_CELL(Pos)) != 0U)
+  {
+    sep |= TFT_SPRITE_SEP_POINT;
+  }
+
+  if (TftDigitColor == TFT_COLOR_DIGIT)
+  {
+    /* Straight from flash */
+    TFT_Push(TftDigitSprites[sprite], sizeof(TftDigitSprites[0]));
+    TFT_Push(TftSepSprites[sep], sizeof(TftSepSprites[0]));
+    return;
+  }
+
+  /* Tinted while the previous cell is sent */
+  cell = TFT_GetCell();
+  TFT_Tint(cell, TftDigitSprites[sprite], TFT_SPRITE_DIGIT_WIDTH * TFT_CELL_HEIGHT, TftDigitColor);
+  TFT_Tint(&cell[TFT_SPRITE_DIGIT_WIDTH * TFT_CELL_HEIGHT], TftSepSprites[sep],
+           TFT_SPRITE_SEP_WIDTH * TFT_CELL_HEIGHT, TftDigitColor);
+  TFT_PushCell(cell, TFT_CELL_PIXELS);
+}
+
+/**
+  * @brief  Initialize SPI1, its DMA channel and the panel.
+  * @param  None
+  * @retval None
+  */
+static void TFT_Init(void)
+{
+  GPIO_InitTypeDef gpio;
+  const uint8_t *cmd = TftInitTable;
+  uint16_t *cell;
+  uint32_t count;
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  TFT_SPI_CLK_ENABLE();
+
+  gpio.Pin       = TFT_SPI_SCK_PIN | TFT_SPI_MOSI_PIN;
+  gpio.Mode      = GPIO_MODE_AF_PP;
+  gpio.Pull      = GPIO_NOPULL;
+  gpio.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
+  gpio.Alternate = TFT_SPI_AF;
+  HAL_GPIO_Init(TFT_SPI_GPIO_PORT, &gpio);
+
+  gpio.Pin       = TFT_CS_PIN;
+  gpio.Mode      = GPIO_MODE_OUTPUT_PP;
+  gpio.Alternate = 0U;
+  HAL_GPIO_Init(TFT_CS_GPIO_PORT, &gpio);
+  gpio.Pin       = TFT_DC_PIN;
+  HAL_GPIO_Init(TFT_DC_GPIO_PORT, &gpio);
+  TFT_CS_HIGH();
+
+  /* Half the APB2 clock, mode 0: 16 MHz on the PLL, 1 MHz on the MSI */
+  TftSpiHandle.Instance               = TFT_SPI;
+  TftSpiHandle.Init.Mode              = SPI_MODE_MASTER;
+  TftSpiHandle.Init.Direction         = SPI_DIRECTION_2LINES;
+  TftSpiHandle.Init.DataSize          = SPI_DATASIZE_8BIT;
+  TftSpiHandle.Init.CLKPolarity       = SPI_POLARITY_LOW;
+  TftSpiHandle.Init.CLKPhase          = SPI_PHASE_1EDGE;
+  TftSpiHandle.Init.NSS               = SPI_NSS_SOFT;
+  TftSpiHandle.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
+  TftSpiHandle.Init.FirstBit          = SPI_FIRSTBIT_MSB;
+  TftSpiHandle.Init.TIMode            = SPI_TIMODE_DISABLE;
+  TftSpiHandle.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+  TftSpiHandle.Init.CRCPolynomial     = 7U;
+  HAL_SPI_Init(&TftSpiHandle);
+
+  TftDmaHandle.Instance                 = TFT_DMA_CHANNEL;
+  TftDmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  TftDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  TftDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  TftDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  TftDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  TftDmaHandle.Init.Mode                = DMA_NORMAL;
+  TftDmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&TftDmaHandle);
+  __HAL_LINKDMA(&TftSpiHandle, hdmatx, TftDmaHandle);
+
+  HAL_NVIC_SetPriority(TFT_DMA_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(TFT_DMA_IRQn);
+
+  while (cmd < &TftInitTable[sizeof(TftInitTable)])
+  {
+    count = cmd[1] & ~TFT_DELAY;
+    TFT_WriteCommand(cmd[0], &cmd[2], count);
+    if ((cmd[1] & TFT_DELAY) != 0U)
+    {
+      HAL_Delay(cmd[2 + count]);
+      cmd++;
+    }
+    cmd += 2U + count;
+  }
+
+  /* Clear the face, the same black chunk over and over */
+  cell = TFT_GetCell();
+  TFT_Fill(cell, 0U, 0U, TFT_CLEAR_COLUMNS, TFT_HEIGHT, TFT_HEIGHT, TFT_PIXEL(TFT_COLOR_BACK));
+  TFT_Window(0U, 0U, TFT_WIDTH, TFT_HEIGHT);
+  for (count = 0U; count < TFT_WIDTH; count += TFT_CLEAR_COLUMNS)
+  {
+    TFT_Push(cell, TFT_CLEAR_COLUMNS * TFT_HEIGHT * 2U);
+  }
+  TFT_Flush();
+}
+
+/**
+  * @brief  Draw the dirty cells.
+  * @param  Frame: Frame to draw
+  * @param  Bar: DISPLAY_BAR_xxx
+  * @param  DirtyCells: DISPLAY_CELL() bits to draw
+  * @retval None
+  */
+static void TFT_Render(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t DirtyCells)
+{
+  POWER_ClockTypeDef clock;
+  uint32_t first, last, pos;
+  uint16_t *cell;
+
+  /* Left on the MSI if the HSI does not start: only slower */
+  (void)POWER_ClockHSI(&clock);
+
+  /* One window from the first to the last dirty digit */
+  for (first = 0U; first < DISPLAY_DIGITS; first++)
+  {
+    if ((DirtyCells & DISPLAY_CELL(first)) != 0U)
+    {
+      break;
+    }
+  }
+  if (first < DISPLAY_DIGITS)
+  {
+    for (last = DISPLAY_DIGITS - 1U; (DirtyCells & DISPLAY_CELL(last)) == 0U; last--)
+    {
+    }
+    TFT_Window(TFT_CELL_X + (first * TFT_CELL_WIDTH), TFT_CELL_Y,
+               (last - first + 1U) * TFT_CELL_WIDTH, TFT_CELL_HEIGHT);
+    for (pos = first; pos <= last; pos++)
+    {
+      TFT_PushDigit(Frame, pos);
+    }
+    TFT_Flush();
+  }
+
+  if ((DirtyCells & DISPLAY_CELL_BAR) != 0U)
+  {
+    cell = TFT_GetCell();
+    TFT_Fill(cell, 0U, 0U, TFT_BAR_CELL_WIDTH, TFT_BAR_HEIGHT, TFT_BAR_HEIGHT,
+             TFT_PIXEL(TFT_COLOR_BACK));
+    for (pos = 0U; pos < 4U; pos++)
+    {
+      TFT_Fill(cell, pos * TFT_BAR_STEP, 0U, TFT_BAR_WIDTH, TFT_BAR_HEIGHT, TFT_BAR_HEIGHT,
+               TFT_PIXEL((pos < Bar) ? TFT_COLOR_BAR_ON : TFT_COLOR_BAR_OFF));
+    }
+    TFT_Window(TFT_BAR_X, TFT_BAR_Y, TFT_BAR_CELL_WIDTH, TFT_BAR_HEIGHT);
+    TFT_PushCell(cell, TFT_BAR_CELL_WIDTH * TFT_BAR_HEIGHT);
+    TFT_Flush();
+  }
+
+  POWER_ClockRestore(&clock);
+}
+
+/**
+  * @brief  Highlight the digits instead of blinking them.
+  * @note   The digits are redrawn by DISPLAY_Blink().
+  * @param  Blink: Blinking mode
+  * @retval None
+  */
+static void TFT_Blink(DISPLAY_BlinkTypeDef Blink)
+{
+  switch (Blink)
+  {
+  case DISPLAY_BLINK_SLOW:
+    TftDigitColor = TFT_COLOR_SLOW;
+    break;
+  case DISPLAY_BLINK_FAST:
+    TftDigitColor = TFT_COLOR_FAST;
+    break;
+  default:
+    TftDigitColor = TFT_COLOR_DIGIT;
+    break;
+  }
+}
+
+/**
+  * @brief  No contrast control on this panel.
+  * @param  Level: Not used
+  * @retval None
+  */
+static void TFT_Contrast(uint32_t Level)
+{
+}
+
+/**
+  * @brief  Switch the panel off and put it to sleep.
+  * @note   Called from the PVD interrupt: a window in progress is dropped,
+  *         the commands are polled.
+  * @param  None
+  * @retval None
+  */
+static void TFT_Off(void)
+{
+  if (TftBusy != 0U)
+  {
+    HAL_SPI_Abort(&TftSpiHandle);
+    TftBusy = 0U;
+  }
+  TftQueueHead = TftQueueTail;
+  TFT_CS_HIGH();
+
+  TFT_WriteCommand(ST7735_DISPOFF, NULL, 0U);
+  TFT_WriteCommand(ST7735_SLPIN, NULL, 0U);
+}
+
+/**
+  * @brief  Wake the panel up: its frame memory was kept in sleep.
+  * @param  None
+  * @retval None
+  */
+static void TFT_On(void)
+{
+  TFT_WriteCommand(ST7735_SLPOUT, NULL, 0U);
+  HAL_Delay(TFT_SLPOUT_DELAY_MS);
+  TFT_WriteCommand(ST7735_DISPON, NULL, 0U);
+}
+
+/**
+  * @brief  Set the panel up after STANDBY and draw the whole frame.
+  * @note   The shield resets the panel with the board: its frame memory is
+  *         lost and the full initialization is needed.
+  * @param  Frame: Frame to show
+  * @param  Bar: DISPLAY_BAR_xxx
+  * @param  Contrast: Not used
+  * @retval None
+  */
+static void TFT_Resume(const DISPLAY_FrameTypeDef *Frame, uint32_t Bar, uint32_t Contrast)
+{
+  TFT_Init();
+  TFT_Render(Frame, Bar, DISPLAY_CELL_ALL);
+}
+
+/**
+  * @brief  Tx transfer completed callback: start the next chunk.
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  TFT_ChunkTypeDef *chunk;
+
+  if (hspi != &TftSpiHandle)
+  {
+    return;
+  }
+
+  TftQueueHead++;
+  if (TftQueueHead != TftQueueTail)
+  {
+    chunk = &TftQueue[TftQueueHead % TFT_QUEUE_SIZE];
+    HAL_SPI_Transmit_DMA(&TftSpiHandle, (uint8_t *)chunk->Data, chunk->Size);
+  }
+  else
+  {
+    TftBusy = 0U;
+  }
+}
+
+/**
+  * @brief  This function handles the SPI1_TX DMA channel interrupt request.
+  * @param  None
+  * @retval None
+  */
+void TFT_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(TftSpiHandle.hdmatx);
+}
+
+#endif /* USE_DISPLAY_TFT */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,306 @@
+/**
+  ******************************************************************************
+  * @file    event.c
+  * @author  MCD Application Team
+  * @brief   Run-to-completion event scheduler.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Call EVT_Init() then EVT_Register() for every event the application
+        handles, before the interrupts posting them are enabled.
+    (#) Interrupt handlers only post an event with EVT_Post() and return.
+    (#) The main loop alternates EVT_Dispatch() and EVT_Idle(): handlers run
+        in thread mode at the lowest priority, and the core enters STOP
+        mode as soon as every queue is empty.
+    (#) A driver streaming through DMA calls EVT_InhibitStop() for the
+        length of its transfers: the core then only enters SLEEP mode, the
+        peripheral clocks keep running.
+    (#) In the FreeRTOS build (USE_FREERTOS, see rtos.c) the events posted
+        once the kernel runs go to the queue of the task handling them,
+        which runs them with EVT_Run(). The kernel idles through
+        EVT_Sleep().
+
+    [..]
+    (@) Each producer owns a ring: head is only written by the interrupt,
+        tail only by the main loop, so no lock or critical section is
+        needed on either side.
+    (@) A full ring drops the new event and counts it (EVT_GetDropped()).
+    (@) Utilities/HostTest/event_test.c runs the rings on the host, one
+        thread per producer.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "event.h"
+#include "profile.h"
+#include "watchdog.h"
+#include "rtos.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  EVT_TypeDef       Buffer[EVT_QUEUE_SIZE];
+  __IO uint32_t     Head;        /*!< Next slot to write, producer only     */
+  __IO uint32_t     Tail;        /*!< Next slot to read, consumer only      */
+  uint32_t          Dropped;     /*!< Events lost on a full ring            */
+} EVT_QueueTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define EVT_QUEUE_MASK     (EVT_QUEUE_SIZE - 1U)
+
+#if ((EVT_QUEUE_SIZE & EVT_QUEUE_MASK) != 0U)
+#error "EVT_QUEUE_SIZE must be a power of 2"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static EVT_QueueTypeDef   EvtQueues[EVT_SRC_COUNT];
+static EVT_HandlerTypeDef EvtHandlers[EVT_ID_COUNT];
+static __IO uint32_t      EvtStopInhibit;   /* EVT_STOP_xxx users running */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t EVT_Pending(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Check whether any queue holds an event.
+  * @param  None
+  * @retval 0 when all queues are empty
+  */
+static uint32_t EVT_Pending(void)
+{
+  uint32_t src;
+
+  for (src = 0U; src < EVT_SRC_COUNT; src++)
+  {
+    if (EvtQueues[src].Head != EvtQueues[src].Tail)
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Empty all queues and unregister all handlers.
+  * @param  None
+  * @retval None
+  */
+void EVT_Init(void)
+{
+  uint32_t i;
+
+  for (i = 0U; i < EVT_SRC_COUNT; i++)
+  {
+    EvtQueues[i].Head = 0U;
+    EvtQueues[i].Tail = 0U;
+    EvtQueues[i].Dropped = 0U;
+  }
+  for (i = 0U; i < EVT_ID_COUNT; i++)
+  {
+    EvtHandlers[i] = NULL;
+  }
+}
+
+/**
+  * @brief  Register the handler of an event.
+  * @param  Id: Event identifier
+  * @param  Handler: Function run from EVT_Dispatch(), NULL to ignore the event
+  * @retval None
+  */
+void EVT_Register(EVT_IdTypeDef Id, EVT_HandlerTypeDef Handler)
+{
+  EvtHandlers[Id] = Handler;
+}
+
+/**
+  * @brief  Post an event. Only to be called by the producer owning Source.
+  * @param  Source: Producer queue
+  * @param  Id: Event identifier
+  * @param  Param: Event specific parameter
+  * @retval HAL_OK, or HAL_BUSY if the queue was full and the event dropped
+  */
+HAL_StatusTypeDef EVT_Post(EVT_SourceTypeDef Source, EVT_IdTypeDef Id, uint32_t Param)
+{
+  EVT_QueueTypeDef *q = &EvtQueues[Source];
+  uint32_t head = q->Head;
+#if defined(USE_FREERTOS)
+  EVT_TypeDef evt;
+
+  if (RTOS_IsRunning() != 0U)
+  {
+    evt.Id = Id;
+    evt.Param = Param;
+    if (RTOS_Post(&evt) != HAL_OK)
+    {
+      q->Dropped++;
+      return HAL_BUSY;
+    }
+    return HAL_OK;
+  }
+#endif
+
+  if ((head - q->Tail) >= EVT_QUEUE_SIZE)
+  {
+    q->Dropped++;
+    return HAL_BUSY;
+  }
+
+  q->Buffer[head & EVT_QUEUE_MASK].Id = Id;
+  q->Buffer[head & EVT_QUEUE_MASK].Param = Param;
+
+  /* The record must be complete before the consumer can see it */
+  __DMB();
+  q->Head = head + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run the handlers of all pending events, highest priority
+  *         source first.
+  * @param  None
+  * @retval Number of events dispatched
+  */
+uint32_t EVT_Dispatch(void)
+{
+  EVT_QueueTypeDef *q;
+  EVT_TypeDef evt;
+  uint32_t src, tail;
+  uint32_t count = 0U;
+
+  for (src = 0U; src < EVT_SRC_COUNT; src++)
+  {
+    q = &EvtQueues[src];
+    tail = q->Tail;
+    while (tail != q->Head)
+    {
+      evt = q->Buffer[tail & EVT_QUEUE_MASK];
+
+      /* Release the slot only once it has been copied */
+      __DMB();
+      q->Tail = ++tail;
+
+      EVT_Run(&evt);
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Run the handler of an event.
+  * @param  Event: Event to handle
+  * @retval None
+  */
+void EVT_Run(const EVT_TypeDef *Event)
+{
+  uint32_t start;
+
+  if (EvtHandlers[Event->Id] != NULL)
+  {
+    WDG_STAGE(WDG_STAGE_EVENT | ((uint32_t)Event->Id << WDG_STAGE_DETAIL_SHIFT));
+    start = PROF_CYCLES();
+    EvtHandlers[Event->Id](Event->Param);
+    PROF_Record(PROF_EVT_DISPATCH, start);
+  }
+}
+
+/**
+  * @brief  Enter STOP mode unless an event is pending.
+  * @note   Interrupts are masked while the queues are checked: an event
+  *         posted after the check leaves its interrupt pending, which makes
+  *         WFI return immediately. The interrupt is taken once unmasked.
+  * @note   SLEEP mode only while a user of EVT_InhibitStop() runs.
+  * @param  None
+  * @retval None
+  */
+void EVT_Idle(void)
+{
+  __disable_irq();
+
+  if (EVT_Pending() == 0U)
+  {
+    EVT_Sleep();
+  }
+
+  __enable_irq();
+}
+
+/**
+  * @brief  Enter STOP mode, or SLEEP mode while a user of EVT_InhibitStop()
+  *         runs, until the next interrupt.
+  * @note   To be called with the interrupts masked.
+  * @param  None
+  * @retval None
+  */
+void EVT_Sleep(void)
+{
+  /* The WWDG would count on in SLEEP mode */
+  WDG_Idle();
+
+  if (EvtStopInhibit != 0U)
+  {
+    HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+  }
+  else
+  {
+    HAL_PWR_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+    /* The MSI is the system clock after STOP mode */
+    SystemCoreClockUpdate();
+  }
+}
+
+/**
+  * @brief  Keep the core out of STOP mode while a peripheral runs.
+  * @note   May be called from an interrupt, e.g. at the end of a transfer.
+  * @param  User: EVT_STOP_xxx
+  * @param  State: ENABLE while the peripheral runs, DISABLE once stopped
+  * @retval None
+  */
+void EVT_InhibitStop(uint32_t User, FunctionalState State)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (State != DISABLE)
+  {
+    EvtStopInhibit |= User;
+  }
+  else
+  {
+    EvtStopInhibit &= ~User;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Number of events a producer could not post.
+  * @param  Source: Producer queue
+  * @retval Dropped events since EVT_Init()
+  */
+uint32_t EVT_GetDropped(EVT_SourceTypeDef Source)
+{
+  return EvtQueues[Source].Dropped;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
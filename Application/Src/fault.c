@@ -0,0 +1,203 @@
+/**
+  ******************************************************************************
+  * @file    fault.c
+  * @author  MCD Application Team
+  * @brief   Fault capture: the stacked frame and fault status of a HardFault,
+  *          MemManage, BusFault or UsageFault are saved to a ring in the data
+  *          EEPROM, then the part is reset at once.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The fault handlers of stm32l1xx_it.c are FAULT_HANDLER functions
+        made of FAULT_ENTRY(): it locates the exception frame on the stack in
+        use, MSP or PSP, and branches to FAULT_Capture() before anything is
+        pushed. No handler spins: a fault in the field costs a reset, a few
+        tens of milliseconds, instead of the cell drained at run current.
+    (#) FAULT_Capture() writes one FAULT_RecordTypeDef, 8 words, to the
+        oldest slot of the FAULT_RECORDS ring at FAULT_RING_ADDRESS: the
+        stacked PC, LR and xPSR, CFSR, HFSR, the faulting address when valid,
+        the RCC_CSR reset flags and the stage recorded by watchdog.c. The
+        data EEPROM is programmed at register level, the HAL flash driver
+        may be the one that faulted. The header, with the magic and the
+        sequence number, is written last. The slot is left pending in
+        RTC_BKP_FAULT and NVIC_SystemReset() follows.
+    (#) FAULT_Init(), after LOG_Init(), logs a pending capture as LOG_FAULT
+        with the exception number and the faulting PC, and enables the
+        MemManage, BusFault and UsageFault handlers, which otherwise escalate
+        to HardFault with less detail.
+    (#) The ring is kept across resets and power losses. It is read on the
+        host by Utilities/Fault/fault_decode.py from a dump of the data
+        EEPROM, taken with the system bootloader or a debugger.
+    (#) A fault in the capture itself, the data EEPROM not answering for
+        instance, locks the core up: the IWDG started by watchdog.c resets
+        the part.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fault.h"
+#include "rtc.h"
+#include "log.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Exception frame: R0-R3, R12, LR, PC, xPSR */
+#define FAULT_FRAME_WORDS       8U
+#define FAULT_FRAME_LR          5U
+#define FAULT_FRAME_PC          6U
+#define FAULT_FRAME_PSR         7U
+
+/* Frame not on the stack: its words are recorded as such */
+#define FAULT_NO_FRAME          0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+#define FAULT_RING              ((const FAULT_RecordTypeDef *)FAULT_RING_ADDRESS)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void FAULT_Program(uint32_t Address, uint32_t Data);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Log the fault captured before this reset, if any, and enable the
+  *         configurable fault handlers.
+  * @note   To be called after LOG_Init().
+  * @param  None
+  * @retval None
+  */
+void FAULT_Init(void)
+{
+  uint32_t pending = RTC_BackupRead(RTC_BKP_FAULT);
+  const FAULT_RecordTypeDef *record;
+
+  if ((pending & FAULT_PENDING) != 0U)
+  {
+    RTC_BackupWrite(RTC_BKP_FAULT, pending & ~FAULT_PENDING);
+
+    record = &FAULT_RING[(pending & FAULT_PENDING_SLOT) % FAULT_RECORDS];
+    if ((record->Header >> FAULT_MAGIC_SHIFT) == FAULT_MAGIC)
+    {
+      LOG_Write(LOG_FAULT, (uint16_t)((record->Header & FAULT_EXCEPTION) >> FAULT_EXCEPTION_SHIFT),
+                record->Pc);
+    }
+  }
+
+  SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk | SCB_SHCSR_BUSFAULTENA_Msk | SCB_SHCSR_MEMFAULTENA_Msk;
+}
+
+/**
+  * @brief  Save a fault record and reset.
+  * @note   Entered from FAULT_ENTRY(), in the fault handler.
+  * @param  Frame: exception frame, or NULL if unknown
+  * @param  ExcReturn: EXC_RETURN of the fault handler
+  * @retval None
+  */
+void FAULT_Capture(const uint32_t *Frame, uint32_t ExcReturn)
+{
+  uint32_t address = (uint32_t)FAULT_RING_ADDRESS;
+  uint32_t stack = *(const uint32_t *)SCB->VTOR;
+  uint32_t cfsr = SCB->CFSR;
+  uint32_t slot = 0U;
+  uint32_t sequence = 0U;
+  uint32_t header;
+  uint32_t i;
+
+  __disable_irq();
+
+  /* Stacked words only from a frame within the RAM */
+  if (((uint32_t)Frame < SRAM_BASE) ||
+      (((uint32_t)Frame + (FAULT_FRAME_WORDS * 4U)) > stack))
+  {
+    Frame = NULL;
+  }
+
+  /* Slot after the newest record */
+  for (i = 0U; i < FAULT_RECORDS; i++)
+  {
+    header = FAULT_RING[i].Header;
+    if (((header >> FAULT_MAGIC_SHIFT) == FAULT_MAGIC) &&
+        ((header & FAULT_SEQUENCE) >= sequence))
+    {
+      sequence = header & FAULT_SEQUENCE;
+      slot = (i + 1U) % FAULT_RECORDS;
+    }
+  }
+  sequence = (sequence + 1U) & FAULT_SEQUENCE;
+  address += slot * sizeof(FAULT_RecordTypeDef);
+
+  /* An interrupted operation ends first, its errors are cleared */
+  while ((FLASH->SR & FLASH_SR_BSY) != 0U)
+  {
+  }
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_MASK);
+  if ((FLASH->PECR & FLASH_PECR_PELOCK) != 0U)
+  {
+    FLASH->PEKEYR = FLASH_PEKEY1;
+    FLASH->PEKEYR = FLASH_PEKEY2;
+  }
+
+  FAULT_Program(address + 0x04U, (Frame != NULL) ? Frame[FAULT_FRAME_PC] : FAULT_NO_FRAME);
+  FAULT_Program(address + 0x08U, (Frame != NULL) ? Frame[FAULT_FRAME_LR] : FAULT_NO_FRAME);
+  FAULT_Program(address + 0x0CU, (Frame != NULL) ? Frame[FAULT_FRAME_PSR] : FAULT_NO_FRAME);
+  FAULT_Program(address + 0x10U, cfsr);
+  FAULT_Program(address + 0x14U, SCB->HFSR);
+  if ((cfsr & SCB_CFSR_MMARVALID_Msk) != 0U)
+  {
+    FAULT_Program(address + 0x18U, SCB->MMFAR);
+  }
+  else if ((cfsr & SCB_CFSR_BFARVALID_Msk) != 0U)
+  {
+    FAULT_Program(address + 0x18U, SCB->BFAR);
+  }
+  else
+  {
+    FAULT_Program(address + 0x18U, 0U);
+  }
+  FAULT_Program(address + 0x1CU, (RCC->CSR & FAULT_INFO_FLAGS) |
+                                 ((ExcReturn & 0xFFU) << FAULT_INFO_RETURN_SHIFT) |
+                                 (RTC_BackupRead(RTC_BKP_WDG_STAGE) & FAULT_INFO_STAGE));
+  FAULT_Program(address, (FAULT_MAGIC << FAULT_MAGIC_SHIFT) |
+                         ((__get_IPSR() << FAULT_EXCEPTION_SHIFT) & FAULT_EXCEPTION) |
+                         sequence);
+
+  FLASH->PECR |= FLASH_PECR_PELOCK;
+
+  /* Backup domain write access is kept from RTC_Init() */
+  RTC_BackupWrite(RTC_BKP_FAULT, FAULT_PENDING | slot);
+
+  NVIC_SystemReset();
+}
+
+/**
+  * @brief  Program one word of the data EEPROM, erased first by the
+  *         hardware, and wait for the end of the operation.
+  * @param  Address: word address in the data EEPROM
+  * @param  Data: word to write
+  * @retval None
+  */
+static void FAULT_Program(uint32_t Address, uint32_t Data)
+{
+  *(__IO uint32_t *)Address = Data;
+  while ((FLASH->SR & FLASH_SR_BSY) != 0U)
+  {
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * @file    light.c
+  * @author  MCD Application Team
+  * @brief   Ambient light watch: COMP1 compares a light sensor with VREFINT
+  *          in STOP mode, and the display is blanked while it is dark.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The sensor output, rising with the light, is the external channel of
+        sense.c: its level is also sampled with the other sensors. COMP1
+        compares it with VREFINT for a fraction of a uA, and its EXTI
+        line 21 wakes the core from STOP on both edges.
+    (#) After LIGHT_DARK_DELAY_S seconds in the dark, counted on the RTC
+        wake-up, the display is blanked with DISPLAY_Blank(): on the glass
+        the LCD controller stops biasing the segments. The RTC and the clock
+        go on, and the display layer keeps the frame up to date.
+    (#) As soon as the light comes back, the comparator interrupt lights
+        the display again with the current frame, without waiting for the
+        next second.
+    (#) After each edge the comparator interrupt is masked until the next
+        RTC wake-up, where the level is read again: a sensor hovering around
+        the threshold wakes the core up once a second at most.
+    (#) Only built with USE_LIGHT_SENSOR: an unconnected input would blank
+        the display at random.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "light.h"
+#include "sense.h"
+#include "display.h"
+#include "event.h"
+#include "log.h"
+
+#if defined(USE_LIGHT_SENSOR)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static COMP_HandleTypeDef LightCompHandle;
+
+static uint32_t LightDark;        /* Level last taken into account           */
+static uint32_t LightBlanked;     /* Display blanked by this module          */
+static uint32_t LightSeconds;     /* Seconds in the dark, then blanked       */
+
+/* Private function prototypes -----------------------------------------------*/
+static void LIGHT_OnChange(uint32_t Param);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Comparator level change, handler of EVT_LIGHT.
+  * @note   Also called on the RTC wake-up when the level read differs from
+  *         the one last taken into account.
+  * @param  Param: COMP_OUTPUTLEVEL_HIGH in the light, LOW in the dark
+  * @retval None
+  */
+static void LIGHT_OnChange(uint32_t Param)
+{
+  if (Param == COMP_OUTPUTLEVEL_LOW)
+  {
+    if (LightDark == 0U)
+    {
+      LightDark = 1U;
+      LightSeconds = 0U;
+    }
+    return;
+  }
+
+  LightDark = 0U;
+  if (LightBlanked != 0U)
+  {
+    DISPLAY_Blank(DISABLE);
+    LightBlanked = 0U;
+    LOG_Write(LOG_DISPLAY, 0U, LightSeconds);
+  }
+  LightSeconds = 0U;
+}
+
+/**
+  * @brief  Start the comparator on the light sensor.
+  * @param  None
+  * @retval None
+  */
+void LIGHT_Init(void)
+{
+  LightCompHandle.Instance = COMP1;
+  LightCompHandle.Init.InvertingInput = COMP_INVERTINGINPUT_VREFINT;
+  LightCompHandle.Init.NonInvertingInput = LIGHT_COMP_INPUT;
+  LightCompHandle.Init.Output = COMP_OUTPUT_NONE;
+  LightCompHandle.Init.Mode = COMP_MODE_LOWSPEED;
+  LightCompHandle.Init.WindowMode = COMP_WINDOWMODE_DISABLE;
+  LightCompHandle.Init.TriggerMode = COMP_TRIGGERMODE_IT_RISING_FALLING;
+  LightCompHandle.Init.NonInvertingInputPull = COMP_NONINVERTINGINPUT_NOPULL;
+  HAL_COMP_Init(&LightCompHandle);
+
+  LightDark = 0U;
+  LightBlanked = 0U;
+  LightSeconds = 0U;
+  EVT_Register(EVT_LIGHT, LIGHT_OnChange);
+
+  HAL_COMP_Start_IT(&LightCompHandle);
+  LIGHT_OnChange(HAL_COMP_GetOutputLevel(&LightCompHandle));
+}
+
+/**
+  * @brief  Count the seconds in the dark and blank the display once
+  *         LIGHT_DARK_DELAY_S is reached.
+  * @param  None
+  * @retval None
+  */
+void LIGHT_OnSecond(void)
+{
+  uint32_t level = HAL_COMP_GetOutputLevel(&LightCompHandle);
+
+  /* Unmask the comparator again, catching an edge missed meanwhile */
+  if (READ_BIT(EXTI->IMR, COMP_EXTI_LINE_COMP1) == 0U)
+  {
+    __HAL_COMP_COMP1_EXTI_CLEAR_FLAG();
+    __HAL_COMP_COMP1_EXTI_ENABLE_IT();
+    if ((level == COMP_OUTPUTLEVEL_LOW) != (LightDark != 0U))
+    {
+      LIGHT_OnChange(level);
+    }
+  }
+
+  if (LightDark == 0U)
+  {
+    return;
+  }
+
+  LightSeconds++;
+  if ((LightBlanked == 0U) && (LightSeconds >= LIGHT_DARK_DELAY_S))
+  {
+    LOG_Write(LOG_DISPLAY, 1U, 0U);
+    DISPLAY_Blank(ENABLE);
+    LightBlanked = 1U;
+    LightSeconds = 0U;
+  }
+}
+
+/**
+  * @brief  Ambient light state.
+  * @param  None
+  * @retval Non zero while it is dark
+  */
+uint32_t LIGHT_IsDark(void)
+{
+  return LightDark;
+}
+
+/**
+  * @brief  COMP MSP initialization.
+  * @param  hcomp: COMP handle
+  * @retval None
+  */
+void HAL_COMP_MspInit(COMP_HandleTypeDef *hcomp)
+{
+  GPIO_InitTypeDef gpioinitstruct;
+
+  __HAL_RCC_COMP_CLK_ENABLE();
+  SENSE_EXT_GPIO_CLK_ENABLE();
+
+  gpioinitstruct.Pin  = SENSE_EXT_PIN;
+  gpioinitstruct.Mode = GPIO_MODE_ANALOG;
+  gpioinitstruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(SENSE_EXT_GPIO_PORT, &gpioinitstruct);
+
+  HAL_NVIC_SetPriority(COMP_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(COMP_IRQn);
+}
+
+/**
+  * @brief  Comparator edge: post the new level, then mask the comparator
+  *         until the next RTC wake-up.
+  * @param  hcomp: COMP handle
+  * @retval None
+  */
+void HAL_COMP_TriggerCallback(COMP_HandleTypeDef *hcomp)
+{
+  __HAL_COMP_COMP1_EXTI_DISABLE_IT();
+  EVT_Post(EVT_SRC_COMP, EVT_LIGHT, HAL_COMP_GetOutputLevel(hcomp));
+}
+
+/**
+  * @brief  This function handles the COMP EXTI lines interrupt request.
+  * @param  None
+  * @retval None
+  */
+void COMP_IRQHandler(void)
+{
+  HAL_COMP_IRQHandler(&LightCompHandle);
+}
+
+#endif /* USE_LIGHT_SENSOR */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,342 @@
+/**
+  ******************************************************************************
+  * @file    log.c
+  * @author  MCD Application Team
+  * @brief   Event log appended to the uSD card one whole sector at a time.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) LOG_Write() fills a sector buffer in RAM with 16 byte records, from
+        the main loop only. The card is only powered, mounted and written
+        when the sector is full: one 512 byte append every
+        LOG_RECORDS_PER_SECTOR records instead of a f_write() per event.
+    (#) LOG_Flush() writes a partial sector as well, padded with 0xFF: it is
+        called when the battery gets low, while there is still energy for
+        the card. The log file is a whole number of sectors, each append
+        starts on a sector boundary.
+    (#) LOG_Save(), called by POWER_Shutdown(), keeps the last pending
+        records in the backup registers across STANDBY. LOG_Init() puts
+        them back in the sector buffer, then logs the reset cause.
+
+    [..]
+    (@) Each record ends with a CRC computed by the CRC unit, a torn or
+        unwritten record is found by a reader checking it. Seq counts the
+        records, a gap shows records lost on a power cut.
+    (@) The card is only written in builds where USE_LOG_SD is defined (see
+        main.h), linked with FatFs and the SD disk I/O driver of
+        FatFs_uSD. Otherwise a full sector is dropped and the buffer is
+        reused.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "log.h"
+#include "rtc.h"
+#include "watchdog.h"
+#include "stm32l1xx_ll_rtc.h"
+#include "string.h"
+#if defined(USE_LOG_SD)
+#include "ff_gen_drv.h"
+#include "sd_diskio.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* RTC_BKP_LOG content: magic, next Seq and number of saved records */
+#define LOG_BKP_MAGIC           0x10AU
+#define LOG_BKP_MAGIC_SHIFT     20U
+#define LOG_BKP_SEQ_SHIFT       8U
+
+/* Card supply switch, defined in main.h on boards that have one */
+#if !defined(LOG_SD_POWER_ON)
+#define LOG_SD_POWER_ON()
+#define LOG_SD_POWER_OFF()
+#endif
+
+#define LOG_RECORD_WORDS        (sizeof(LOG_RecordTypeDef) / 4U)
+#define LOG_CRC_WORDS           (LOG_RECORD_WORDS - 1U)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static LOG_RecordTypeDef LogSector[LOG_RECORDS_PER_SECTOR];
+static volatile uint32_t LogCount;       /* Records in LogSector            */
+static uint8_t LogSeq;
+
+/* Days before each month, non leap year */
+static const uint16_t LogMonthDays[12] =
+{
+  0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
+#if defined(USE_LOG_SD)
+static FATFS LogFs;
+static FIL LogFile;
+static char LogPath[4];
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t LOG_Crc(const LOG_RecordTypeDef *Record);
+static void     LOG_Append(LOG_TypeDef Type, uint16_t Arg, uint32_t Value);
+static HAL_StatusTypeDef LOG_WriteSector(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  CRC of a record, all words but the CRC itself.
+  * @note   Register accesses only: also used from the PVD interrupt.
+  * @param  Record: Record to check
+  * @retval CRC-32 (polynomial 0x04C11DB7, initial value 0xFFFFFFFF)
+  */
+static uint32_t LOG_Crc(const LOG_RecordTypeDef *Record)
+{
+  const uint32_t *words = (const uint32_t *)Record;
+  uint32_t i, crc;
+
+  __HAL_RCC_CRC_CLK_ENABLE();
+  CRC->CR = CRC_CR_RESET;
+  for (i = 0U; i < LOG_CRC_WORDS; i++)
+  {
+    CRC->DR = words[i];
+  }
+  crc = CRC->DR;
+  __HAL_RCC_CRC_CLK_DISABLE();
+
+  return crc;
+}
+
+/**
+  * @brief  Add a record to the sector buffer.
+  * @note   The record is counted once complete, so that LOG_Save() run from
+  *         the PVD interrupt never copies a half written record.
+  * @param  Type: Event
+  * @param  Arg: Event specific
+  * @param  Value: Event specific
+  * @retval None
+  */
+static void LOG_Append(LOG_TypeDef Type, uint16_t Arg, uint32_t Value)
+{
+  LOG_RecordTypeDef *record = &LogSector[LogCount];
+
+  record->Time = LOG_Now();
+  record->Type = (uint8_t)Type;
+  record->Seq = LogSeq++;
+  record->Arg = Arg;
+  record->Value = Value;
+  record->Crc = LOG_Crc(record);
+
+  __DMB();
+  LogCount++;
+}
+
+/**
+  * @brief  Append the sector buffer to the log file.
+  * @note   The card is powered and mounted for this write only. A file
+  *         left with a partial sector by a power cut is extended to the
+  *         next sector boundary: the reader skips the garbage by its CRC.
+  * @param  None
+  * @retval HAL_OK once the sector is on the card
+  */
+static HAL_StatusTypeDef LOG_WriteSector(void)
+{
+#if defined(USE_LOG_SD)
+  HAL_StatusTypeDef status = HAL_ERROR;
+  UINT written = 0U;
+
+  WDG_STAGE(WDG_STAGE_LOG);
+  LOG_SD_POWER_ON();
+
+  if ((FATFS_LinkDriver(&SD_Driver, LogPath) == 0U) &&
+      (f_mount(&LogFs, (TCHAR const *)LogPath, 1) == FR_OK))
+  {
+    if (f_open(&LogFile, LOG_FILE_NAME, FA_OPEN_ALWAYS | FA_WRITE) == FR_OK)
+    {
+      if ((f_lseek(&LogFile, (f_size(&LogFile) + LOG_SECTOR_SIZE - 1U) & ~(LOG_SECTOR_SIZE - 1U)) == FR_OK) &&
+          (f_write(&LogFile, LogSector, LOG_SECTOR_SIZE, &written) == FR_OK) &&
+          (written == LOG_SECTOR_SIZE))
+      {
+        status = HAL_OK;
+      }
+      /* Writes the cached FAT and directory sectors back as well */
+      if (f_close(&LogFile) != FR_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+    f_mount(NULL, (TCHAR const *)LogPath, 0);
+  }
+  FATFS_UnLinkDriver(LogPath);
+
+  LOG_SD_POWER_OFF();
+
+  return status;
+#else
+  return HAL_OK;
+#endif /* USE_LOG_SD */
+}
+
+/**
+  * @brief  Restore the records saved before STANDBY, then log the reset.
+  * @note   To be called once the RTC is initialized, before
+  *         POWER_Restore() clears the STANDBY flag.
+  * @param  None
+  * @retval None
+  */
+void LOG_Init(void)
+{
+  uint32_t header = RTC_BackupRead(RTC_BKP_LOG);
+  uint32_t count, i, j;
+  uint32_t *words;
+
+  LogCount = 0U;
+  LogSeq = 0U;
+
+  if ((header >> LOG_BKP_MAGIC_SHIFT) == LOG_BKP_MAGIC)
+  {
+    /* A snapshot is used once */
+    RTC_BackupWrite(RTC_BKP_LOG, 0U);
+
+    LogSeq = (uint8_t)(header >> LOG_BKP_SEQ_SHIFT);
+    count = header & 0xFFU;
+    for (i = 0U; (i < count) && (i < LOG_BKP_RECORDS); i++)
+    {
+      words = (uint32_t *)&LogSector[LogCount];
+      for (j = 0U; j < LOG_RECORD_WORDS; j++)
+      {
+        words[j] = RTC_BackupRead(RTC_BKP_LOG + 1U + (i * LOG_RECORD_WORDS) + j);
+      }
+      if (LOG_Crc(&LogSector[LogCount]) == LogSector[LogCount].Crc)
+      {
+        LogCount++;
+      }
+    }
+  }
+
+  LOG_Write(LOG_RESET, (__HAL_PWR_GET_FLAG(PWR_FLAG_SB) != RESET) ? 1U : 0U, RCC->CSR);
+  __HAL_RCC_CLEAR_RESET_FLAGS();
+}
+
+/**
+  * @brief  Log an event, from the main loop.
+  * @note   Writes the sector to the card when it is full.
+  * @param  Type: Event
+  * @param  Arg: Event specific
+  * @param  Value: Event specific
+  * @retval None
+  */
+void LOG_Write(LOG_TypeDef Type, uint16_t Arg, uint32_t Value)
+{
+  LOG_Append(Type, Arg, Value);
+
+  if (LogCount >= LOG_RECORDS_PER_SECTOR)
+  {
+    LOG_Flush();
+  }
+}
+
+/**
+  * @brief  Write the pending records to the card now, full sector or not.
+  * @note   The sector buffer is emptied even on a card error: the next
+  *         records are not held back by a missing card.
+  * @param  None
+  * @retval HAL_OK once the records are on the card
+  */
+HAL_StatusTypeDef LOG_Flush(void)
+{
+  HAL_StatusTypeDef status;
+
+  if (LogCount == 0U)
+  {
+    return HAL_OK;
+  }
+
+  memset(&LogSector[LogCount], 0xFF, (LOG_RECORDS_PER_SECTOR - LogCount) * sizeof(LOG_RecordTypeDef));
+  status = LOG_WriteSector();
+  LogCount = 0U;
+
+  return status;
+}
+
+/**
+  * @brief  Log the shutdown and keep the last pending records in the
+  *         backup registers.
+  * @note   Runs from the PVD interrupt: only register accesses.
+  * @param  None
+  * @retval None
+  */
+void LOG_Save(void)
+{
+  uint32_t first, count, i, j;
+  const uint32_t *words;
+
+  if (LogCount < LOG_RECORDS_PER_SECTOR)
+  {
+    LOG_Append(LOG_SHUTDOWN, 0U, 0U);
+  }
+
+  count = (LogCount < LOG_BKP_RECORDS) ? LogCount : LOG_BKP_RECORDS;
+  first = LogCount - count;
+  for (i = 0U; i < count; i++)
+  {
+    words = (const uint32_t *)&LogSector[first + i];
+    for (j = 0U; j < LOG_RECORD_WORDS; j++)
+    {
+      RTC_BackupWrite(RTC_BKP_LOG + 1U + (i * LOG_RECORD_WORDS) + j, words[j]);
+    }
+  }
+
+  RTC_BackupWrite(RTC_BKP_LOG, (LOG_BKP_MAGIC << LOG_BKP_MAGIC_SHIFT) |
+                               ((uint32_t)LogSeq << LOG_BKP_SEQ_SHIFT) | count);
+}
+
+/**
+  * @brief  Current time as a record time stamp.
+  * @note   The shadow registers are bypassed: DR is read again until it is
+  *         the same on both sides of TR, so midnight cannot tear the stamp.
+  * @param  None
+  * @retval Seconds since 2000-01-01 00:00:00
+  */
+uint32_t LOG_Now(void)
+{
+  uint32_t dr, tr, year, month, days;
+
+  do
+  {
+    dr = RTC->DR;
+    tr = RTC->TR;
+  } while (dr != RTC->DR);
+
+  year = __LL_RTC_CONVERT_BCD2BIN((dr & (RTC_DR_YT | RTC_DR_YU)) >> RTC_DR_YU_Pos);
+  month = __LL_RTC_CONVERT_BCD2BIN((dr & (RTC_DR_MT | RTC_DR_MU)) >> RTC_DR_MU_Pos);
+  days = __LL_RTC_CONVERT_BCD2BIN((dr & (RTC_DR_DT | RTC_DR_DU)) >> RTC_DR_DU_Pos);
+
+  /* Days since 2000-01-01, 2000 is a leap year */
+  days += (365U * year) + ((year + 3U) / 4U) + LogMonthDays[(month - 1U) % 12U] - 1U;
+  if ((month > 2U) && ((year % 4U) == 0U))
+  {
+    days++;
+  }
+
+  return (days * 86400U) +
+         (__LL_RTC_CONVERT_BCD2BIN((tr & (RTC_TR_HT | RTC_TR_HU)) >> RTC_TR_HU_Pos) * 3600U) +
+         (__LL_RTC_CONVERT_BCD2BIN((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> RTC_TR_MNU_Pos) * 60U) +
+          __LL_RTC_CONVERT_BCD2BIN((tr & (RTC_TR_ST | RTC_TR_SU)) >> RTC_TR_SU_Pos);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,169 +1,268 @@
-/**
-  ******************************************************************************
-  * @file    LCD/LCD_SegmentsDrive/Src/main.c 
-  * @author  MCD Application Team
-  * @brief   This example describes how to configure and use GPIOs through 
-  *          the STM32L1xx HAL API.
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
-  * All rights reserved.</center></h2>
-  *
-  * This software component is licensed by ST under BSD 3-Clause license,
-  * the "License"; You may not use this file except in compliance with the
-  * License. You may obtain a copy of the License at:
-  *                        opensource.org/licenses/BSD-3-Clause
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
-#include "main.h"
-#include "rtc.h"
-#include "stdio.h"
-
-
-/** @addtogroup STM32L1xx_HAL_Examples
-  * @{
-  */
-
-/** @addtogroup LCD_SegmentsDrive
-  * @{
-  */
-
-/* Private typedef -----------------------------------------------------------*/
-/* Private define ------------------------------------------------------------*/
-/* Private macro -------------------------------------------------------------*/
-/* Private variables ---------------------------------------------------------*/
-/* Private function prototypes -----------------------------------------------*/
-void SystemClock_Config(void);
-
-/* Private functions ---------------------------------------------------------*/
-
-/**
-  * @brief  Main program
-  * @param  None
-  * @retval None
-  */
-int main(void)
-{
-  
-  HAL_Init();
-
-  /* Configure the system clock to 32 MHz */
-  SystemClock_Config();
-
-  /* LCD GLASS Initialization */
-  BSP_LCD_GLASS_Init();
-  
-  /* Initialize RTC */
-  RTC_Init();
-
-  HAL_PWR_EnableSleepOnExit();  
-
-  HAL_PWR_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFI);
-
-  /* Infinite loop */
-  while (1)
-  {
-  }
-}
-
-void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
-{   
-  uint8_t h, m, s;
-  uint8_t time[]= "00:00:00";
-  
-  RTC_GetTime(&h, &m, &s);
-  
-  sprintf((char *)time,"%.2d:%.2d:%.2d",h, m, s);
-  BSP_LCD_GLASS_DisplayString(time);   
-  
-}
-
-
-/**
-  * @brief  System Clock Configuration
-  *         The system Clock is configured as follow :
-  *            System Clock source            = PLL (HSI)
-  *            SYSCLK(Hz)                     = 32000000
-  *            HCLK(Hz)                       = 32000000
-  *            AHB Prescaler                  = 1
-  *            APB1 Prescaler                 = 1
-  *            APB2 Prescaler                 = 1
-  *            HSI Frequency(Hz)              = 16000000
-  *            PLLMUL                         = 6
-  *            PLLDIV                         = 3
-  *            Flash Latency(WS)              = 1
-  * @retval None
-  */
-void SystemClock_Config(void)
-{
-  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-
-  /* Enable HSE Oscillator and Activate PLL with HSE as source */
-  RCC_OscInitStruct.OscillatorType      = RCC_OSCILLATORTYPE_HSI;
-  RCC_OscInitStruct.HSIState            = RCC_HSI_ON;
-  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
-  RCC_OscInitStruct.PLL.PLLState        = RCC_PLL_ON;
-  RCC_OscInitStruct.PLL.PLLSource       = RCC_PLLSOURCE_HSI;
-  RCC_OscInitStruct.PLL.PLLMUL          = RCC_PLL_MUL6;
-  RCC_OscInitStruct.PLL.PLLDIV          = RCC_PLL_DIV3;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-    /* Initialization Error */
-    while(1); 
-  }
-
-  /* Set Voltage scale1 as MCU will run at 32MHz */
-  __HAL_RCC_PWR_CLK_ENABLE();
-  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
-  
-  /* Poll VOSF bit of in PWR_CSR. Wait until it is reset to 0 */
-  while (__HAL_PWR_GET_FLAG(PWR_FLAG_VOS) != RESET) {};
-
-  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2
-  clocks dividers */
-  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_1) != HAL_OK)
-  {
-    /* Initialization Error */
-    while(1); 
-  }
-}
-#ifdef  USE_FULL_ASSERT
-
-/**
-  * @brief  Reports the name of the source file and the source line number
-  *         where the assert_param error has occurred.
-  * @param  file: pointer to the source file name
-  * @param  line: assert_param error line source number
-  * @retval None
-  */
-void assert_failed(uint8_t *file, uint32_t line)
-{
-  /* User can add his own implementation to report the file name and line number,
-     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
-
-  /* Infinite loop */
-  while (1)
-  {
-  }
-}
-#endif
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+  ******************************************************************************
+  * @file    LCD/LCD_SegmentsDrive/Src/main.c 
+  * @author  MCD Application Team
+  * @brief   This example describes how to configure and use GPIOs through 
+  *          the STM32L1xx HAL API.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "rtc.h"
+#include "event.h"
+#include "clock.h"
+#include "display.h"
+#include "battery.h"
+#include "sense.h"
+#include "light.h"
+#include "power.h"
+#include "profile.h"
+#include "log.h"
+#include "chime.h"
+#include "sync.h"
+#include "watchdog.h"
+#include "fault.h"
+#include "rtos.h"
+
+
+/** @addtogroup STM32L1xx_HAL_Examples
+  * @{
+  */
+
+/** @addtogroup LCD_SegmentsDrive
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Main program
+  * @param  None
+  * @retval None
+  */
+int main(void)
+{
+  
+  HAL_Init();
+
+  /* Back to STANDBY at once if woken up while the supply is still low */
+  POWER_CheckSupply();
+
+  /* Back from deep idle: the frame is on the display at once. The PLL is
+     not started, the MSI being the system clock after STOP mode anyway */
+  if (POWER_Resume() == 0U)
+  {
+    /* Configure the system clock to 32 MHz */
+    SystemClock_Config();
+  }
+
+  /* Cycle counter for ISR and handler measurements */
+  PROF_Init();
+
+  /* Glass LCD or SPI TFT, depending on the board, unless resumed */
+  DISPLAY_Init();
+
+  /* DAC chimes, clocks gated until a chime plays */
+  CHIME_Init();
+  
+  /* Event handlers must be in place before the RTC posts anything */
+  EVT_Init();
+  CLOCK_Init();
+  
+  /* Initialize RTC */
+  RTC_Init();
+
+  /* Reset cause and stage reached, before the log clears the flags */
+  WDG_Init();
+
+  /* Event log, records kept across STANDBY and reset cause */
+  LOG_Init();
+
+  /* Fault captured before this reset, if any */
+  FAULT_Init();
+
+  /* Keys and replay counter of the authenticated sync packets */
+  SYNC_Init();
+#if defined(USE_SYNC_BENCHMARK)
+  SYNC_Benchmark();
+#endif
+
+  /* ADC scan of the sensors, first sample set included */
+  SENSE_Init();
+#if defined(USE_LIGHT_SENSOR)
+  /* Display blanked in the dark */
+  LIGHT_Init();
+#endif
+
+  /* Supply monitor, first measurement included */
+  BATT_Init();
+
+  /* Brown-out handling, then resume from a power loss if any */
+  POWER_Init();
+  POWER_Restore();
+
+  /* Supervision, refreshed on the 1 s wake-up from now on */
+  WDG_Start();
+
+#if defined(USE_FREERTOS)
+  /* The tasks run the event handlers, the kernel idles in STOP mode */
+  RTOS_Start();
+#else
+  /* Infinite loop: run pending work, then STOP until the next interrupt */
+  while (1)
+  {
+    EVT_Dispatch();
+    EVT_Idle();
+  }
+#endif
+}
+
+/**
+  * @brief  Wake-up timer callback, called from RTC_WKUP_IRQHandler.
+  * @note   Only posts the event: the display is refreshed from the main loop.
+  *         While the fast tick samples the user button, EVT_RTC_WAKEUP is
+  *         still posted once a second, on the RTC seconds boundary.
+  * @note   In the FreeRTOS build the wake-up timer is the kernel tick: the
+  *         fast tick always runs while awake.
+  * @param  hrtc: RTC handle
+  * @retval None
+  */
+void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{   
+  static uint32_t last_second;
+  uint32_t second = RTC_GetStamp() / RTC_STAMP_FREQ;
+  uint32_t fast = RTC_WakeUpFast();
+
+#if defined(USE_FREERTOS)
+  RTOS_TickHandler();
+#endif
+
+  if (fast != 0U)
+  {
+    if ((fast & RTC_FAST_BUTTON) != 0U)
+    {
+      EVT_Post(EVT_SRC_RTC, EVT_BUTTON_TICK, 0U);
+    }
+    if ((fast & RTC_FAST_TOUCH) != 0U)
+    {
+      EVT_Post(EVT_SRC_RTC, EVT_TOUCH_TICK, 0U);
+    }
+  }
+
+  /* Fast ticks, and kernel ticks, within the second */
+  if (second == last_second)
+  {
+    return;
+  }
+  last_second = second;
+
+  /* The processing of this wake-up is timed by the WWDG */
+  WDG_Arm();
+  EVT_Post(EVT_SRC_RTC, EVT_RTC_WAKEUP, 0U);
+}
+
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follow :
+  *            System Clock source            = PLL (HSI)
+  *            SYSCLK(Hz)                     = 32000000
+  *            HCLK(Hz)                       = 32000000
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 1
+  *            APB2 Prescaler                 = 1
+  *            HSI Frequency(Hz)              = 16000000
+  *            PLLMUL                         = 6
+  *            PLLDIV                         = 3
+  *            Flash Latency(WS)              = 1
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+
+  /* Enable HSE Oscillator and Activate PLL with HSE as source */
+  RCC_OscInitStruct.OscillatorType      = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState            = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState        = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource       = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLMUL          = RCC_PLL_MUL6;
+  RCC_OscInitStruct.PLL.PLLDIV          = RCC_PLL_DIV3;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1); 
+  }
+
+  /* Set Voltage scale1 as MCU will run at 32MHz */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+  
+  /* Poll VOSF bit of in PWR_CSR. Wait until it is reset to 0 */
+  while (__HAL_PWR_GET_FLAG(PWR_FLAG_VOS) != RESET) {};
+
+  /* Select PLL as system clock source and configure the HCLK, PCLK1 and PCLK2
+  clocks dividers */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_1) != HAL_OK)
+  {
+    /* Initialization Error */
+    while(1); 
+  }
+}
+#ifdef  USE_FULL_ASSERT
+
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+#endif
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
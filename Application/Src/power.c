@@ -0,0 +1,462 @@
+/**
+  ******************************************************************************
+  * @file    power.c
+  * @author  MCD Application Team
+  * @brief   Supply loss handling: PVD warning, fast shutdown to STANDBY with
+  *          a backup register snapshot, and resume when the supply is back.
+  *          Deep idle: STANDBY with the display off while nobody uses the
+  *          clock, resumed on the user button or the countdown alarm.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The PVD is armed at POWER_PVD_WARNING. When VDD falls under it,
+        EVT_BATTERY_LOW is posted and the PVD moves to POWER_PVD_SHUTDOWN.
+    (#) Under POWER_PVD_SHUTDOWN, POWER_Shutdown() runs in the PVD interrupt
+        itself so that it completes within the hold-up time: the display
+        mode and the timers are stored in RTC backup registers, the display
+        is switched off and the part enters STANDBY with the RTC running.
+    (#) The RTC wakes the part every POWER_RECHECK_S seconds. Right after
+        reset, POWER_CheckSupply() goes back to STANDBY if VDD is still low,
+        before any clock or peripheral is configured.
+    (#) Once the supply is back, POWER_Restore() brings the snapshot back:
+        nothing is read from the data EEPROM.
+    (#) With USE_DEEP_IDLE, POWER_OnSecond() counts the seconds without a
+        button press or touch, reported by POWER_Activity(), in the dark
+        only with USE_LIGHT_SENSOR. After POWER_DEEP_IDLE_S, POWER_DeepIdle()
+        takes the same snapshot, with the frame of the display, and enters
+        STANDBY without the 1 s wake-up: only the WKUP pin of the user
+        button and the countdown alarm B wake the part up. The hours are
+        not chimed meanwhile.
+    (#) After a deep idle wake-up, POWER_Resume(), right after
+        POWER_CheckSupply(), shows the saved frame on the MSI clock, the
+        digits of the time read from the RTC registers. main() then skips
+        SystemClock_Config(): the MSI is the system clock after the first
+        STOP mode anyway.
+    (#) Once started, the IWDG of watchdog.c runs on in STANDBY mode and
+        cannot be stopped but by a reset. Both STANDBY entries then go
+        through a software reset, POWER_CheckSupply() entering STANDBY
+        right after it with the IWDG stopped.
+    (#) The core runs on the 2.1 MHz MSI after the first STOP mode. A short
+        burst the MSI makes slow, the ADC scan of sense.c or a TFT repaint,
+        runs on the 16 MHz HSI between POWER_ClockHSI() and
+        POWER_ClockRestore(). A chime playing meanwhile keeps its pitch.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "power.h"
+#include "clock.h"
+#include "display.h"
+#include "chrono.h"
+#include "event.h"
+#include "rtc.h"
+#include "log.h"
+#include "light.h"
+#include "chime.h"
+#include "watchdog.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* RTC_BKP_POWER content: magic in the upper half, display mode below */
+#define POWER_SNAPSHOT_MAGIC    0xB0F5U
+#define POWER_SNAPSHOT_SHIFT    16U
+#define POWER_SNAPSHOT_MODE     0xFFU
+#define POWER_SNAPSHOT_DEEP     0x100U   /* Deep idle, display frame saved */
+#define POWER_SNAPSHOT_PENDING  0x200U   /* STANDBY to enter after the reset */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+extern RTC_HandleTypeDef hrtc;
+
+static uint32_t PowerPvdLevel;
+static uint32_t PowerIdleSeconds;      /* Seconds without user input       */
+
+/* Private function prototypes -----------------------------------------------*/
+static void POWER_ArmPVD(uint32_t Level);
+static void POWER_EnterStandby(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Program the PVD level, interrupt on VDD falling under it.
+  * @param  Level: PWR_PVDLEVEL_x
+  * @retval None
+  */
+static void POWER_ArmPVD(uint32_t Level)
+{
+  PWR_PVDTypeDef spvd;
+
+  spvd.PVDLevel = Level;
+  spvd.Mode = PWR_PVD_MODE_IT_RISING;
+  HAL_PWR_ConfigPVD(&spvd);
+  PowerPvdLevel = Level;
+}
+
+/**
+  * @brief  Clear the wake-up sources already triggered and enter STANDBY.
+  * @note   A pending RTC flag would wake the part up at once.
+  * @note   With the IWDG running, the part is reset first: STANDBY is
+  *         entered by POWER_CheckSupply(), the IWDG being stopped.
+  * @param  None
+  * @retval None
+  */
+static void POWER_EnterStandby(void)
+{
+  if (WDG_IsRunning() != 0U)
+  {
+    RTC_BackupWrite(RTC_BKP_POWER, RTC_BackupRead(RTC_BKP_POWER) | POWER_SNAPSHOT_PENDING);
+    NVIC_SystemReset();
+  }
+
+  HAL_PWR_DisablePVD();
+
+  RTC->ISR = ~(RTC_ISR_WUTF | RTC_ISR_ALRAF | RTC_ISR_ALRBF | RTC_ISR_INIT) |
+             (RTC->ISR & RTC_ISR_INIT);
+  __HAL_PWR_CLEAR_FLAG(PWR_FLAG_WU);
+
+  HAL_PWR_EnterSTANDBYMode();
+}
+
+/**
+  * @brief  Go back to STANDBY right after a STANDBY wake-up if the supply
+  *         is still low, or enter it after the reset of POWER_EnterStandby().
+  * @note   To be called first thing after HAL_Init(), on the MSI clock: the
+  *         check costs a PVD settling delay and a few register accesses.
+  * @param  None
+  * @retval None
+  */
+void POWER_CheckSupply(void)
+{
+  PWR_PVDTypeDef spvd;
+  uint32_t snapshot = RTC_BackupRead(RTC_BKP_POWER);
+
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  if ((snapshot >> POWER_SNAPSHOT_SHIFT) != POWER_SNAPSHOT_MAGIC)
+  {
+    return;
+  }
+
+  /* The wake-up timer and alarm B kept their setting across the reset */
+  if ((snapshot & POWER_SNAPSHOT_PENDING) != 0U)
+  {
+    HAL_PWR_EnableBkUpAccess();
+    RTC_BackupWrite(RTC_BKP_POWER, snapshot & ~POWER_SNAPSHOT_PENDING);
+    if ((snapshot & POWER_SNAPSHOT_DEEP) != 0U)
+    {
+      HAL_PWR_EnableWakeUpPin(POWER_WAKEUP_PIN);
+    }
+    POWER_EnterStandby();
+  }
+
+  if (__HAL_PWR_GET_FLAG(PWR_FLAG_SB) == RESET)
+  {
+    return;
+  }
+
+  spvd.PVDLevel = POWER_PVD_SHUTDOWN;
+  spvd.Mode = PWR_PVD_MODE_NORMAL;
+  HAL_PWR_ConfigPVD(&spvd);
+  HAL_PWR_EnablePVD();
+  HAL_Delay(1);
+
+  if (__HAL_PWR_GET_FLAG(PWR_FLAG_PVDO) != RESET)
+  {
+    HAL_PWR_EnableBkUpAccess();
+    POWER_EnterStandby();
+  }
+
+  HAL_PWR_DisablePVD();
+}
+
+/**
+  * @brief  Show the saved frame after a deep idle wake-up.
+  * @note   To be called right after POWER_CheckSupply(), on the MSI clock.
+  *         The time of day is brought up to date from the RTC registers.
+  *         The snapshot is left for POWER_Restore().
+  * @param  None
+  * @retval Non zero after a deep idle wake-up, zero otherwise
+  */
+uint32_t POWER_Resume(void)
+{
+  DISPLAY_FrameTypeDef frame;
+  uint32_t snapshot = RTC_BackupRead(RTC_BKP_POWER);
+
+  if ((__HAL_PWR_GET_FLAG(PWR_FLAG_SB) == RESET) ||
+      ((snapshot >> POWER_SNAPSHOT_SHIFT) != POWER_SNAPSHOT_MAGIC) ||
+      ((snapshot & POWER_SNAPSHOT_DEEP) == 0U))
+  {
+    return 0U;
+  }
+
+  DISPLAY_GetSaved(&frame);
+  if ((CLOCK_ModeTypeDef)(snapshot & POWER_SNAPSHOT_MODE) == CLOCK_MODE_TIME)
+  {
+    CLOCK_TimeFrame(&frame);
+  }
+  DISPLAY_Resume(&frame);
+  return 1U;
+}
+
+/**
+  * @brief  Arm the PVD at the warning level.
+  * @param  None
+  * @retval None
+  */
+void POWER_Init(void)
+{
+  POWER_ArmPVD(POWER_PVD_WARNING);
+  HAL_PWR_EnablePVD();
+
+  /* Highest priority: the shutdown runs in this interrupt */
+  HAL_NVIC_SetPriority(PVD_IRQn, EVT_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(PVD_IRQn);
+}
+
+/**
+  * @brief  Resume from a power loss snapshot, if any.
+  * @note   To be called once the clock application and the RTC are
+  *         initialized.
+  * @param  None
+  * @retval None
+  */
+void POWER_Restore(void)
+{
+  uint32_t snapshot = RTC_BackupRead(RTC_BKP_POWER);
+
+  __HAL_PWR_CLEAR_FLAG(PWR_FLAG_SB);
+  HAL_PWR_DisableWakeUpPin(POWER_WAKEUP_PIN);
+  PowerIdleSeconds = 0U;
+
+  if ((snapshot >> POWER_SNAPSHOT_SHIFT) != POWER_SNAPSHOT_MAGIC)
+  {
+    return;
+  }
+
+  /* A snapshot is used once */
+  RTC_BackupWrite(RTC_BKP_POWER, 0U);
+
+  CHRONO_Restore();
+  CLOCK_SetMode((CLOCK_ModeTypeDef)(snapshot & POWER_SNAPSHOT_MODE));
+}
+
+/**
+  * @brief  Arm the warning level again once the supply has recovered.
+  * @param  mv: Measured supply, in mV
+  * @retval None
+  */
+void POWER_SupplyUpdate(uint32_t mv)
+{
+  if ((PowerPvdLevel != POWER_PVD_WARNING) && (mv >= POWER_REARM_MV))
+  {
+    HAL_NVIC_DisableIRQ(PVD_IRQn);
+    POWER_ArmPVD(POWER_PVD_WARNING);
+    HAL_NVIC_EnableIRQ(PVD_IRQn);
+  }
+}
+
+/**
+  * @brief  Save the application state and enter STANDBY.
+  * @note   Runs from the PVD interrupt, which may preempt the main loop in
+  *         the middle of a HAL call: the snapshot and the RTC wake-up are
+  *         register writes, taking no HAL lock. The TFT backend of
+  *         DISPLAY_Off() is the exception: it polls the sleep commands with
+  *         HAL_SPI_Abort() and HAL_SPI_Transmit(), which give up with
+  *         HAL_BUSY if the main loop was polling a command itself. The panel
+  *         is then left lit, the part enters STANDBY all the same.
+  * @param  None
+  * @retval None
+  */
+void POWER_Shutdown(void)
+{
+  /* Snapshot in the backup registers */
+  CHRONO_Save();
+  LOG_Save();
+  RTC_BackupWrite(RTC_BKP_POWER, (POWER_SNAPSHOT_MAGIC << POWER_SNAPSHOT_SHIFT) |
+                                 ((uint32_t)CLOCK_GetMode() & POWER_SNAPSHOT_MODE));
+
+  /* Blank the display: no more bias current through the glass segments,
+     the TFT controller sleeps */
+  DISPLAY_Off();
+
+  /* Only wake up to check whether the supply is back */
+  RTC_SetWakeUpSeconds(POWER_RECHECK_S);
+
+  POWER_EnterStandby();
+}
+
+/**
+  * @brief  Count the seconds without user input and enter deep idle after
+  *         POWER_DEEP_IDLE_S, called on the RTC wake-up.
+  * @param  None
+  * @retval None
+  */
+void POWER_OnSecond(void)
+{
+#if defined(USE_LIGHT_SENSOR)
+  if (LIGHT_IsDark() == 0U)
+  {
+    PowerIdleSeconds = 0U;
+    return;
+  }
+#endif
+
+  if (CHIME_IsPlaying() != 0U)
+  {
+    return;
+  }
+
+  if (++PowerIdleSeconds >= POWER_DEEP_IDLE_S)
+  {
+    POWER_DeepIdle();
+  }
+}
+
+/**
+  * @brief  A button press or touch: restart the deep idle count.
+  * @param  None
+  * @retval None
+  */
+void POWER_Activity(void)
+{
+  PowerIdleSeconds = 0U;
+}
+
+/**
+  * @brief  Save the application state and the display frame, and enter
+  *         STANDBY until the user button or the countdown alarm.
+  * @note   From the main loop.
+  * @param  None
+  * @retval None
+  */
+void POWER_DeepIdle(void)
+{
+  LOG_Write(LOG_DEEP_IDLE, 0U, PowerIdleSeconds);
+
+  CHRONO_Save();
+  LOG_Save();
+  DISPLAY_Save();
+  RTC_BackupWrite(RTC_BKP_POWER, (POWER_SNAPSHOT_MAGIC << POWER_SNAPSHOT_SHIFT) |
+                                 POWER_SNAPSHOT_DEEP |
+                                 ((uint32_t)CLOCK_GetMode() & POWER_SNAPSHOT_MODE));
+
+  DISPLAY_Off();
+
+  /* Alarm B stays armed if the countdown runs */
+  HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+  HAL_PWR_EnableWakeUpPin(POWER_WAKEUP_PIN);
+
+  POWER_EnterStandby();
+}
+
+/**
+  * @brief  Start the HSI, and run the core on it if it is on the MSI.
+  * @note   16 MHz needs one flash wait state, which a resume on the MSI
+  *         (POWER_Resume()) has not set. Both the voltage range 1 of
+  *         SystemClock_Config() and the range 2 of the reset allow it.
+  * @note   On the PLL the core is left as is, the HSI being its input.
+  * @param  Saved: Receives the state for POWER_ClockRestore()
+  * @retval HAL_OK once the HSI runs, HAL_TIMEOUT if it did not start
+  */
+HAL_StatusTypeDef POWER_ClockHSI(POWER_ClockTypeDef *Saved)
+{
+  HAL_StatusTypeDef status;
+
+  Saved->CoreClock = SystemCoreClock;
+  Saved->Latency   = __HAL_FLASH_GET_LATENCY();
+  Saved->HsiWasOn  = (READ_BIT(RCC->CR, RCC_CR_HSION) != 0U) ? 1U : 0U;
+  Saved->Switched  = (READ_BIT(RCC->CFGR, RCC_CFGR_SWS) == RCC_CFGR_SWS_MSI) ? 1U : 0U;
+  Saved->Reserved  = 0U;
+
+  SET_BIT(RCC->CR, RCC_CR_HSION);
+  if (Saved->Switched == 0U)
+  {
+    return HAL_WaitFlag(&RCC->CR, RCC_CR_HSIRDY, RCC_CR_HSIRDY, POWER_CLOCK_TIMEOUT_MS);
+  }
+
+  /* The switch takes place as soon as the HSI is ready */
+  __HAL_FLASH_SET_LATENCY(FLASH_LATENCY_1);
+  MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, RCC_CFGR_SW_HSI);
+  status = HAL_WaitFlag(&RCC->CFGR, RCC_CFGR_SWS, RCC_CFGR_SWS_HSI, POWER_CLOCK_TIMEOUT_MS);
+  if (status == HAL_OK)
+  {
+    SystemCoreClock = HSI_VALUE;
+    CHIME_ClockUpdate();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Give the core back its clock of POWER_ClockHSI(), and stop the
+  *         HSI if it was off.
+  * @param  Saved: State saved by POWER_ClockHSI()
+  * @retval None
+  */
+void POWER_ClockRestore(const POWER_ClockTypeDef *Saved)
+{
+  if (Saved->Switched != 0U)
+  {
+    /* The HSI cannot be stopped while it is the system clock */
+    MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, RCC_CFGR_SW_MSI);
+    (void)HAL_WaitFlag(&RCC->CFGR, RCC_CFGR_SWS, RCC_CFGR_SWS_MSI, POWER_CLOCK_TIMEOUT_MS);
+    __HAL_FLASH_SET_LATENCY(Saved->Latency);
+    if (SystemCoreClock != Saved->CoreClock)
+    {
+      SystemCoreClock = Saved->CoreClock;
+      CHIME_ClockUpdate();
+    }
+  }
+
+  if (Saved->HsiWasOn == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+  }
+}
+
+/**
+  * @brief  PVD callback, called from PVD_IRQHandler.
+  * @param  None
+  * @retval None
+  */
+void HAL_PWR_PVDCallback(void)
+{
+  if (PowerPvdLevel == POWER_PVD_WARNING)
+  {
+    POWER_ArmPVD(POWER_PVD_SHUTDOWN);
+    EVT_Post(EVT_SRC_PVD, EVT_BATTERY_LOW, 0U);
+  }
+  else
+  {
+    POWER_Shutdown();
+  }
+}
+
+/**
+  * @brief  This function handles PVD interrupt request.
+  * @param  None
+  * @retval None
+  */
+void PVD_IRQHandler(void)
+{
+  HAL_PWR_PVD_IRQHandler();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
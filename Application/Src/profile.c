@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    profile.c
+  * @author  MCD Application Team
+  * @brief   Cycle-accurate measurements based on the DWT cycle counter.
+  *          The statistics are kept in RAM and are meant to be read with the
+  *          debugger (ProfStats) or reported by the application.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "profile.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+PROF_StatTypeDef ProfStats[PROF_ID_COUNT];
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Start the DWT cycle counter.
+  * @note   The counter does not need a debugger to be attached, only the
+  *         trace enable bit. It is stopped with the core clock in STOP mode,
+  *         so it only ever measures awake time.
+  * @param  None
+  * @retval None
+  */
+void PROF_Init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Record one sample of a measured section.
+  * @param  Id: Section identifier
+  * @param  StartCycles: PROF_CYCLES() value taken at the start of the section
+  * @retval None
+  */
+void PROF_Record(PROF_IdTypeDef Id, uint32_t StartCycles)
+{
+  PROF_RecordValue(Id, PROF_CYCLES() - StartCycles);
+}
+
+/**
+  * @brief  Record one sample measured in another unit than cycles.
+  * @param  Id: Section identifier
+  * @param  Value: Sample value
+  * @retval None
+  */
+void PROF_RecordValue(PROF_IdTypeDef Id, uint32_t Value)
+{
+  PROF_StatTypeDef *stat = &ProfStats[Id];
+
+  stat->Count++;
+  stat->Last = Value;
+  if (Value > stat->Max)
+  {
+    stat->Max = Value;
+  }
+}
+
+/**
+  * @brief  HAL flag wait callback, called by HAL_WaitFlag() and
+  *         HAL_WaitFlagEvent().
+  * @param  Spins: Times the flag was found not ready
+  * @retval None
+  */
+void HAL_WaitFlagCallback(uint32_t Spins)
+{
+  PROF_RecordValue(PROF_HAL_WAIT, Spins);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
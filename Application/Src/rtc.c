@@ -1,156 +1,428 @@
-/**
-  ******************************************************************************
-  * @file    rtc.c
-  * @author  MCD Application Team
-  * @brief   lcd 7 segments driver
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
-  *
-  * Redistribution and use in source and binary forms, with or without modification,
-  * are permitted provided that the following conditions are met:
-  *   1. Redistributions of source code must retain the above copyright notice,
-  *      this list of conditions and the following disclaimer.
-  *   2. Redistributions in binary form must reproduce the above copyright notice,
-  *      this list of conditions and the following disclaimer in the documentation
-  *      and/or other materials provided with the distribution.
-  *   3. Neither the name of STMicroelectronics nor the names of its contributors
-  *      may be used to endorse or promote products derived from this software
-  *      without specific prior written permission.
-  *
-  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-  *
-  ******************************************************************************
-  */
-
-/* Includes ------------------------------------------------------------------*/
-#include "rtc.h"
-
-
-/* Private typedef -----------------------------------------------------------*/
-/* Private define ------------------------------------------------------------*/
-#define RTC_ASYNCH_PREDIV  0x7F   /* LSE as RTC clock */
-#define RTC_SYNCH_PREDIV   0x00FF /* LSE as RTC clock */   
-/* Private macro -------------------------------------------------------------*/
-
-//#define USE_LSE
-
-/* Private variables ---------------------------------------------------------*/
-RTC_HandleTypeDef hrtc;
-uint32_t vbat_value;
-/* Private function prototypes -----------------------------------------------*/
-
-/**
-  * @brief  Function.
-  * @param  None
-  * @retval None
-  */
-void RTC_SetTime(uint8_t hour, uint8_t min)
-{
-  RTC_TimeTypeDef stime;
-
-  stime.Hours = hour;
-  stime.Minutes = min;
-  stime.Seconds = 0x00;
-  stime.TimeFormat = RTC_HOURFORMAT12_PM;
-  stime.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
-  stime.StoreOperation = RTC_STOREOPERATION_RESET;
-  
-  HAL_RTC_SetTime(&hrtc,&stime,RTC_FORMAT_BIN);
-}
-
-/**
-  * @brief  Function.
-  * @param  None
-  * @retval None
-  */
-void RTC_GetTime(uint8_t *hour, uint8_t *min, uint8_t *sec)
-{
-  RTC_DateTypeDef sdate;
-  RTC_TimeTypeDef stime;
-  
-  /* Get the RTC current Time */
-  HAL_RTC_GetTime(&hrtc, &stime, RTC_FORMAT_BIN);
-  HAL_RTC_GetDate(&hrtc, &sdate, RTC_FORMAT_BIN);
-  
-  *hour = stime.Hours;
-  *min = stime.Minutes;
-  *sec = stime.Seconds;  
-}
-
-/**
-  * @brief  Function.
-  * @param  None
-  * @retval None
-  */
-void RTC_Init(void)
-{ 
-  
- /* Configure the RTC */
-  hrtc.Instance = RTC; 
-  hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
-  hrtc.Init.AsynchPrediv = RTC_ASYNCH_PREDIV;
-  hrtc.Init.SynchPrediv = RTC_SYNCH_PREDIV;
-  hrtc.Init.OutPut = RTC_OUTPUT_DISABLE;
-  hrtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
-  hrtc.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
-  HAL_RTC_Init(&hrtc);
-  
-  
-  HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 0x0, 0);
-  
-  /* Enable the RTC global Interrupt */
-  HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
-  
-  HAL_RTCEx_DeactivateWakeUpTimer(&hrtc) ;
-  HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, 0x800, RTC_WAKEUPCLOCK_RTCCLK_DIV16);    
-}
-
-void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
-{
-  RCC_OscInitTypeDef        RCC_OscInitStruct;
-  RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
-
-  __HAL_RCC_PWR_CLK_ENABLE();
-  HAL_PWR_EnableBkUpAccess();
-  
-  RCC_OscInitStruct.OscillatorType =  RCC_OSCILLATORTYPE_LSI | RCC_OSCILLATORTYPE_LSE;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
-  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
-  RCC_OscInitStruct.LSIState = RCC_LSI_OFF;
-  HAL_RCC_OscConfig(&RCC_OscInitStruct);
-  
-  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
-  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
-  HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
-  __HAL_RCC_RTC_ENABLE(); 
-}
-
-/**
-  * @brief  This function handles RTC wakeup interrupt request.
-  * @param  None
-  * @retval None
-  */
-void RTC_WKUP_IRQHandler(void)
-{
-  HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
-}
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+/**
+  ******************************************************************************
+  * @file    rtc.c
+  * @author  MCD Application Team
+  * @brief   lcd 7 segments driver
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtc.h"
+#include "event.h"
+#include "profile.h"
+
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define BCD2BIN(__V__)     ((((__V__) >> 4U) * 10U) + ((__V__) & 0x0FU))
+
+//#define USE_LSE
+
+/* Private variables ---------------------------------------------------------*/
+RTC_HandleTypeDef hrtc;
+
+static __IO uint32_t RtcWakeUpFast;   /* RTC_FAST_xxx users */
+/* Private function prototypes -----------------------------------------------*/
+
+/**
+  * @brief  Function.
+  * @param  None
+  * @retval None
+  */
+void RTC_SetTime(uint8_t hour, uint8_t min)
+{
+  RTC_TimeTypeDef stime;
+
+  stime.Hours = hour;
+  stime.Minutes = min;
+  stime.Seconds = 0x00;
+  stime.TimeFormat = RTC_HOURFORMAT12_PM;
+  stime.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+  stime.StoreOperation = RTC_STOREOPERATION_RESET;
+  
+  /* The HAL time base is read from the calendar */
+  RTC_TickHold();
+  HAL_RTC_SetTime(&hrtc,&stime,RTC_FORMAT_BIN);
+  RTC_TickRebase();
+}
+
+/**
+  * @brief  Set the calendar from a count of seconds.
+  * @note   Same time base as LOG_Now(), until the end of 2099.
+  * @param  Seconds: Seconds since 2000-01-01 00:00:00 (a Saturday)
+  * @retval None
+  */
+void RTC_SetSeconds(uint32_t Seconds)
+{
+  static const uint8_t month_days[12] = { 31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U };
+  RTC_DateTypeDef sdate;
+  RTC_TimeTypeDef stime;
+  uint32_t days = Seconds / 86400U;
+  uint32_t year = 0U, month = 0U, length;
+
+  stime.Hours = (uint8_t)((Seconds / 3600U) % 24U);
+  stime.Minutes = (uint8_t)((Seconds / 60U) % 60U);
+  stime.Seconds = (uint8_t)(Seconds % 60U);
+  stime.TimeFormat = RTC_HOURFORMAT12_AM;
+  stime.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+  stime.StoreOperation = RTC_STOREOPERATION_RESET;
+
+  sdate.WeekDay = (uint8_t)(((days + 5U) % 7U) + 1U);
+  length = 366U;
+  while (days >= length)
+  {
+    days -= length;
+    year++;
+    length = ((year % 4U) == 0U) ? 366U : 365U;
+  }
+  length = month_days[0];
+  while (days >= length)
+  {
+    days -= length;
+    month++;
+    length = month_days[month] + (((month == 1U) && ((year % 4U) == 0U)) ? 1U : 0U);
+  }
+  sdate.Year = (uint8_t)year;
+  sdate.Month = (uint8_t)(month + 1U);
+  sdate.Date = (uint8_t)(days + 1U);
+
+  /* The HAL time base is read from the calendar */
+  RTC_TickHold();
+  HAL_RTC_SetTime(&hrtc, &stime, RTC_FORMAT_BIN);
+  HAL_RTC_SetDate(&hrtc, &sdate, RTC_FORMAT_BIN);
+  RTC_TickRebase();
+}
+
+/**
+  * @brief  Function.
+  * @param  None
+  * @retval None
+  */
+void RTC_GetTime(uint8_t *hour, uint8_t *min, uint8_t *sec)
+{
+  RTC_DateTypeDef sdate;
+  RTC_TimeTypeDef stime;
+  
+  /* Get the RTC current Time */
+  HAL_RTC_GetTime(&hrtc, &stime, RTC_FORMAT_BIN);
+  HAL_RTC_GetDate(&hrtc, &sdate, RTC_FORMAT_BIN);
+  
+  *hour = stime.Hours;
+  *min = stime.Minutes;
+  *sec = stime.Seconds;  
+}
+
+/**
+  * @brief  Read the time of day with sub-second resolution.
+  * @note   Shadow registers are bypassed (see RTC_Init()) so the counters are
+  *         read directly; SSR is read twice to make sure TR was not sampled
+  *         across a second boundary. No RSF synchronization is needed after
+  *         STOP mode.
+  * @param  None
+  * @retval Time since 00:00:00, in 1/RTC_STAMP_FREQ s
+  */
+uint32_t RTC_GetStamp(void)
+{
+  uint32_t ssr, tr, sec;
+
+  do
+  {
+    ssr = RTC->SSR;
+    tr  = RTC->TR;
+  } while (ssr != RTC->SSR);
+
+  /* A pending shift can leave SSR above PREDIV_S for a moment */
+  if (ssr > RTC_SYNCH_PREDIV)
+  {
+    ssr = RTC_SYNCH_PREDIV;
+  }
+
+  sec = (BCD2BIN((tr & (RTC_TR_HT | RTC_TR_HU)) >> RTC_TR_HU_Pos) * 3600U) +
+        (BCD2BIN((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> RTC_TR_MNU_Pos) * 60U) +
+         BCD2BIN((tr & (RTC_TR_ST | RTC_TR_SU)) >> RTC_TR_SU_Pos);
+
+  return (sec * RTC_STAMP_FREQ) + (RTC_SYNCH_PREDIV - ssr);
+}
+
+/**
+  * @brief  Program Alarm B to fire at a given time stamp.
+  * @note   All sub-second bits are compared, so the alarm fires with the
+  *         RTC_STAMP_FREQ resolution of the stamp.
+  * @param  stamp: Time of day, in 1/RTC_STAMP_FREQ s (see RTC_GetStamp())
+  * @retval None
+  */
+void RTC_SetAlarmB(uint32_t stamp)
+{
+  RTC_AlarmTypeDef salarm = {0};
+  uint32_t sec;
+
+  stamp %= RTC_STAMP_PER_DAY;
+  sec = stamp / RTC_STAMP_FREQ;
+
+  salarm.AlarmTime.Hours = sec / 3600U;
+  salarm.AlarmTime.Minutes = (sec / 60U) % 60U;
+  salarm.AlarmTime.Seconds = sec % 60U;
+  salarm.AlarmTime.SubSeconds = RTC_SYNCH_PREDIV - (stamp % RTC_STAMP_FREQ);
+  salarm.AlarmTime.TimeFormat = RTC_HOURFORMAT12_AM;
+  salarm.AlarmMask = RTC_ALARMMASK_DATEWEEKDAY;
+  salarm.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_NONE;
+  salarm.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_DATE;
+  salarm.AlarmDateWeekDay = 1U;
+  salarm.Alarm = RTC_ALARM_B;
+
+  HAL_RTC_SetAlarm_IT(&hrtc, &salarm, RTC_FORMAT_BIN);
+}
+
+/**
+  * @brief  Disable Alarm B.
+  * @param  None
+  * @retval None
+  */
+void RTC_CancelAlarmB(void)
+{
+  HAL_RTC_DeactivateAlarm(&hrtc, RTC_ALARM_B);
+}
+
+/**
+  * @brief  Switch the wake-up timer between the 1 s period and the fast tick.
+  * @note   The fast tick times the user button debouncing and auto-repeat
+  *         and the touch slider bursts: the part still sleeps in STOP mode
+  *         between two ticks.
+  * @param  user: RTC_FAST_xxx requester
+  * @param  fast: Non zero for RTC_FAST_PER_S wake-ups per second
+  * @retval None
+  */
+void RTC_SetWakeUpFast(uint32_t user, uint8_t fast)
+{
+  uint32_t users = (fast != 0U) ? (RtcWakeUpFast | user) : (RtcWakeUpFast & ~user);
+
+#if !defined(USE_FREERTOS)
+  /* The FreeRTOS build always runs the fast tick, the kernel tick, while
+     awake */
+  if ((users != 0U) != (RtcWakeUpFast != 0U))
+  {
+    HAL_RTCEx_SetWakeUpTimer_IT(&hrtc,
+                                (users != 0U) ? ((RTC_WAKEUP_PERIOD / RTC_FAST_PER_S) - 1U)
+                                              : RTC_WAKEUP_PERIOD,
+                                RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+  }
+#endif
+  RtcWakeUpFast = users;
+}
+
+/**
+  * @brief  Program the wake-up timer period, the next wake-up included.
+  * @param  Counts: RTCCLK/16 periods, 1 to 0x10000
+  * @retval None
+  */
+void RTC_SetWakeUp(uint32_t Counts)
+{
+  HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, Counts - 1U, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+}
+
+/**
+  * @brief  Program the wake-up timer on the 1 Hz clock, at register level.
+  * @note   For the PVD interrupt, on its way to STANDBY: no HAL lock is
+  *         taken, so it also works when the interrupt preempted the main
+  *         loop inside another RTC call. That call never resumes. A calendar
+  *         write cut short in initialization mode is ended, or the RTC would
+  *         stand still in STANDBY.
+  * @param  Seconds: Wake-up period, 1 to 0x10000
+  * @retval None
+  */
+void RTC_SetWakeUpSeconds(uint32_t Seconds)
+{
+  __HAL_RTC_WRITEPROTECTION_DISABLE(&hrtc);
+
+  CLEAR_BIT(hrtc.Instance->ISR, RTC_ISR_INIT);
+
+  /* Same sequence as HAL_RTCEx_SetWakeUpTimer_IT() */
+  if ((hrtc.Instance->CR & RTC_CR_WUTE) != 0U)
+  {
+    (void)HAL_WaitFlag(&hrtc.Instance->ISR, RTC_ISR_WUTWF, 0U, RTC_TIMEOUT_VALUE);
+  }
+  __HAL_RTC_WAKEUPTIMER_DISABLE(&hrtc);
+  __HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&hrtc, RTC_FLAG_WUTF);
+  (void)HAL_WaitFlag(&hrtc.Instance->ISR, RTC_ISR_WUTWF, RTC_ISR_WUTWF, RTC_TIMEOUT_VALUE);
+
+  hrtc.Instance->WUTR = Seconds - 1U;
+  MODIFY_REG(hrtc.Instance->CR, RTC_CR_WUCKSEL, RTC_WAKEUPCLOCK_CK_SPRE_16BITS);
+
+  __HAL_RTC_WAKEUPTIMER_EXTI_ENABLE_IT();
+  __HAL_RTC_WAKEUPTIMER_EXTI_ENABLE_RISING_EDGE();
+  __HAL_RTC_WAKEUPTIMER_ENABLE_IT(&hrtc, RTC_IT_WUT);
+  __HAL_RTC_WAKEUPTIMER_ENABLE(&hrtc);
+
+  __HAL_RTC_WRITEPROTECTION_ENABLE(&hrtc);
+}
+
+/**
+  * @brief  Wake-up timer mode.
+  * @param  None
+  * @retval RTC_FAST_xxx users of the fast tick, zero at the 1 s period
+  */
+uint32_t RTC_WakeUpFast(void)
+{
+  return RtcWakeUpFast;
+}
+
+/**
+  * @brief  Write a backup register.
+  * @param  reg: RTC_BKP_DRx register
+  * @param  data: Value kept across STANDBY and resets
+  * @retval None
+  */
+void RTC_BackupWrite(uint32_t reg, uint32_t data)
+{
+  (&RTC->BKP0R)[reg] = data;
+}
+
+/**
+  * @brief  Read a backup register.
+  * @param  reg: RTC_BKP_DRx register
+  * @retval Register value
+  */
+uint32_t RTC_BackupRead(uint32_t reg)
+{
+  return (&RTC->BKP0R)[reg];
+}
+
+/**
+  * @brief  Function.
+  * @param  None
+  * @retval None
+  */
+void RTC_Init(void)
+{ 
+  
+ /* Configure the RTC */
+  hrtc.Instance = RTC; 
+  hrtc.Init.HourFormat = RTC_HOURFORMAT_24;
+  hrtc.Init.AsynchPrediv = RTC_ASYNCH_PREDIV;
+  hrtc.Init.SynchPrediv = RTC_SYNCH_PREDIV;
+  hrtc.Init.OutPut = RTC_OUTPUT_DISABLE;
+  hrtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+  hrtc.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
+  
+  /* Clocks and backup domain access, needed to read the backup registers */
+  HAL_RTC_MspInit(&hrtc);
+  
+  if (HAL_RTCEx_BKUPRead(&hrtc, RTC_BKP_INIT) == RTC_BKP_INIT_MAGIC)
+  {
+    /* Wake-up from STANDBY or reset: the calendar kept running, do not stop
+       it in initialization mode again */
+    hrtc.State = HAL_RTC_STATE_READY;
+  }
+  else
+  {
+    HAL_RTC_Init(&hrtc);
+    HAL_RTCEx_BKUPWrite(&hrtc, RTC_BKP_INIT, RTC_BKP_INIT_MAGIC);
+  }
+  
+  /* Read the calendar counters directly: no RSF resynchronization is then
+     needed after STOP mode, which the RTC time base relies on */
+  HAL_RTCEx_EnableBypassShadow(&hrtc);
+  
+  HAL_NVIC_SetPriority(RTC_WKUP_IRQn, EVT_IRQ_PRIORITY, 0);
+  
+  /* Enable the RTC global Interrupt */
+  HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+  
+  /* Alarm B times the countdown, with the part in STOP mode */
+  HAL_NVIC_SetPriority(RTC_Alarm_IRQn, EVT_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
+  
+  HAL_RTCEx_DeactivateWakeUpTimer(&hrtc) ;
+#if defined(USE_FREERTOS)
+  /* The kernel tick, stretched by the tickless idle of rtos_tick.c */
+  RTC_SetWakeUp(RTC_WAKEUP_PERIOD / RTC_FAST_PER_S);
+#else
+  HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, RTC_WAKEUP_PERIOD, RTC_WAKEUPCLOCK_RTCCLK_DIV16);    
+#endif
+  RtcWakeUpFast = 0U;
+  
+  /* SysTick is no longer needed: take the HAL time base from the RTC */
+  RTC_TickStart();
+}
+
+void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
+{
+  RCC_OscInitTypeDef        RCC_OscInitStruct;
+  RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
+
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+  
+  RCC_OscInitStruct.OscillatorType =  RCC_OSCILLATORTYPE_LSI | RCC_OSCILLATORTYPE_LSE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+  RCC_OscInitStruct.LSIState = RCC_LSI_OFF;
+  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  
+  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+  HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
+  __HAL_RCC_RTC_ENABLE(); 
+}
+
+/**
+  * @brief  This function handles RTC wakeup interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  uint32_t start = PROF_CYCLES();
+  
+  HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
+  
+  /* Worst-case time spent at this priority, entry to exit */
+  PROF_Record(PROF_ISR_RTC_WKUP, start);
+}
+
+/**
+  * @brief  This function handles RTC alarm interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RTC_Alarm_IRQHandler(void)
+{
+  HAL_RTC_AlarmIRQHandler(&hrtc);
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
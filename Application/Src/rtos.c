@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file    rtos.c
+  * @author  MCD Application Team
+  * @brief   FreeRTOS build of the clock: the event handlers run from an input,
+  *          a display and a sync task, the kernel idling in STOP mode.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Define USE_FREERTOS in the project options and add the kernel of
+        Middlewares/Third_Party/FreeRTOS/Source: list.c, queue.c, tasks.c,
+        portable/MemMang/heap_4.c and portable/IAR/ARM_CM3, with their
+        include paths. The configuration is Inc/FreeRTOSConfig.h. Without
+        USE_FREERTOS this file and rtos_tick.c are empty.
+    (#) The initialization of main() is unchanged, then RTOS_Start() creates
+        the tasks and starts the kernel in place of the main loop. The
+        interrupts keep posting with EVT_Post(): once the kernel runs, the
+        event goes to the queue of the task handling it (RtosTaskOfEvent),
+        which runs the handler with EVT_Run(). Events posted before are left
+        in the rings of event.c: the first task to run dispatches them.
+    (#) The link layer delivering sync packets calls RTOS_Sync() from a
+        task: the packet is copied to the queue of the sync task, which
+        calls SYNC_Receive().
+    (#) The scheduler is cooperative: the handlers were written to run to
+        completion and share the clock state, so a task only gives the core
+        up when it waits on its queue. The priorities choose the next task:
+        input, display, then sync.
+    (#) The kernel tick is the RTC wake-up timer at RTOS_TICK_HZ, and the
+        idle task sleeps in STOP mode up to the next second: see
+        rtos_tick.c.
+
+    [..]
+    (@) Utilities/RtosSim runs this file on the host, on the POSIX port of
+        FreeRTOS.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtos.h"
+#include "sync.h"
+
+#if defined(USE_FREERTOS)
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Sync packet waiting for the sync task
+  */
+typedef struct
+{
+  uint32_t Size;
+  uint8_t  Data[SYNC_PACKET_MAX];
+} RTOS_PacketTypeDef;
+
+/**
+  * @brief  Task description
+  */
+typedef struct
+{
+  const char  *Name;
+  uint16_t     StackWords;
+  UBaseType_t  Priority;
+} RTOS_TaskDefTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const RTOS_TaskDefTypeDef RtosTasks[RTOS_TASK_COUNT] =
+{
+  { "Input",   256U, tskIDLE_PRIORITY + 3U },
+  { "Display", 512U, tskIDLE_PRIORITY + 2U },
+  { "Sync",    256U, tskIDLE_PRIORITY + 1U },
+};
+
+/* Task handling each EVT_IdTypeDef */
+static const uint8_t RtosTaskOfEvent[EVT_ID_COUNT] =
+{
+  RTOS_TASK_DISPLAY,       /* EVT_RTC_WAKEUP        */
+  RTOS_TASK_DISPLAY,       /* EVT_COUNTDOWN_EXPIRED */
+  RTOS_TASK_DISPLAY,       /* EVT_BATTERY_LOW       */
+  RTOS_TASK_INPUT,         /* EVT_BUTTON_EDGE       */
+  RTOS_TASK_INPUT,         /* EVT_BUTTON_TICK       */
+  RTOS_TASK_INPUT,         /* EVT_TOUCH_TICK        */
+  RTOS_TASK_DISPLAY,       /* EVT_LIGHT             */
+};
+
+static QueueHandle_t      RtosQueues[RTOS_TASK_COUNT];
+static RTOS_PacketTypeDef RtosPacket;       /* Sync task only            */
+static __IO uint32_t      RtosRunning;
+
+/* Private function prototypes -----------------------------------------------*/
+static void RTOS_EventTask(void *Argument);
+static void RTOS_SyncTask(void *Argument);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Create the tasks and start the kernel.
+  * @note   Called at the end of the initialization. The interrupts able to
+  *         post events are masked by the kernel from its first call until
+  *         the scheduler starts.
+  * @param  None
+  * @retval None, does not return
+  */
+void RTOS_Start(void)
+{
+  BaseType_t status = pdPASS;
+  uint32_t i;
+
+  for (i = 0U; i < RTOS_TASK_COUNT; i++)
+  {
+    if (i == RTOS_TASK_SYNC)
+    {
+      RtosQueues[i] = xQueueCreate(RTOS_SYNC_QUEUE_SIZE, sizeof(RTOS_PacketTypeDef));
+    }
+    else
+    {
+      RtosQueues[i] = xQueueCreate(RTOS_QUEUE_SIZE, sizeof(EVT_TypeDef));
+    }
+    if (RtosQueues[i] == NULL)
+    {
+      status = pdFAIL;
+      break;
+    }
+    status = xTaskCreate((i == RTOS_TASK_SYNC) ? RTOS_SyncTask : RTOS_EventTask,
+                         RtosTasks[i].Name, RtosTasks[i].StackWords,
+                         (void *)RtosQueues[i], RtosTasks[i].Priority, NULL);
+    if (status != pdPASS)
+    {
+      break;
+    }
+  }
+
+  if (status == pdPASS)
+  {
+    RtosRunning = 1U;
+    vTaskStartScheduler();
+  }
+
+  /* Out of heap: configTOTAL_HEAP_SIZE. The IWDG resets the part */
+  while (1)
+  {
+  }
+}
+
+/**
+  * @brief  Kernel state, for EVT_Post().
+  * @param  None
+  * @retval Non zero once the task queues take the events
+  */
+uint32_t RTOS_IsRunning(void)
+{
+  return RtosRunning;
+}
+
+/**
+  * @brief  Queue an event for the task handling it.
+  * @note   Called by EVT_Post(), from the interrupts. The task runs once the
+  *         one running waits: the scheduler is cooperative.
+  * @param  Event: Event to post
+  * @retval HAL_OK, or HAL_BUSY if the queue was full
+  */
+HAL_StatusTypeDef RTOS_Post(const EVT_TypeDef *Event)
+{
+  if (xQueueSendFromISR(RtosQueues[RtosTaskOfEvent[Event->Id]], Event, NULL) != pdPASS)
+  {
+    return HAL_BUSY;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a sync packet for the sync task.
+  * @note   To be called from a task.
+  * @param  Packet: Packet received, copied
+  * @param  Size: Packet size in bytes
+  * @retval HAL_OK, HAL_ERROR if too long, HAL_BUSY if the queue was full
+  */
+HAL_StatusTypeDef RTOS_Sync(const uint8_t *Packet, uint32_t Size)
+{
+  RTOS_PacketTypeDef packet;
+
+  if (Size > SYNC_PACKET_MAX)
+  {
+    return HAL_ERROR;
+  }
+
+  packet.Size = Size;
+  memcpy(packet.Data, Packet, Size);
+  if (xQueueSend(RtosQueues[RTOS_TASK_SYNC], &packet, 0U) != pdPASS)
+  {
+    return HAL_BUSY;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Input and display tasks: run the handlers of the events queued.
+  * @param  Argument: Queue of the task
+  * @retval None
+  */
+static void RTOS_EventTask(void *Argument)
+{
+  QueueHandle_t queue = (QueueHandle_t)Argument;
+  EVT_TypeDef evt;
+
+  /* Events posted before the kernel ran */
+  EVT_Dispatch();
+
+  for (;;)
+  {
+    if (xQueueReceive(queue, &evt, portMAX_DELAY) == pdPASS)
+    {
+      EVT_Run(&evt);
+    }
+  }
+}
+
+/**
+  * @brief  Sync task: check and apply the packets queued.
+  * @param  Argument: Queue of the task
+  * @retval None
+  */
+static void RTOS_SyncTask(void *Argument)
+{
+  QueueHandle_t queue = (QueueHandle_t)Argument;
+
+  for (;;)
+  {
+    if (xQueueReceive(queue, &RtosPacket, portMAX_DELAY) == pdPASS)
+    {
+      SYNC_Receive(RtosPacket.Data, RtosPacket.Size);
+    }
+  }
+}
+
+/**
+  * @brief  Kernel ticks between two RTC time stamps.
+  * @param  From: Stamp of the last tick counted
+  * @param  To: Stamp now
+  * @retval Whole ticks elapsed, across midnight, or RTOS_TICKS_JUMP when the
+  *         calendar was set in between
+  */
+uint32_t RTOS_TicksElapsed(uint32_t From, uint32_t To)
+{
+  uint32_t ticks = (((To + RTC_STAMP_PER_DAY) - From) % RTC_STAMP_PER_DAY) / RTOS_STAMPS_PER_TICK;
+
+  return (ticks > RTOS_TICKS_MAX_STEP) ? RTOS_TICKS_JUMP : ticks;
+}
+
+#endif /* USE_FREERTOS */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    rtos_tick.c
+  * @author  MCD Application Team
+  * @brief   FreeRTOS tick on the RTC wake-up timer, with a tickless idle in
+  *          STOP mode. Replaces the SysTick of the Cortex-M3 port.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) FreeRTOSConfig.h sets configOVERRIDE_DEFAULT_TICK_CONFIGURATION and
+        configUSE_TICKLESS_IDLE to 2: the port leaves the tick and the idle
+        sleep to vPortSetupTimerInterrupt() and vPortSuppressTicksAndSleep()
+        below. SysTick stays stopped, as with the RTC time base of the HAL.
+    (#) RTC_Init() runs the wake-up timer at RTOS_TICK_HZ, the RTC fast tick.
+        Its callback calls RTOS_TickHandler() before posting the button,
+        touch and 1 s events as before.
+    (#) The ticks are counted from the RTC time stamps, not from the
+        interrupts: a tick handled late, or a sleep ended early by another
+        interrupt, loses no time. The stamp of the last tick counted stays
+        on a tick boundary.
+    (#) When the kernel expects no task to run for 2 ticks or more, the
+        wake-up timer is stretched up to that tick, but not beyond the next
+        second: the 1 s work runs on time. The part sleeps in STOP mode, or
+        SLEEP mode while a user of EVT_InhibitStop() runs, then the tick
+        count is stepped by the time spent, the tick due excepted: it goes
+        through xTaskIncrementTick(), so that the task waiting for it runs
+        on wake-up. While the button or the touch slider need the fast
+        tick, the part sleeps one tick at a time.
+
+    [..]
+    (@) A calendar change moves the stamps: a step beyond
+        RTOS_TICKS_MAX_STEP counts one tick and starts again from the new
+        time.
+    (@) Utilities/HostTest/rtos_tick_test.c runs this file on a kernel
+        stand-in and a simulated wake-up timer, across midnight.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtos.h"
+
+#if defined(USE_FREERTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Stamp on the tick boundary at or before Stamp */
+#define RTOS_TICK_FLOOR(__STAMP__)  ((__STAMP__) - ((__STAMP__) % RTOS_STAMPS_PER_TICK))
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t RtosTickStamp;     /* RTC stamp of the last tick counted   */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t RTOS_TickCatchUp(uint32_t MaxTicks);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Count the ticks elapsed since the last one counted.
+  * @param  MaxTicks: Most ticks to count, the others are left for later
+  * @retval Ticks to count
+  */
+static uint32_t RTOS_TickCatchUp(uint32_t MaxTicks)
+{
+  uint32_t now = RTC_GetStamp();
+  uint32_t ticks = RTOS_TicksElapsed(RtosTickStamp, now);
+
+  if (ticks == RTOS_TICKS_JUMP)
+  {
+    RtosTickStamp = RTOS_TICK_FLOOR(now);
+    return 1U;
+  }
+
+  if (ticks > MaxTicks)
+  {
+    ticks = MaxTicks;
+  }
+  RtosTickStamp = (RtosTickStamp + (ticks * RTOS_STAMPS_PER_TICK)) % RTC_STAMP_PER_DAY;
+  return ticks;
+}
+
+/**
+  * @brief  Start the tick count, from vTaskStartScheduler().
+  * @note   The wake-up timer already runs at RTOS_TICK_HZ (RTC_Init()).
+  * @param  None
+  * @retval None
+  */
+void vPortSetupTimerInterrupt(void)
+{
+  RtosTickStamp = RTOS_TICK_FLOOR(RTC_GetStamp());
+}
+
+/**
+  * @brief  Kernel tick, from the wake-up timer callback.
+  * @param  None
+  * @retval None
+  */
+void RTOS_TickHandler(void)
+{
+  BaseType_t switch_required = pdFALSE;
+  UBaseType_t mask;
+  uint32_t ticks;
+
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+  {
+    return;
+  }
+
+  mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  ticks = RTOS_TickCatchUp(RTOS_TICKS_MAX_STEP);
+  while (ticks-- > 0U)
+  {
+    if (xTaskIncrementTick() != pdFALSE)
+    {
+      switch_required = pdTRUE;
+    }
+  }
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+
+  portYIELD_FROM_ISR(switch_required);
+}
+
+/**
+  * @brief  Idle sleep, from the idle task with the scheduler suspended.
+  * @param  xExpectedIdleTime: Ticks before a task is due
+  * @retval None
+  */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+  uint32_t now, late, sleep, due;
+  uint32_t stretched = 0U;
+
+  __disable_irq();
+
+  if (eTaskConfirmSleepModeStatus() == eAbortSleep)
+  {
+    __enable_irq();
+    return;
+  }
+
+  /* Up to the tick due, and no further than the next second. The last
+     tick counted may be behind now, across midnight when its interrupt is
+     pending: the stamps are compared modulo a day */
+  now = RTC_GetStamp();
+  late = ((now + RTC_STAMP_PER_DAY) - RtosTickStamp) % RTC_STAMP_PER_DAY;
+  sleep = RTC_STAMP_FREQ - (now % RTC_STAMP_FREQ);
+  if (xExpectedIdleTime <= RTOS_TICK_HZ)
+  {
+    due = xExpectedIdleTime * RTOS_STAMPS_PER_TICK;
+    due = (due > late) ? (due - late) : 0U;
+    if (due < sleep)
+    {
+      sleep = due;
+    }
+  }
+
+  if ((RTC_WakeUpFast() == 0U) && (sleep >= (2U * RTOS_STAMPS_PER_TICK)))
+  {
+    /* One stamp late rather than early: the boundary is passed on wake-up */
+    RTC_SetWakeUp((sleep + 1U) * RTOS_COUNTS_PER_STAMP);
+    stretched = 1U;
+  }
+
+  EVT_Sleep();
+
+  if (stretched != 0U)
+  {
+    /* A wake-up timer event cleared here is not lost: the callback checks
+       the second on every tick */
+    RTC_SetWakeUp(RTOS_COUNTS_PER_TICK);
+
+    /* The kernel only unblocks a task in xTaskIncrementTick(): the tick due
+       is left to RTOS_TickHandler(), which the wake-up timer interrupt no
+       longer runs once its event is cleared */
+    vTaskStepTick(RTOS_TickCatchUp(xExpectedIdleTime - 1U));
+    RTOS_TickHandler();
+  }
+
+  __enable_irq();
+}
+
+#endif /* USE_FREERTOS */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,406 @@
+/**
+  ******************************************************************************
+  * @file    sense.c
+  * @author  MCD Application Team
+  * @brief   Environment sensing: VREFINT, the temperature sensor and an
+  *          external channel converted in one ADC scan sequence with DMA,
+  *          calibrated and published in a lock-free snapshot.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) SENSE_OnSecond() is called on every RTC wake-up and samples once
+        every SENSE_PERIOD_S seconds, so sensing never adds a wake-up.
+    (#) A sample set switches the sensors, the HSI and the ADC on, scans
+        VREFINT, the temperature sensor and SENSE_EXT_CHANNEL into a buffer
+        with DMA, and switches them off again. The sensors are enabled
+        first so that their start-up time overlaps the HSI and ADC ones.
+    (#) The ADC and its DMA channel are configured once by the HAL in
+        SENSE_Init(). A sample set only writes their registers, and the
+        core runs on the 16 MHz HSI for the set when it was on the MSI
+        (POWER_ClockHSI()): the ADC needs the HSI anyway, and the set is
+        over 8 times sooner.
+    (#) The DMA transfer complete interrupt applies the factory calibration
+        in integer math:
+        (++) VDDA = 3.0 V * VREFINT_CAL / VREFINT_DATA
+        (++) TS_DATA is brought back to VDDA = 3.0 V, then interpolated
+             between TS_CAL1 (30 degrees C) and TS_CAL2 (110 degrees C)
+        (++) External = VDDA * EXT_DATA / 4095
+    (#) The results are published under a sequence counter: SENSE_Read()
+        copies them without masking interrupts, and retries if a sample set
+        was published meanwhile.
+    (#) The whole set, from the sensors on to the sensors off, is recorded
+        in PROF_SENSE in microseconds. It takes around 40 us, under the
+        50 us budget:
+        (++) about 10 us on the MSI until the HSI has started and taken
+             over the core (3.7 us typical start-up)
+        (++) the ADC power-up, 3.5 us, which also covers the rest of the
+             10 us start-up of the sensors
+        (++) the conversions, 17 us
+        (++) the DMA interrupt and the calibration, about 100 cycles of
+             the HSI.
+    (#) The HSI start-up is bounded by POWER_CLOCK_TIMEOUT_MS, the ADC
+        power-up and the scan by SENSE_TIMEOUT_MS. On a timeout the ADC is
+        stopped and the last snapshot stays published.
+
+    [..]
+    (@) SENSE_Read() is meant for thread mode, or for an interrupt of
+        priority 0x0F, the one of the DMA interrupt: a reader preempting
+        the publication could never see it complete. Such a reader gets no
+        snapshot after SENSE_READ_TRIES attempts.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sense.h"
+#include "rtc.h"
+#include "profile.h"
+#include "watchdog.h"
+#include "power.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Ranks of the scan sequence, in conversion order
+  */
+typedef enum
+{
+  SENSE_RANK_VREFINT = 0,
+  SENSE_RANK_TEMPERATURE,
+  SENSE_RANK_EXTERNAL,
+  SENSE_RANK_COUNT
+} SENSE_RankTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Factory readings, taken with VDDA = SENSE_CAL_MV */
+#define SENSE_VREFINT_CAL       (*(__IO uint16_t *)VREFINT_CAL_ADDR_CMSIS)
+#define SENSE_TS_CAL1           (*(__IO uint16_t *)TEMPSENSOR_CAL1_ADDR_CMSIS)
+#define SENSE_TS_CAL2           (*(__IO uint16_t *)TEMPSENSOR_CAL2_ADDR_CMSIS)
+#define SENSE_CAL_MV            3000U
+
+/* Temperatures of TS_CAL1 and TS_CAL2, in 0.1 degree C */
+#define SENSE_TS_CAL1_DC        300
+#define SENSE_TS_CAL2_DC        1100
+
+/* Fractional bits of the temperature sensor data brought back to 3.0 V */
+#define SENSE_TS_SHIFT          4U
+
+/* Full scale of the 12-bit conversions */
+#define SENSE_FULL_SCALE        4095U
+
+/* Bound of the ADC power-up and of the scan, both well under 100 us */
+#define SENSE_TIMEOUT_MS        1U
+
+/* Start-up time of the temperature sensor and of VREFINT */
+#define SENSE_START_US          10U
+
+/* Copies of the snapshot tried by SENSE_Read(), a set being published
+   every SENSE_PERIOD_S seconds */
+#define SENSE_READ_TRIES        4U
+
+#define SENSE_DMA_CHANNEL       DMA1_Channel1
+#define SENSE_DMA_IRQn          DMA1_Channel1_IRQn
+#define SENSE_DMA_IRQHandler    DMA1_Channel1_IRQHandler
+#define SENSE_DMA_FLAG_TC       DMA_ISR_TCIF1
+#define SENSE_DMA_FLAG_TE       DMA_ISR_TEIF1
+#define SENSE_DMA_FLAGS_CLEAR   DMA_IFCR_CGIF1
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ADC_HandleTypeDef SenseAdcHandle;
+static DMA_HandleTypeDef SenseDmaHandle;
+
+static uint16_t SenseRaw[SENSE_RANK_COUNT];   /* Filled by the DMA              */
+static uint32_t SenseStamp;                   /* RTC stamp of the running set   */
+static __IO uint32_t SenseDone;               /* Set by the DMA interrupt       */
+static uint32_t SenseSeconds;                 /* Seconds since the last set     */
+
+/* Published results: the sequence is odd while they are written */
+static SENSE_SnapshotTypeDef SenseSnapshot;
+static __IO uint32_t SenseSequence;
+
+/* Private function prototypes -----------------------------------------------*/
+static void     SENSE_Publish(void);
+static uint32_t SENSE_Elapsed(uint32_t Start, uint32_t Switch, uint32_t Clock);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Calibrate the raw conversions and publish them.
+  * @note   Called from the DMA interrupt: SENSE_Read() never interrupts it.
+  * @param  None
+  * @retval None
+  */
+static void SENSE_Publish(void)
+{
+  SENSE_SnapshotTypeDef snapshot;
+  uint32_t vref = SenseRaw[SENSE_RANK_VREFINT];
+  uint32_t vdda, ts;
+
+  if (vref == 0U)
+  {
+    return;
+  }
+
+  /* VDDA = 3.0 V * VREFINT_CAL / VREFINT_DATA */
+  vdda = (SENSE_CAL_MV * SENSE_VREFINT_CAL) / vref;
+
+  /* TS_DATA at VDDA = 3.0 V is TS_DATA * VDDA / 3.0 V, that is
+     TS_DATA * VREFINT_CAL / VREFINT_DATA: 4095 * 4095 << 4 fits 32 bits */
+  ts = ((uint32_t)SenseRaw[SENSE_RANK_TEMPERATURE] * SENSE_VREFINT_CAL << SENSE_TS_SHIFT) / vref;
+
+  snapshot.Stamp = SenseStamp;
+  snapshot.Vdda = (uint16_t)vdda;
+  snapshot.Temperature = (int16_t)(SENSE_TS_CAL1_DC +
+                         ((((int32_t)ts - ((int32_t)SENSE_TS_CAL1 << SENSE_TS_SHIFT)) *
+                           (SENSE_TS_CAL2_DC - SENSE_TS_CAL1_DC)) /
+                          (((int32_t)SENSE_TS_CAL2 - (int32_t)SENSE_TS_CAL1) << SENSE_TS_SHIFT)));
+  snapshot.External = (uint16_t)((vdda * SenseRaw[SENSE_RANK_EXTERNAL]) / SENSE_FULL_SCALE);
+  snapshot.Reserved = 0U;
+
+  SenseSequence++;
+  __DMB();
+  SenseSnapshot = snapshot;
+  __DMB();
+  SenseSequence++;
+}
+
+/**
+  * @brief  Microseconds since the start of a sample set.
+  * @note   The core clock may have changed once on the way. The cycles per
+  *         microsecond are rounded up: the result is never above the time
+  *         actually elapsed, so a start-up wait based on it is never short.
+  * @param  Start: PROF_CYCLES() at the start
+  * @param  Switch: PROF_CYCLES() when the core clock changed, Start if not
+  * @param  Clock: Core clock until Switch, in Hz
+  * @retval Elapsed time, in us
+  */
+static uint32_t SENSE_Elapsed(uint32_t Start, uint32_t Switch, uint32_t Clock)
+{
+  return ((Switch - Start) / ((Clock + 999999U) / 1000000U)) +
+         ((PROF_CYCLES() - Switch) / ((SystemCoreClock + 999999U) / 1000000U));
+}
+
+/**
+  * @brief  Configure the ADC scan sequence and its DMA channel, then take a
+  *         first sample set.
+  * @note   The ADC is left disabled: it is only enabled by SENSE_Sample().
+  * @param  None
+  * @retval None
+  */
+void SENSE_Init(void)
+{
+  ADC_ChannelConfTypeDef sconfig;
+
+  SenseAdcHandle.Instance = ADC1;
+  SenseAdcHandle.Init.ClockPrescaler = ADC_CLOCK_ASYNC_DIV1;
+  SenseAdcHandle.Init.Resolution = ADC_RESOLUTION_12B;
+  SenseAdcHandle.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  SenseAdcHandle.Init.ScanConvMode = ADC_SCAN_ENABLE;
+  SenseAdcHandle.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+  SenseAdcHandle.Init.LowPowerAutoWait = ADC_AUTOWAIT_DISABLE;
+  SenseAdcHandle.Init.LowPowerAutoPowerOff = ADC_AUTOPOWEROFF_DISABLE;
+  SenseAdcHandle.Init.ChannelsBank = ADC_CHANNELS_BANK_A;
+  SenseAdcHandle.Init.ContinuousConvMode = DISABLE;
+  SenseAdcHandle.Init.NbrOfConversion = SENSE_RANK_COUNT;
+  SenseAdcHandle.Init.DiscontinuousConvMode = DISABLE;
+  SenseAdcHandle.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  SenseAdcHandle.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+  SenseAdcHandle.Init.DMAContinuousRequests = DISABLE;
+  HAL_ADC_Init(&SenseAdcHandle);
+
+  /* The internal channels need 4 us of sampling: 96 cycles of the 16 MHz
+     HSI. The sequence then lasts (96 + 12) * 2 + (48 + 12) cycles, 17 us */
+  sconfig.Channel = ADC_CHANNEL_VREFINT;
+  sconfig.Rank = ADC_REGULAR_RANK_1;
+  sconfig.SamplingTime = ADC_SAMPLETIME_96CYCLES;
+  HAL_ADC_ConfigChannel(&SenseAdcHandle, &sconfig);
+
+  sconfig.Channel = ADC_CHANNEL_TEMPSENSOR;
+  sconfig.Rank = ADC_REGULAR_RANK_2;
+  HAL_ADC_ConfigChannel(&SenseAdcHandle, &sconfig);
+
+  sconfig.Channel = SENSE_EXT_CHANNEL;
+  sconfig.Rank = ADC_REGULAR_RANK_3;
+  sconfig.SamplingTime = ADC_SAMPLETIME_48CYCLES;
+  HAL_ADC_ConfigChannel(&SenseAdcHandle, &sconfig);
+
+  /* Sensors off until the next sample set */
+  ADC->CCR &= ~ADC_CCR_TSVREFE;
+
+  SenseSeconds = 0U;
+  SenseSequence = 0U;
+  SENSE_Sample();
+}
+
+/**
+  * @brief  Count the RTC wake-ups and sample once a period.
+  * @param  None
+  * @retval None
+  */
+void SENSE_OnSecond(void)
+{
+  if (++SenseSeconds >= SENSE_PERIOD_S)
+  {
+    SENSE_Sample();
+  }
+}
+
+/**
+  * @brief  Convert one sample set and publish it.
+  * @note   The scan is shorter than a wake-up from SLEEP is worth: the core
+  *         waits for the DMA interrupt, and PROF_SENSE holds the whole time
+  *         the analog part is on, in microseconds.
+  * @note   If the HSI or the scan times out, the sample set is dropped and
+  *         SENSE_Read() keeps returning the last one.
+  * @param  None
+  * @retval None
+  */
+void SENSE_Sample(void)
+{
+  POWER_ClockTypeDef clock;
+  uint32_t start, swap;
+
+  WDG_STAGE(WDG_STAGE_SENSE);
+  SenseSeconds = 0U;
+
+  /* Temperature sensor and VREFINT first: they need 10 us to start */
+  ADC->CCR |= ADC_CCR_TSVREFE;
+  start = PROF_CYCLES();
+  swap = start;
+
+  /* The ADC is clocked by the HSI, which is off after STOP mode. On the
+     MSI the core runs on it too for the set */
+  if (POWER_ClockHSI(&clock) == HAL_OK)
+  {
+    swap = (clock.Switched != 0U) ? PROF_CYCLES() : start;
+    SenseDone = 0U;
+    SenseStamp = RTC_GetStamp();
+
+    /* DMA channel armed on the data register, then the ADC powered up */
+    SENSE_DMA_CHANNEL->CNDTR = SENSE_RANK_COUNT;
+    SENSE_DMA_CHANNEL->CCR |= DMA_CCR_EN;
+    ADC1->CR2 |= (ADC_CR2_DMA | ADC_CR2_ADON);
+
+    if (HAL_WaitFlag(&ADC1->SR, ADC_SR_ADONS, ADC_SR_ADONS, SENSE_TIMEOUT_MS) == HAL_OK)
+    {
+      /* Over already when the set started on the MSI: this only waits on
+         a faster clock */
+      while (SENSE_Elapsed(start, swap, clock.CoreClock) < SENSE_START_US)
+      {
+      }
+
+      /* A scan that never completes is aborted below, unpublished */
+      ADC1->CR2 |= ADC_CR2_SWSTART;
+      (void)HAL_WaitFlag(&SenseDone, 1U, 1U, SENSE_TIMEOUT_MS);
+    }
+  }
+
+  /* Power the analog part down again, aborting the DMA if still running */
+  ADC1->CR2 &= ~(ADC_CR2_ADON | ADC_CR2_DMA);
+  SENSE_DMA_CHANNEL->CCR &= ~DMA_CCR_EN;
+  ADC1->SR = 0U;
+  ADC->CCR &= ~ADC_CCR_TSVREFE;
+  PROF_RecordValue(PROF_SENSE, SENSE_Elapsed(start, swap, clock.CoreClock));
+  POWER_ClockRestore(&clock);
+}
+
+/**
+  * @brief  Copy the last published sample set.
+  * @note   Thread mode or interrupt priority 0x0F only, see above.
+  * @param  Snapshot: Receives the sample set
+  * @retval Number of sample sets published since reset, 0 if none yet or
+  *         if a set was being published on every attempt
+  */
+uint32_t SENSE_Read(SENSE_SnapshotTypeDef *Snapshot)
+{
+  uint32_t sequence;
+  uint32_t tries = 0U;
+
+  do
+  {
+    if (++tries > SENSE_READ_TRIES)
+    {
+      return 0U;
+    }
+    sequence = SenseSequence;
+    __DMB();
+    *Snapshot = SenseSnapshot;
+    __DMB();
+  } while (((sequence & 1U) != 0U) || (sequence != SenseSequence));
+
+  return sequence >> 1U;
+}
+
+/**
+  * @brief  ADC MSP initialization: external channel pin and DMA channel.
+  * @param  hadc: ADC handle
+  * @retval None
+  */
+void HAL_ADC_MspInit(ADC_HandleTypeDef *hadc)
+{
+  GPIO_InitTypeDef gpioinitstruct;
+
+  __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  SENSE_EXT_GPIO_CLK_ENABLE();
+
+  gpioinitstruct.Pin  = SENSE_EXT_PIN;
+  gpioinitstruct.Mode = GPIO_MODE_ANALOG;
+  gpioinitstruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(SENSE_EXT_GPIO_PORT, &gpioinitstruct);
+
+  SenseDmaHandle.Instance                 = SENSE_DMA_CHANNEL;
+  SenseDmaHandle.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  SenseDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SenseDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  SenseDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  SenseDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  SenseDmaHandle.Init.Mode                = DMA_NORMAL;
+  SenseDmaHandle.Init.Priority            = DMA_PRIORITY_MEDIUM;
+  HAL_DMA_Init(&SenseDmaHandle);
+
+  /* Fixed addresses and interrupts, SENSE_Sample() only reloads the count */
+  SENSE_DMA_CHANNEL->CPAR = (uint32_t)&ADC1->DR;
+  SENSE_DMA_CHANNEL->CMAR = (uint32_t)SenseRaw;
+  SENSE_DMA_CHANNEL->CCR |= (DMA_CCR_TCIE | DMA_CCR_TEIE);
+
+  HAL_NVIC_SetPriority(SENSE_DMA_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(SENSE_DMA_IRQn);
+}
+
+/**
+  * @brief  This function handles the ADC DMA channel interrupt request: the
+  *         scan sequence moved to memory is published, a transfer error
+  *         drops it and the last one stays valid.
+  * @param  None
+  * @retval None
+  */
+void SENSE_DMA_IRQHandler(void)
+{
+  uint32_t flags = DMA1->ISR;
+
+  DMA1->IFCR = SENSE_DMA_FLAGS_CLEAR;
+  if ((flags & (SENSE_DMA_FLAG_TC | SENSE_DMA_FLAG_TE)) == SENSE_DMA_FLAG_TC)
+  {
+    SENSE_Publish();
+  }
+  SenseDone = 1U;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
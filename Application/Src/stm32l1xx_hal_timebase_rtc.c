@@ -0,0 +1,255 @@
+/**
+  ******************************************************************************
+  * @file    stm32l1xx_hal_timebase_rtc.c
+  * @author  MCD Application Team
+  * @brief   HAL time base based on the RTC calendar and sub-second counter.
+  *          This file overrides the native HAL time base functions (defined
+  *          as weak):
+  *           + SysTick keeps the 1 ms time base only until the RTC runs
+  *           + RTC_TickStart() then stops SysTick and HAL_GetTick() is
+  *             computed on demand from RTC_TR and RTC_SSR
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Add this file to the project in place of any other time base.
+    (#) Call RTC_TickStart() once the RTC is clocked by the LSE and has left
+        initialization mode (done at the end of RTC_Init()).
+    (#) Setting the calendar moves the time of day the tick is read from:
+        call RTC_TickHold() before and RTC_TickRebase() after, as
+        RTC_SetTime() and RTC_SetSeconds() do. The tick stands still in
+        between and goes on from there, so a HAL timeout in progress is
+        neither cut short nor stretched by a day.
+
+    [..]
+    (@) The RTC keeps counting in STOP mode, so HAL timeouts measured across
+        a STOP period stay valid and no tick interrupt is needed while awake.
+    (@) The resolution is one RTC sub-second period (1/256 s with
+        RTC_SYNCH_PREDIV = 0xFF). The HAL only needs this for its timeouts;
+        HAL_Delay() rounds up to the next sub-second boundary.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TICK_MS_PER_DAY    86400000U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t  TickFromRtc = 0U;  /* Set once SysTick has been handed over  */
+static uint32_t TickOffset;        /* uwTick at hand-over minus RTC time      */
+static uint32_t TickDays;          /* Milliseconds added by midnight wraps    */
+static uint32_t TickLast;          /* Last RTC time of day read, in ms        */
+static uint8_t  TickHolding = 0U;  /* Calendar being set, see RTC_TickHold()  */
+static uint32_t TickHeld;          /* Tick value while the calendar is set    */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t RTC_TickReadMs(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Read the RTC time of day in milliseconds.
+  * @param  None
+  * @retval Milliseconds since 00:00:00
+  */
+static uint32_t RTC_TickReadMs(void)
+{
+  uint32_t stamp = RTC_GetStamp();
+
+  return ((stamp / RTC_STAMP_FREQ) * 1000U) +
+         (((stamp % RTC_STAMP_FREQ) * 1000U) / RTC_STAMP_FREQ);
+}
+
+/**
+  * @brief  Hand the HAL time base over from SysTick to the RTC.
+  * @note   The tick value is kept continuous across the hand-over. If the
+  *         LSE is not ready the SysTick time base is left running.
+  * @param  None
+  * @retval None
+  */
+void RTC_TickStart(void)
+{
+  uint32_t primask;
+
+  if (__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY) == RESET)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  TickLast   = RTC_TickReadMs();
+  TickDays   = 0U;
+  TickOffset = uwTick - TickLast;
+
+  /* Stop SysTick and drop a tick that may already be pending */
+  SysTick->CTRL = 0U;
+  SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+  TickFromRtc = 1U;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Hold the tick before the calendar is set.
+  * @note   HAL_GetTick() returns the held value until RTC_TickRebase(). The
+  *         RTC waits of the HAL are bounded by HAL_WaitFlag() spins, not by
+  *         the tick, so they still time out meanwhile.
+  * @param  None
+  * @retval None
+  */
+void RTC_TickHold(void)
+{
+  if (TickFromRtc != 0U)
+  {
+    TickHeld = HAL_GetTick();
+    TickHolding = 1U;
+  }
+}
+
+/**
+  * @brief  Go on from the held tick with the calendar just set.
+  * @param  None
+  * @retval None
+  */
+void RTC_TickRebase(void)
+{
+  uint32_t primask;
+
+  if (TickHolding == 0U)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  TickLast    = RTC_TickReadMs();
+  TickDays    = 0U;
+  TickOffset  = TickHeld - TickLast;
+  TickHolding = 0U;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  This function configures the time base source.
+  * @note   Before RTC_TickStart() the SysTick is used as in the default HAL
+  *         implementation. Afterwards there is nothing to configure: the
+  *         RTC does not depend on the system clock, so clock changes done
+  *         by HAL_RCC_ClockConfig() leave the time base untouched.
+  * @param  TickPriority Tick interrupt priority.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
+{
+  if (TickFromRtc != 0U)
+  {
+    uwTickPrio = TickPriority;
+    return HAL_OK;
+  }
+
+  if ((uwTickFreq == 0U) || (TickPriority >= (1UL << __NVIC_PRIO_BITS)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Configure the SysTick to have interrupt in 1ms time basis */
+  if (HAL_SYSTICK_Config(SystemCoreClock / (1000U / uwTickFreq)) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_NVIC_SetPriority(SysTick_IRQn, TickPriority, 0U);
+  uwTickPrio = TickPriority;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Provide a tick value in millisecond.
+  * @note   Once the RTC drives the time base the value is computed on demand
+  *         and extended past midnight, so it stays monotonic as long as it is
+  *         read at least once a day. It stands still while the calendar
+  *         is set (RTC_TickHold()).
+  * @param  None
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  uint32_t primask, now;
+
+  if (TickFromRtc == 0U)
+  {
+    return uwTick;
+  }
+  if (TickHolding != 0U)
+  {
+    return TickHeld;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  now = RTC_TickReadMs();
+  if (now < TickLast)
+  {
+    TickDays += TICK_MS_PER_DAY;
+  }
+  TickLast = now;
+  now += TickOffset + TickDays;
+
+  __set_PRIMASK(primask);
+
+  return now;
+}
+
+/**
+  * @brief  Suspend Tick increment.
+  * @note   Nothing to do once the RTC drives the time base.
+  * @param  None
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+  if (TickFromRtc == 0U)
+  {
+    CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_TICKINT_Msk);
+  }
+}
+
+/**
+  * @brief  Resume Tick increment.
+  * @note   Nothing to do once the RTC drives the time base.
+  * @param  None
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+  if (TickFromRtc == 0U)
+  {
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_TICKINT_Msk);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
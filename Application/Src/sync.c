@@ -0,0 +1,692 @@
+/**
+  ******************************************************************************
+  * @file    sync.c
+  * @author  MCD Application Team
+  * @brief   Authenticated time and settings packets: AES-128 CTR encryption
+  *          and AES-CMAC tag, on the AES peripheral with DMA when the part
+  *          has one, in software otherwise.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) A packet is a SYNC_HeaderTypeDef in clear, the payload encrypted
+        in CTR mode, then the 16-byte CMAC of the header and the encrypted
+        payload. The counter block is the header, 4 zero bytes and a
+        32-bit big endian block number starting at 1.
+    (#) The link layer delivering packets calls SYNC_Receive() in thread
+        mode. A packet is applied only if its tag is right and its counter
+        is above the last one accepted, kept in the data EEPROM: a
+        recorded packet cannot be played again, even after a reset.
+        Accepted packets are logged (LOG_SYNC). Rejected packets are
+        counted (SYNC_GetRejected()) and logged at most once per
+        SYNC_REJECT_LOG_PERIOD, with the number rejected since the last
+        entry: a flood of forged packets cannot fill the log.
+    (#) Two keys are derived from the device key of the data EEPROM, one
+        for the encryption, one for the tag. An all zero key, the erased
+        EEPROM, rejects every packet.
+
+    [..]
+    (@) On the STM32L162xx the AES peripheral ciphers the blocks and the
+        DMA2 moves them in and out, the core sleeping until the output
+        channel completes. The other parts, and host builds, use the
+        software cipher of aes_sw.c: both give the same packets.
+    (@) SYNC_Benchmark() checks a reference packet with each cipher
+        available and records the cycles per packet in PROF_SYNC_SW and
+        PROF_SYNC_HW.
+    (@) Utilities/HostTest/sync_test.c checks the ciphers against the
+        FIPS-197, SP 800-38A and RFC 4493 vectors, then the replay and
+        tamper rejections.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sync.h"
+#include "aes_sw.h"
+#include "display.h"
+#include "chrono.h"
+#include "rtc.h"
+#include "log.h"
+#include "profile.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Chaining modes
+  */
+typedef enum
+{
+  SYNC_MODE_CTR = 0,       /*!< Payload encryption                     */
+  SYNC_MODE_CBC,           /*!< CMAC, the last block is the tag        */
+} SYNC_ModeTypeDef;
+
+/**
+  * @brief  Derived keys
+  */
+typedef enum
+{
+  SYNC_KEY_ENC = 0,
+  SYNC_KEY_MAC,
+  SYNC_KEY_COUNT
+} SYNC_KeyTypeDef;
+
+/**
+  * @brief  Cipher of whole blocks, word aligned buffers
+  */
+typedef void (*SYNC_CipherTypeDef)(SYNC_ModeTypeDef Mode, SYNC_KeyTypeDef Key, const uint8_t *Iv,
+                                   const uint8_t *In, uint32_t Size, uint8_t *Out);
+
+/* Private define ------------------------------------------------------------*/
+#define SYNC_HEADER_SIZE        sizeof(SYNC_HeaderTypeDef)
+
+/* Blocks of the longest CMAC input, header and payload */
+#define SYNC_MAC_BLOCKS         ((SYNC_HEADER_SIZE + SYNC_PAYLOAD_MAX + SYNC_BLOCK_SIZE - 1U) / SYNC_BLOCK_SIZE)
+
+/* SYNC_TIME limit, the RTC counts the years up to 2099 */
+#define SYNC_SECONDS_MAX        (36525U * 86400U)
+
+/* Packets checked per cipher by SYNC_Benchmark() */
+#define SYNC_BENCH_RUNS         16U
+
+/* Seconds between two LOG_SYNC entries of rejected packets */
+#define SYNC_REJECT_LOG_PERIOD  60U
+
+#if defined(AES)
+/* AES_IN and AES_OUT requests */
+#define SYNC_DMA_IN_CHANNEL             DMA2_Channel5
+#define SYNC_DMA_IN_IRQn                DMA2_Channel5_IRQn
+#define SYNC_DMA_IN_IRQHandler          DMA2_Channel5_IRQHandler
+#define SYNC_DMA_OUT_CHANNEL            DMA2_Channel3
+#define SYNC_DMA_OUT_IRQn               DMA2_Channel3_IRQn
+#define SYNC_DMA_OUT_IRQHandler         DMA2_Channel3_IRQHandler
+
+#define SYNC_CIPHER                     SYNC_HwCipher
+#define SYNC_PROF                       PROF_SYNC_HW
+#else
+#define SYNC_CIPHER                     SYNC_SwCipher
+#define SYNC_PROF                       PROF_SYNC_SW
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#define SYNC_WORDS(bytes)               (((bytes) + 3U) / 4U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t SyncKeys[SYNC_KEY_COUNT][SYNC_WORDS(SYNC_BLOCK_SIZE)];
+static AESSW_ContextTypeDef SyncSwKeys[SYNC_KEY_COUNT];
+static uint8_t  SyncK1[SYNC_BLOCK_SIZE];           /* CMAC subkeys */
+static uint8_t  SyncK2[SYNC_BLOCK_SIZE];
+static uint32_t SyncCounter;
+static uint32_t SyncEnabled;
+
+/* Rejected packets: in all, not logged yet, time of the last entry */
+static uint32_t SyncRejected;
+static uint32_t SyncRejectPending;
+static uint32_t SyncRejectLogTime;
+
+/* Cipher input and output, word aligned for the DMA */
+static uint32_t SyncIn[SYNC_WORDS(SYNC_MAC_BLOCKS * SYNC_BLOCK_SIZE)];
+static uint32_t SyncOut[SYNC_WORDS(SYNC_MAC_BLOCKS * SYNC_BLOCK_SIZE)];
+
+static const uint8_t SyncZero[SYNC_BLOCK_SIZE] = {0};
+
+#if defined(AES)
+static CRYP_HandleTypeDef SyncCrypHandle;
+static DMA_HandleTypeDef  SyncDmaInHandle;
+static DMA_HandleTypeDef  SyncDmaOutHandle;
+static uint32_t           SyncIv[SYNC_WORDS(SYNC_BLOCK_SIZE)];
+static __IO uint32_t      SyncHwDone;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void SYNC_SwCipher(SYNC_ModeTypeDef Mode, SYNC_KeyTypeDef Key, const uint8_t *Iv,
+                          const uint8_t *In, uint32_t Size, uint8_t *Out);
+#if defined(AES)
+static void SYNC_HwCipher(SYNC_ModeTypeDef Mode, SYNC_KeyTypeDef Key, const uint8_t *Iv,
+                          const uint8_t *In, uint32_t Size, uint8_t *Out);
+#endif
+static void SYNC_Double(uint8_t *Block);
+static void SYNC_SetKey(SYNC_KeyTypeDef Key, const uint8_t *Value);
+static void SYNC_Cmac(SYNC_CipherTypeDef Cipher, const uint8_t *Msg, uint32_t Size, uint8_t *Tag);
+static void SYNC_Ctr(SYNC_CipherTypeDef Cipher, const uint8_t *Header, const uint8_t *In,
+                     uint32_t Size, uint8_t *Out);
+static uint32_t SYNC_Seal(SYNC_CipherTypeDef Cipher, const SYNC_HeaderTypeDef *Header,
+                          const void *Payload, uint8_t *Packet);
+static HAL_StatusTypeDef SYNC_Unseal(SYNC_CipherTypeDef Cipher, const uint8_t *Packet, uint8_t *Payload);
+static HAL_StatusTypeDef SYNC_Apply(uint32_t Type, const uint8_t *Payload, uint32_t Size);
+static void SYNC_Reject(uint32_t Type);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Software cipher.
+  * @param  Mode: CTR or CBC
+  * @param  Key: Derived key
+  * @param  Iv: Counter block or chaining value, SYNC_BLOCK_SIZE bytes
+  * @param  In: Input blocks
+  * @param  Size: Bytes, a multiple of SYNC_BLOCK_SIZE
+  * @param  Out: Output blocks
+  * @retval None
+  */
+static void SYNC_SwCipher(SYNC_ModeTypeDef Mode, SYNC_KeyTypeDef Key, const uint8_t *Iv,
+                          const uint8_t *In, uint32_t Size, uint8_t *Out)
+{
+  uint8_t chain[SYNC_BLOCK_SIZE], block[SYNC_BLOCK_SIZE];
+  uint32_t pos, i;
+
+  memcpy(chain, Iv, SYNC_BLOCK_SIZE);
+
+  for (pos = 0U; pos < Size; pos += SYNC_BLOCK_SIZE)
+  {
+    if (Mode == SYNC_MODE_CTR)
+    {
+      AESSW_Encrypt(&SyncSwKeys[Key], chain, block);
+      for (i = 0U; i < SYNC_BLOCK_SIZE; i++)
+      {
+        Out[pos + i] = In[pos + i] ^ block[i];
+      }
+      /* 32-bit big endian counter in the last word, as the AES peripheral */
+      for (i = SYNC_BLOCK_SIZE - 1U; (i >= (SYNC_BLOCK_SIZE - 4U)) && (++chain[i] == 0U); i--)
+      {
+      }
+    }
+    else
+    {
+      for (i = 0U; i < SYNC_BLOCK_SIZE; i++)
+      {
+        chain[i] ^= In[pos + i];
+      }
+      AESSW_Encrypt(&SyncSwKeys[Key], chain, chain);
+      memcpy(&Out[pos], chain, SYNC_BLOCK_SIZE);
+    }
+  }
+}
+
+#if defined(AES)
+/**
+  * @brief  AES peripheral cipher, with DMA: the core sleeps until the last
+  *         block is out.
+  * @param  Mode: CTR or CBC
+  * @param  Key: Derived key
+  * @param  Iv: Counter block or chaining value, SYNC_BLOCK_SIZE bytes
+  * @param  In: Input blocks, word aligned
+  * @param  Size: Bytes, a multiple of SYNC_BLOCK_SIZE
+  * @param  Out: Output blocks, word aligned
+  * @retval None
+  */
+static void SYNC_HwCipher(SYNC_ModeTypeDef Mode, SYNC_KeyTypeDef Key, const uint8_t *Iv,
+                          const uint8_t *In, uint32_t Size, uint8_t *Out)
+{
+  memcpy(SyncIv, Iv, SYNC_BLOCK_SIZE);
+
+  /* Key and IV are loaded again by the next call in the ready phase */
+  SyncCrypHandle.Init.pKey      = (uint8_t *)SyncKeys[Key];
+  SyncCrypHandle.Init.pInitVect = (uint8_t *)SyncIv;
+  SyncCrypHandle.Phase          = HAL_CRYP_PHASE_READY;
+  SyncHwDone = 0U;
+
+  if (Mode == SYNC_MODE_CTR)
+  {
+    HAL_CRYP_AESCTR_Encrypt_DMA(&SyncCrypHandle, (uint8_t *)In, (uint16_t)Size, Out);
+  }
+  else
+  {
+    HAL_CRYP_AESCBC_Encrypt_DMA(&SyncCrypHandle, (uint8_t *)In, (uint16_t)Size, Out);
+  }
+
+  __disable_irq();
+  while (SyncHwDone == 0U)
+  {
+    __WFI();
+    __enable_irq();
+    __disable_irq();
+  }
+  __enable_irq();
+}
+#endif /* AES */
+
+/**
+  * @brief  Multiply by x in GF(2^128), for the CMAC subkeys.
+  * @param  Block: SYNC_BLOCK_SIZE bytes, big endian
+  * @retval None
+  */
+static void SYNC_Double(uint8_t *Block)
+{
+  uint8_t carry = 0U, msb;
+  int32_t i;
+
+  for (i = (int32_t)SYNC_BLOCK_SIZE - 1; i >= 0; i--)
+  {
+    msb = Block[i] >> 7U;
+    Block[i] = (uint8_t)((Block[i] << 1U) | carry);
+    carry = msb;
+  }
+  Block[SYNC_BLOCK_SIZE - 1U] ^= (uint8_t)(carry * 0x87U);
+}
+
+/**
+  * @brief  Load a derived key in both ciphers.
+  * @note   The CMAC subkeys (RFC 4493) follow the tag key.
+  * @param  Key: Derived key
+  * @param  Value: AESSW_KEY_SIZE bytes
+  * @retval None
+  */
+static void SYNC_SetKey(SYNC_KeyTypeDef Key, const uint8_t *Value)
+{
+  memcpy(SyncKeys[Key], Value, AESSW_KEY_SIZE);
+  AESSW_SetKey(&SyncSwKeys[Key], Value);
+
+  if (Key == SYNC_KEY_MAC)
+  {
+    /* K1 = E(K_mac, 0) times x, K2 = K1 times x */
+    AESSW_Encrypt(&SyncSwKeys[SYNC_KEY_MAC], SyncZero, SyncK1);
+    SYNC_Double(SyncK1);
+    memcpy(SyncK2, SyncK1, SYNC_BLOCK_SIZE);
+    SYNC_Double(SyncK2);
+  }
+}
+
+/**
+  * @brief  AES-CMAC (RFC 4493) with the tag key.
+  * @param  Cipher: Software or peripheral
+  * @param  Msg: Message
+  * @param  Size: Bytes, up to SYNC_MAC_BLOCKS blocks
+  * @param  Tag: SYNC_TAG_SIZE bytes
+  * @retval None
+  */
+static void SYNC_Cmac(SYNC_CipherTypeDef Cipher, const uint8_t *Msg, uint32_t Size, uint8_t *Tag)
+{
+  uint8_t *in = (uint8_t *)SyncIn;
+  const uint8_t *subkey = SyncK1;
+  uint32_t blocks = (Size + SYNC_BLOCK_SIZE - 1U) / SYNC_BLOCK_SIZE;
+  uint32_t last, i;
+
+  memcpy(in, Msg, Size);
+  if ((blocks == 0U) || ((Size % SYNC_BLOCK_SIZE) != 0U))
+  {
+    /* Incomplete last block: 10* padding and the second subkey */
+    blocks = (Size / SYNC_BLOCK_SIZE) + 1U;
+    memset(&in[Size], 0, (blocks * SYNC_BLOCK_SIZE) - Size);
+    in[Size] = 0x80U;
+    subkey = SyncK2;
+  }
+
+  last = (blocks - 1U) * SYNC_BLOCK_SIZE;
+  for (i = 0U; i < SYNC_BLOCK_SIZE; i++)
+  {
+    in[last + i] ^= subkey[i];
+  }
+
+  Cipher(SYNC_MODE_CBC, SYNC_KEY_MAC, SyncZero, in, blocks * SYNC_BLOCK_SIZE, (uint8_t *)SyncOut);
+  memcpy(Tag, &((uint8_t *)SyncOut)[last], SYNC_TAG_SIZE);
+}
+
+/**
+  * @brief  Encrypt or decrypt a payload in CTR mode.
+  * @param  Cipher: Software or peripheral
+  * @param  Header: Packet header, the first half of the counter block
+  * @param  In: Payload
+  * @param  Size: Bytes, up to SYNC_PAYLOAD_MAX
+  * @param  Out: Payload
+  * @retval None
+  */
+static void SYNC_Ctr(SYNC_CipherTypeDef Cipher, const uint8_t *Header, const uint8_t *In,
+                     uint32_t Size, uint8_t *Out)
+{
+  uint8_t iv[SYNC_BLOCK_SIZE] = {0};
+  uint32_t blocks = (Size + SYNC_BLOCK_SIZE - 1U) / SYNC_BLOCK_SIZE;
+
+  if (Size == 0U)
+  {
+    return;
+  }
+
+  memcpy(iv, Header, SYNC_HEADER_SIZE);
+  iv[SYNC_BLOCK_SIZE - 1U] = 1U;
+
+  memset(SyncIn, 0, sizeof(SyncIn));
+  memcpy(SyncIn, In, Size);
+  Cipher(SYNC_MODE_CTR, SYNC_KEY_ENC, iv, (uint8_t *)SyncIn, blocks * SYNC_BLOCK_SIZE, (uint8_t *)SyncOut);
+  memcpy(Out, SyncOut, Size);
+}
+
+/**
+  * @brief  Build a packet, as the sender does.
+  * @param  Cipher: Software or peripheral
+  * @param  Header: Header, Length set
+  * @param  Payload: Header->Length bytes
+  * @param  Packet: Up to SYNC_PACKET_MAX bytes
+  * @retval Packet size
+  */
+static uint32_t SYNC_Seal(SYNC_CipherTypeDef Cipher, const SYNC_HeaderTypeDef *Header,
+                          const void *Payload, uint8_t *Packet)
+{
+  memcpy(Packet, Header, SYNC_HEADER_SIZE);
+  SYNC_Ctr(Cipher, Packet, Payload, Header->Length, &Packet[SYNC_HEADER_SIZE]);
+  SYNC_Cmac(Cipher, Packet, SYNC_HEADER_SIZE + Header->Length, &Packet[SYNC_HEADER_SIZE + Header->Length]);
+
+  return SYNC_HEADER_SIZE + Header->Length + SYNC_TAG_SIZE;
+}
+
+/**
+  * @brief  Check the tag of a packet and decrypt its payload.
+  * @note   The tags are compared in constant time.
+  * @param  Cipher: Software or peripheral
+  * @param  Packet: Packet, of a consistent size
+  * @param  Payload: Decrypted payload, SYNC_PAYLOAD_MAX bytes
+  * @retval HAL_OK if authentic
+  */
+static HAL_StatusTypeDef SYNC_Unseal(SYNC_CipherTypeDef Cipher, const uint8_t *Packet, uint8_t *Payload)
+{
+  uint8_t tag[SYNC_TAG_SIZE];
+  uint32_t size = SYNC_HEADER_SIZE + ((const SYNC_HeaderTypeDef *)Packet)->Length;
+  uint8_t diff = 0U;
+  uint32_t i;
+
+  SYNC_Cmac(Cipher, Packet, size, tag);
+  for (i = 0U; i < SYNC_TAG_SIZE; i++)
+  {
+    diff |= tag[i] ^ Packet[size + i];
+  }
+  if (diff != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  SYNC_Ctr(Cipher, Packet, &Packet[SYNC_HEADER_SIZE], size - SYNC_HEADER_SIZE, Payload);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Apply an authentic payload.
+  * @param  Type: SYNC_TypeDef
+  * @param  Payload: Decrypted payload
+  * @param  Size: Payload bytes
+  * @retval HAL_OK if applied
+  */
+static HAL_StatusTypeDef SYNC_Apply(uint32_t Type, const uint8_t *Payload, uint32_t Size)
+{
+  SYNC_TimeTypeDef time;
+  SYNC_SettingsTypeDef settings;
+  uint32_t before;
+
+  switch (Type)
+  {
+  case SYNC_TIME:
+    memcpy(&time, Payload, sizeof(time));
+    if ((Size != sizeof(time)) || (time.Seconds >= SYNC_SECONDS_MAX))
+    {
+      return HAL_ERROR;
+    }
+    before = LOG_Now();
+    RTC_SetSeconds(time.Seconds);
+    LOG_Write(LOG_TIME_SET, SYNC_TIME, before);
+    return HAL_OK;
+
+  case SYNC_SETTINGS:
+    memcpy(&settings, Payload, sizeof(settings));
+    if ((Size != sizeof(settings)) ||
+        ((settings.Contrast != SYNC_KEEP) && (settings.Contrast > DISPLAY_CONTRAST_MAX)))
+    {
+      return HAL_ERROR;
+    }
+    if (settings.Contrast != SYNC_KEEP)
+    {
+      DISPLAY_Contrast(settings.Contrast);
+    }
+    if (settings.Countdown != 0U)
+    {
+      CHRONO_CountdownSet(settings.Countdown);
+    }
+    return HAL_OK;
+
+  default:
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Count a rejected packet, log the count once per period.
+  * @note   The first rejection after a quiet period is logged at once, the
+  *         next ones with the first rejection of the next period.
+  * @param  Type: Packet type, as received
+  * @retval None
+  */
+static void SYNC_Reject(uint32_t Type)
+{
+  uint32_t now = LOG_Now();
+
+  SyncRejected++;
+  SyncRejectPending++;
+
+  /* The first rejection since the power up, or a period after the last entry */
+  if ((SyncRejectPending == SyncRejected) || ((now - SyncRejectLogTime) >= SYNC_REJECT_LOG_PERIOD))
+  {
+    LOG_Write(LOG_SYNC, (uint16_t)(Type | SYNC_LOG_REJECTED), SyncRejectPending);
+    SyncRejectPending = 0U;
+    SyncRejectLogTime = now;
+  }
+}
+
+/**
+  * @brief  Derive the keys from the device key, load the replay counter.
+  * @param  None
+  * @retval None
+  */
+void SYNC_Init(void)
+{
+  const uint8_t *key = (const uint8_t *)SYNC_KEY_ADDRESS;
+  AESSW_ContextTypeDef device;
+  uint8_t block[SYNC_BLOCK_SIZE] = {0};
+  uint8_t derived[SYNC_BLOCK_SIZE];
+  uint32_t i;
+
+  SyncEnabled = 0U;
+  for (i = 0U; i < AESSW_KEY_SIZE; i++)
+  {
+    SyncEnabled |= key[i];
+  }
+
+  /* Encryption key E(K, 1), tag key E(K, 2) */
+  AESSW_SetKey(&device, key);
+  for (i = 0U; i < SYNC_KEY_COUNT; i++)
+  {
+    block[0] = (uint8_t)(i + 1U);
+    AESSW_Encrypt(&device, block, derived);
+    SYNC_SetKey((SYNC_KeyTypeDef)i, derived);
+  }
+  memset(&device, 0, sizeof(device));
+  memset(derived, 0, sizeof(derived));
+
+  SyncCounter = *(__IO uint32_t *)SYNC_COUNTER_ADDRESS;
+
+#if defined(AES)
+  SyncCrypHandle.Instance       = AES;
+  SyncCrypHandle.Init.DataType  = CRYP_DATATYPE_8B;
+  SyncCrypHandle.Init.pKey      = (uint8_t *)SyncKeys[SYNC_KEY_ENC];
+  SyncCrypHandle.Init.pInitVect = (uint8_t *)SyncIv;
+  HAL_CRYP_Init(&SyncCrypHandle);
+#endif
+}
+
+/**
+  * @brief  Check and apply a packet received by the link layer.
+  * @param  Packet: Packet
+  * @param  Size: Packet bytes
+  * @retval HAL_OK if applied
+  */
+HAL_StatusTypeDef SYNC_Receive(const uint8_t *Packet, uint32_t Size)
+{
+  SYNC_HeaderTypeDef header;
+  uint8_t payload[SYNC_PAYLOAD_MAX];
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t start;
+
+  if ((Size < (SYNC_HEADER_SIZE + SYNC_TAG_SIZE)) || (Size > SYNC_PACKET_MAX))
+  {
+    return HAL_ERROR;
+  }
+  memcpy(&header, Packet, SYNC_HEADER_SIZE);
+
+  if ((SyncEnabled != 0U) &&
+      (header.Version == SYNC_VERSION) &&
+      (Size == (SYNC_HEADER_SIZE + header.Length + SYNC_TAG_SIZE)) &&
+      (header.Counter > SyncCounter))
+  {
+    start = PROF_CYCLES();
+    status = SYNC_Unseal(SYNC_CIPHER, Packet, payload);
+    PROF_Record(SYNC_PROF, start);
+
+    if (status == HAL_OK)
+    {
+      /* Authentic: the counter is used up, even if the payload is wrong */
+      SyncCounter = header.Counter;
+      HAL_FLASHEx_DATAEEPROM_Unlock();
+      HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD, SYNC_COUNTER_ADDRESS, SyncCounter);
+      HAL_FLASHEx_DATAEEPROM_Lock();
+
+      status = SYNC_Apply(header.Type, payload, header.Length);
+    }
+    memset(payload, 0, sizeof(payload));
+  }
+
+  if (status == HAL_OK)
+  {
+    LOG_Write(LOG_SYNC, header.Type, header.Counter);
+  }
+  else
+  {
+    SYNC_Reject(header.Type);
+  }
+  return status;
+}
+
+/**
+  * @brief  Number of packets rejected.
+  * @param  None
+  * @retval Rejected packets since the power up
+  */
+uint32_t SYNC_GetRejected(void)
+{
+  return SyncRejected;
+}
+
+/**
+  * @brief  Time the check of a reference packet with each cipher.
+  * @note   Results in ProfStats[PROF_SYNC_SW] and, on a part with the AES
+  *         peripheral, ProfStats[PROF_SYNC_HW]. Nothing is applied.
+  * @param  None
+  * @retval None
+  */
+void SYNC_Benchmark(void)
+{
+  SYNC_HeaderTypeDef header = { SYNC_VERSION, SYNC_SETTINGS, sizeof(SYNC_SettingsTypeDef), 0U, 0U };
+  SYNC_SettingsTypeDef settings = { SYNC_KEEP, { 0U }, 0U };
+  uint8_t packet[SYNC_PACKET_MAX];
+  uint8_t payload[SYNC_PAYLOAD_MAX];
+  uint32_t run, start;
+
+  SYNC_Seal(SYNC_SwCipher, &header, &settings, packet);
+
+  for (run = 0U; run < SYNC_BENCH_RUNS; run++)
+  {
+    start = PROF_CYCLES();
+    SYNC_Unseal(SYNC_SwCipher, packet, payload);
+    PROF_Record(PROF_SYNC_SW, start);
+  }
+
+#if defined(AES)
+  for (run = 0U; run < SYNC_BENCH_RUNS; run++)
+  {
+    start = PROF_CYCLES();
+    SYNC_Unseal(SYNC_HwCipher, packet, payload);
+    PROF_Record(PROF_SYNC_HW, start);
+  }
+#endif
+}
+
+#if defined(AES)
+/**
+  * @brief  CRYP MSP initialization: AES clock and DMA2 channels.
+  * @param  hcryp: CRYP handle
+  * @retval None
+  */
+void HAL_CRYP_MspInit(CRYP_HandleTypeDef *hcryp)
+{
+  __HAL_RCC_AES_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  SyncDmaInHandle.Instance                 = SYNC_DMA_IN_CHANNEL;
+  SyncDmaInHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  SyncDmaInHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SyncDmaInHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  SyncDmaInHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  SyncDmaInHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+  SyncDmaInHandle.Init.Mode                = DMA_NORMAL;
+  SyncDmaInHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&SyncDmaInHandle);
+  __HAL_LINKDMA(hcryp, hdmain, SyncDmaInHandle);
+
+  SyncDmaOutHandle.Instance                 = SYNC_DMA_OUT_CHANNEL;
+  SyncDmaOutHandle.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  SyncDmaOutHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SyncDmaOutHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  SyncDmaOutHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  SyncDmaOutHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+  SyncDmaOutHandle.Init.Mode                = DMA_NORMAL;
+  SyncDmaOutHandle.Init.Priority            = DMA_PRIORITY_VERY_HIGH;
+  HAL_DMA_Init(&SyncDmaOutHandle);
+  __HAL_LINKDMA(hcryp, hdmaout, SyncDmaOutHandle);
+
+  HAL_NVIC_SetPriority(SYNC_DMA_IN_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(SYNC_DMA_IN_IRQn);
+  HAL_NVIC_SetPriority(SYNC_DMA_OUT_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(SYNC_DMA_OUT_IRQn);
+}
+
+/**
+  * @brief  Last block out of the AES peripheral.
+  * @param  hcryp: CRYP handle
+  * @retval None
+  */
+void HAL_CRYP_OutCpltCallback(CRYP_HandleTypeDef *hcryp)
+{
+  SyncHwDone = 1U;
+}
+
+/**
+  * @brief  This function handles the AES_IN DMA channel interrupt request.
+  * @param  None
+  * @retval None
+  */
+void SYNC_DMA_IN_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(SyncCrypHandle.hdmain);
+}
+
+/**
+  * @brief  This function handles the AES_OUT DMA channel interrupt request.
+  * @param  None
+  * @retval None
+  */
+void SYNC_DMA_OUT_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(SyncCrypHandle.hdmaout);
+}
+#endif /* AES */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,319 @@
+/**
+  ******************************************************************************
+  * @file    touch.c
+  * @author  MCD Application Team
+  * @brief   Linear touch slider of the 32L152CDISCOVERY, software charge
+  *          transfer acquisition through the routing interface.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Each of the 3 slider electrodes has its own sampling capacitor. One
+        transfer charges the electrode to VDD, then closes the RI analog
+        switches of both pins to share the charge with the sampling
+        capacitor. The number of transfers until the sampling pin reads
+        high drops when a finger adds capacitance to the electrode.
+    (#) Idle check: TOUCH_OnSecond() rides on the 1 s RTC wake-up and
+        measures the middle electrode, stopping as soon as the count shows
+        no touch. The check runs once every TouchCheckPeriod seconds, set
+        from its measured cycles so that it stays within
+        TOUCH_BUDGET_CYCLES per second.
+    (#) Burst: once the idle check sees activity, the RTC fast tick
+        measures the 3 electrodes on every wake-up and the handler receives
+        the slider position, then TOUCH_RELEASED.
+
+    [..]
+    (@) The pins stay driven low between acquisitions: both capacitors are
+        discharged and no input floats.
+    (@) The transfers use the switch control mode of the routing interface,
+        which COMP1 of light.c also holds with its VCOMP and input switches
+        closed: all of them would share the analog bus with the electrode.
+        RI_ASCR1 is saved and only the switches of the measured channel are
+        closed during an acquisition, then it is restored. The comparator
+        input holds its level on the isolated node meanwhile, and light.c
+        reads the level again on the next RTC wake-up anyway.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "touch.h"
+#include "profile.h"
+#include "rtc.h"
+
+#if defined(USE_TOUCH_SLIDER)
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Slider electrode and its sampling capacitor
+  */
+typedef struct
+{
+  GPIO_TypeDef *ElectrodePort;
+  uint32_t      ElectrodePin;   /*!< Pin number, 0 to 15                   */
+  GPIO_TypeDef *SamplingPort;
+  uint32_t      SamplingPin;    /*!< Pin number, 0 to 15                   */
+  uint32_t      Switches;       /*!< RI_ASCR1 switches of both pins        */
+} TOUCH_ChannelTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TOUCH_CHANNELS          3U
+#define TOUCH_COARSE_CHANNEL    1U
+
+/* Transfers after which an acquisition is given up */
+#define TOUCH_MAX_COUNT         4000U
+
+/* Acquisitions averaged by a calibration */
+#define TOUCH_CAL_SAMPLES       4U
+
+/* Private macro -------------------------------------------------------------*/
+#define TOUCH_MODER(__PIN__)    (3U << (2U * (__PIN__)))
+#define TOUCH_OUTPUT(__PIN__)   (1U << (2U * (__PIN__)))
+
+/* Private variables ---------------------------------------------------------*/
+static const TOUCH_ChannelTypeDef TouchChannels[TOUCH_CHANNELS] =
+{
+  /* Left, middle, right: PA6/PA7 (group 2), PC4/PC5 (group 9), PB0/PB1 (group 3) */
+  { GPIOA, 6U, GPIOA, 7U, RI_ASCR1_CH_6  | RI_ASCR1_CH_7  },
+  { GPIOC, 4U, GPIOC, 5U, RI_ASCR1_CH_14 | RI_ASCR1_CH_15 },
+  { GPIOB, 0U, GPIOB, 1U, RI_ASCR1_CH_8  | RI_ASCR1_CH_9  }
+};
+
+static EVT_HandlerTypeDef TouchHandler;
+
+static uint32_t TouchBase[TOUCH_CHANNELS];  /* Untouched counts            */
+static uint32_t TouchCheckPeriod;           /* Seconds between idle checks */
+static uint32_t TouchSeconds;               /* Seconds since the last check */
+static uint32_t TouchCalSeconds;            /* Seconds since calibration   */
+static uint32_t TouchIdleTicks;             /* Burst ticks without a touch */
+static uint8_t  TouchBurst;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t TOUCH_Acquire(const TOUCH_ChannelTypeDef *ch, uint32_t max);
+static uint8_t  TOUCH_Check(void);
+static void     TOUCH_Calibrate(void);
+static void     TOUCH_OnTick(uint32_t Param);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Count the charge transfers needed to charge a sampling capacitor.
+  * @note   Both pins are driven low on entry and on exit, RI_ASCR1 is
+  *         restored on exit.
+  * @param  ch: Channel to measure
+  * @param  max: Count at which the acquisition stops
+  * @retval Transfers, max if the sampling pin did not switch
+  */
+static uint32_t TOUCH_Acquire(const TOUCH_ChannelTypeDef *ch, uint32_t max)
+{
+  uint32_t out = TOUCH_OUTPUT(ch->ElectrodePin);
+  uint32_t in  = 1U << ch->SamplingPin;
+  uint32_t ascr = RI->ASCR1;
+  uint32_t count;
+
+  /* Sampling pin as input, electrode output level high */
+  ch->SamplingPort->MODER &= ~TOUCH_MODER(ch->SamplingPin);
+  ch->ElectrodePort->BSRR = 1U << ch->ElectrodePin;
+
+  /* Switch control mode with every other switch open: no VCOMP nor
+     comparator input on the bus */
+  RI->ASCR1 = RI_ASCR1_SCM;
+
+  for (count = 0U; count < max; count++)
+  {
+    /* Charge the electrode, then let it float */
+    ch->ElectrodePort->MODER |= out;
+    ch->ElectrodePort->MODER &= ~out;
+
+    /* Share its charge with the sampling capacitor */
+    RI->ASCR1 |= ch->Switches;
+    RI->ASCR1 &= ~ch->Switches;
+
+    if ((ch->SamplingPort->IDR & in) != 0U)
+    {
+      break;
+    }
+  }
+
+  /* Give the switches back, then discharge both capacitors until the next
+     acquisition */
+  RI->ASCR1 = ascr;
+  ch->ElectrodePort->BSRR = (1U << ch->ElectrodePin) << 16U;
+  ch->ElectrodePort->MODER |= out;
+  ch->SamplingPort->MODER |= TOUCH_OUTPUT(ch->SamplingPin);
+
+  return count;
+}
+
+/**
+  * @brief  Idle check on the middle electrode.
+  * @note   The acquisition stops at the touch threshold: without a touch,
+  *         which is the common case, no transfer is spent past it.
+  * @param  None
+  * @retval Non zero if a touch may be present
+  */
+static uint8_t TOUCH_Check(void)
+{
+  uint32_t start = PROF_CYCLES();
+  uint32_t base = TouchBase[TOUCH_COARSE_CHANNEL];
+  uint32_t limit = base - (base >> TOUCH_COARSE_SHIFT);
+  uint32_t count = TOUCH_Acquire(&TouchChannels[TOUCH_COARSE_CHANNEL], limit);
+
+  PROF_Record(PROF_TOUCH_CHECK, start);
+  return (count < limit) ? 1U : 0U;
+}
+
+/**
+  * @brief  Measure the untouched counts and size the idle check period.
+  * @param  None
+  * @retval None
+  */
+static void TOUCH_Calibrate(void)
+{
+  uint32_t i, n, sum;
+
+  for (i = 0U; i < TOUCH_CHANNELS; i++)
+  {
+    sum = 0U;
+    for (n = 0U; n < TOUCH_CAL_SAMPLES; n++)
+    {
+      sum += TOUCH_Acquire(&TouchChannels[i], TOUCH_MAX_COUNT);
+    }
+    TouchBase[i] = sum / TOUCH_CAL_SAMPLES;
+  }
+
+  /* Check period from the cost of one untouched check */
+  TOUCH_Check();
+  TouchCheckPeriod = (ProfStats[PROF_TOUCH_CHECK].Last / TOUCH_BUDGET_CYCLES) + 1U;
+  TouchCalSeconds = 0U;
+}
+
+/**
+  * @brief  Burst acquisition, handler of EVT_TOUCH_TICK.
+  * @param  Param: Not used
+  * @retval None
+  */
+static void TOUCH_OnTick(uint32_t Param)
+{
+  uint32_t i, count, delta[TOUCH_CHANNELS], sum, peak;
+
+  if (TouchBurst == 0U)
+  {
+    return;
+  }
+
+  sum = 0U;
+  peak = 0U;
+  for (i = 0U; i < TOUCH_CHANNELS; i++)
+  {
+    count = TOUCH_Acquire(&TouchChannels[i], TouchBase[i]);
+    delta[i] = TouchBase[i] - count;
+    sum += delta[i];
+    if ((delta[i] << TOUCH_DETECT_SHIFT) >= TouchBase[i])
+    {
+      peak = 1U;
+    }
+  }
+
+  if (peak != 0U)
+  {
+    /* Centroid of the electrodes at 0, the middle and the end */
+    TouchIdleTicks = 0U;
+    TouchHandler(((delta[1] * ((TOUCH_POSITION_MAX + 1U) / 2U)) +
+                  (delta[2] * TOUCH_POSITION_MAX)) / sum);
+    return;
+  }
+
+  if (++TouchIdleTicks >= TOUCH_RELEASE_TICKS)
+  {
+    TouchBurst = 0U;
+    RTC_SetWakeUpFast(RTC_FAST_TOUCH, 0U);
+    TouchHandler(TOUCH_RELEASED);
+  }
+}
+
+/**
+  * @brief  Configure the slider pins and calibrate.
+  * @param  Handler: Called from the main loop with a slider position, from
+  *         0 to TOUCH_POSITION_MAX, or with TOUCH_RELEASED
+  * @retval None
+  */
+void TOUCH_Init(EVT_HandlerTypeDef Handler)
+{
+  uint32_t i;
+
+  TouchHandler = Handler;
+  TouchBurst = 0U;
+  TouchSeconds = 0U;
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  /* The routing interface is clocked with the comparators */
+  __HAL_RCC_COMP_CLK_ENABLE();
+
+  /* All pins driven low */
+  for (i = 0U; i < TOUCH_CHANNELS; i++)
+  {
+    TouchChannels[i].ElectrodePort->BSRR = (1U << TouchChannels[i].ElectrodePin) << 16U;
+    TouchChannels[i].SamplingPort->BSRR = (1U << TouchChannels[i].SamplingPin) << 16U;
+    MODIFY_REG(TouchChannels[i].ElectrodePort->MODER, TOUCH_MODER(TouchChannels[i].ElectrodePin),
+               TOUCH_OUTPUT(TouchChannels[i].ElectrodePin));
+    MODIFY_REG(TouchChannels[i].SamplingPort->MODER, TOUCH_MODER(TouchChannels[i].SamplingPin),
+               TOUCH_OUTPUT(TouchChannels[i].SamplingPin));
+  }
+
+  EVT_Register(EVT_TOUCH_TICK, TOUCH_OnTick);
+
+  TOUCH_Calibrate();
+}
+
+/**
+  * @brief  Idle check and calibration, called on every RTC wake-up.
+  * @param  None
+  * @retval None
+  */
+void TOUCH_OnSecond(void)
+{
+  if (TouchBurst != 0U)
+  {
+    return;
+  }
+
+  if (++TouchCalSeconds >= TOUCH_CALIBRATION_S)
+  {
+    TOUCH_Calibrate();
+  }
+
+  if (++TouchSeconds < TouchCheckPeriod)
+  {
+    return;
+  }
+  TouchSeconds = 0U;
+
+  if (TOUCH_Check() != 0U)
+  {
+    TouchBurst = 1U;
+    TouchIdleTicks = 0U;
+    RTC_SetWakeUpFast(RTC_FAST_TOUCH, 1U);
+  }
+}
+
+#endif /* USE_TOUCH_SLIDER */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
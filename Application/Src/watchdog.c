@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    watchdog.c
+  * @author  MCD Application Team
+  * @brief   Supervision: IWDG refreshed on the RTC wake-up schedule, WWDG
+  *          window over the processing of each wake-up, and the reset cause
+  *          with the last stage reached kept in RTC backup registers.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The IWDG keeps counting in STOP mode. It is only refreshed from
+        WDG_OnSecond(), run by the main loop on each 1 s RTC wake-up: no
+        wake-up is added for it. Its timeout is twice the longest sleep and
+        run, WDG_SLEEP_MAX_MS plus WDG_RUN_MAX_MS, with the fastest LSI, so
+        a main loop that hangs, in a glass update wait for instance, resets
+        the part within seconds.
+    (#) The WWDG is started by WDG_Arm() in the RTC wake-up interrupt and
+        stopped by WDG_Idle() as the main loop goes back to STOP mode: an
+        interrupt storm or a handler running away within the window resets
+        the part after WDG_WWDG_BUDGET_MS. A started WWDG cannot be
+        disabled: it is stopped by an RCC reset of the peripheral, and its
+        clock is gated until the next wake-up.
+    (#) WDG_STAGE() records the stage reached in RTC_BKP_WDG_STAGE, one
+        backup register write. WDG_Init() copies it, with the reset flags of
+        RCC_CSR and a count of the watchdog resets, to RTC_BKP_WDG_RESET
+        before LOG_Init() clears the flags. WDG_Start() logs a watchdog
+        reset with its stage.
+    (#) The IWDG cannot be stopped either, and would end STANDBY mode early:
+        power.c goes through a software reset, after which the IWDG is
+        stopped, to enter STANDBY (see WDG_IsRunning()).
+    (#) Both watchdogs are frozen while the core is halted by a debugger.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "watchdog.h"
+#include "log.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* IWDG reload at the fastest LSI divided by 64 */
+#define WDG_IWDG_DIV            64U
+#define WDG_IWDG_RELOAD         ((2U * (WDG_SLEEP_MAX_MS + WDG_RUN_MAX_MS) * \
+                                  (WDG_LSI_MAX_HZ / WDG_IWDG_DIV)) / 1000U)
+
+/* WWDG period: PCLK1 / 4096 / 8. The reset occurs as the counter goes
+   from 0x40 to 0x3F */
+#define WDG_WWDG_DIV            (4096U * 8U)
+#define WDG_WWDG_RESET          0x3FU
+#define WDG_WWDG_PERIODS_MAX    0x40U
+#define WDG_WWDG_WINDOW         0x7FU    /* Never refreshed, no early limit */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static IWDG_HandleTypeDef WdgIwdgHandle;
+static WWDG_HandleTypeDef WdgWwdgHandle;
+
+static uint32_t WdgRunning;
+static uint32_t WdgArmed;
+static uint32_t WdgLastReset;      /* RTC_BKP_WDG_RESET of this boot       */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Record the cause of this reset and the stage reached before it.
+  * @note   To be called once the RTC backup registers are writable, before
+  *         LOG_Init() clears the reset flags.
+  * @param  None
+  * @retval None
+  */
+void WDG_Init(void)
+{
+  uint32_t csr = RCC->CSR;
+  uint32_t count = RTC_BackupRead(RTC_BKP_WDG_RESET) & WDG_RESET_COUNT;
+
+  if (((csr & (RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF)) != 0U) && (count != WDG_RESET_COUNT))
+  {
+    count += 1UL << WDG_RESET_COUNT_SHIFT;
+  }
+
+  WdgLastReset = (csr & WDG_RESET_FLAGS) | count |
+                 (RTC_BackupRead(RTC_BKP_WDG_STAGE) & WDG_RESET_STAGE);
+  RTC_BackupWrite(RTC_BKP_WDG_RESET, WdgLastReset);
+
+  WDG_STAGE(WDG_STAGE_BOOT);
+}
+
+/**
+  * @brief  Start the IWDG, once the initialization is done.
+  * @param  None
+  * @retval None
+  */
+void WDG_Start(void)
+{
+  if ((WdgLastReset & (RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF)) != 0U)
+  {
+    LOG_Write(LOG_WATCHDOG, (uint16_t)(WdgLastReset & WDG_RESET_STAGE), WdgLastReset);
+  }
+
+  __HAL_DBGMCU_FREEZE_IWDG();
+  __HAL_DBGMCU_FREEZE_WWDG();
+
+  WdgIwdgHandle.Instance = IWDG;
+  WdgIwdgHandle.Init.Prescaler = IWDG_PRESCALER_64;
+  WdgIwdgHandle.Init.Reload = WDG_IWDG_RELOAD;
+  HAL_IWDG_Init(&WdgIwdgHandle);
+
+  WdgRunning = 1U;
+}
+
+/**
+  * @brief  Refresh the IWDG, from the 1 s wake-up handler.
+  * @param  None
+  * @retval None
+  */
+void WDG_OnSecond(void)
+{
+  WDG_STAGE(WDG_STAGE_WAKEUP);
+  if (WdgRunning != 0U)
+  {
+    HAL_IWDG_Refresh(&WdgIwdgHandle);
+  }
+}
+
+/**
+  * @brief  Start the WWDG window, from the RTC wake-up interrupt.
+  * @note   The window started by a wake-up not yet processed goes on.
+  * @param  None
+  * @retval None
+  */
+void WDG_Arm(void)
+{
+  uint32_t periods;
+
+  if ((WdgRunning == 0U) || (WdgArmed != 0U))
+  {
+    return;
+  }
+
+  periods = (WDG_WWDG_BUDGET_MS * (HAL_RCC_GetPCLK1Freq() / WDG_WWDG_DIV)) / 1000U;
+  if (periods > WDG_WWDG_PERIODS_MAX)
+  {
+    periods = WDG_WWDG_PERIODS_MAX;
+  }
+  else if (periods == 0U)
+  {
+    periods = 1U;
+  }
+
+  WdgWwdgHandle.Instance = WWDG;
+  WdgWwdgHandle.Init.Prescaler = WWDG_PRESCALER_8;
+  WdgWwdgHandle.Init.Window = WDG_WWDG_WINDOW;
+  WdgWwdgHandle.Init.Counter = WDG_WWDG_RESET + periods;
+  WdgWwdgHandle.Init.EWIMode = WWDG_EWI_DISABLE;
+  HAL_WWDG_Init(&WdgWwdgHandle);
+
+  WdgArmed = 1U;
+}
+
+/**
+  * @brief  Stop the WWDG window before STOP or SLEEP mode, where the WWDG
+  *         would count on in SLEEP mode.
+  * @param  None
+  * @retval None
+  */
+void WDG_Idle(void)
+{
+  WDG_STAGE(WDG_STAGE_IDLE);
+  if (WdgArmed == 0U)
+  {
+    return;
+  }
+
+  __HAL_RCC_WWDG_FORCE_RESET();
+  __HAL_RCC_WWDG_RELEASE_RESET();
+  __HAL_RCC_WWDG_CLK_DISABLE();
+  WdgArmed = 0U;
+}
+
+/**
+  * @brief  IWDG state.
+  * @param  None
+  * @retval Non zero once the IWDG runs: only a reset stops it
+  */
+uint32_t WDG_IsRunning(void)
+{
+  return WdgRunning;
+}
+
+/**
+  * @brief  WWDG MSP initialization.
+  * @param  hwwdg: WWDG handle
+  * @retval None
+  */
+void HAL_WWDG_MspInit(WWDG_HandleTypeDef *hwwdg)
+{
+  __HAL_RCC_WWDG_CLK_ENABLE();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -954,6 +954,9 @@ uint32_t           HAL_GetDEVID(void);
 uint32_t           HAL_GetUIDw0(void);
 uint32_t           HAL_GetUIDw1(void);
 uint32_t           HAL_GetUIDw2(void);
+HAL_StatusTypeDef  HAL_WaitFlag(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout);
+HAL_StatusTypeDef  HAL_WaitFlagEvent(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout, IRQn_Type IRQn);
+void               HAL_WaitFlagCallback(uint32_t Spins);
 
 /**
   * @}
@@ -67,6 +67,10 @@
 
 #define IDCODE_DEVID_MASK    (0x00000FFFU)
 
+/* Fewest core cycles taken by one HAL_WaitFlag() spin: the spin budget
+   derived from it never makes a timeout shorter than requested */
+#define WAITFLAG_SPIN_CYCLES (4U)
+
 /**
   * @}
   */
@@ -281,6 +285,7 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
       (+) Get the device identifier
       (+) Get the device revision identifier
       (+) Get the unique device identifier
+      (+) Wait for a register flag with a fixed cost timeout
 
 @endverbatim
   * @{
@@ -475,6 +480,90 @@ uint32_t HAL_GetUIDw2(void)
   return(READ_REG(*((uint32_t *)(UID_BASE + 0x14U))));
 }
 
+/**
+  * @brief  Wait until a register bit field reaches a value.
+  * @note   The timeout is a spin budget derived from SystemCoreClock rather
+  *         than HAL_GetTick() calls: a spin is one load and one compare,
+  *         and the timeout works whether the tick runs or not.
+  * @param  Reg Register to poll
+  * @param  Mask Bits of the register compared
+  * @param  Value Expected value of the masked bits
+  * @param  Timeout Timeout duration, in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_WaitFlag(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout)
+{
+  uint32_t budget = Timeout * (SystemCoreClock / (1000U * WAITFLAG_SPIN_CYCLES));
+  uint32_t spins = 0U;
+
+  while ((*Reg & Mask) != Value)
+  {
+    if (++spins > budget)
+    {
+      HAL_WaitFlagCallback(spins);
+      return HAL_TIMEOUT;
+    }
+  }
+
+  HAL_WaitFlagCallback(spins);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Wait in Sleep mode until a register bit field reaches a value.
+  * @note   For flags with an interrupt enabled in the peripheral: the core
+  *         sleeps on WFE and the interrupt wakes it up through SEVONPEND,
+  *         even when it is disabled in the NVIC. Its pending bit is cleared
+  *         on exit.
+  * @note   The timeout is checked on each wake-up with HAL_GetTick().
+  * @param  Reg Register to poll
+  * @param  Mask Bits of the register compared
+  * @param  Value Expected value of the masked bits
+  * @param  Timeout Timeout duration, in ms
+  * @param  IRQn Interrupt raised by the flag
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_WaitFlagEvent(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout, IRQn_Type IRQn)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t spins = 0U;
+
+  /* Only a new pending interrupt raises an event */
+  NVIC_ClearPendingIRQ(IRQn);
+  SET_BIT(SCB->SCR, SCB_SCR_SEVONPEND_Msk);
+
+  while ((*Reg & Mask) != Value)
+  {
+    spins++;
+    if ((HAL_GetTick() - tickstart) > Timeout)
+    {
+      status = HAL_TIMEOUT;
+      break;
+    }
+    __WFE();
+  }
+
+  CLEAR_BIT(SCB->SCR, SCB_SCR_SEVONPEND_Msk);
+  NVIC_ClearPendingIRQ(IRQn);
+
+  HAL_WaitFlagCallback(spins);
+  return status;
+}
+
+/**
+  * @brief  Report the spins of a HAL_WaitFlag() or HAL_WaitFlagEvent() call.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_WaitFlagCallback could be implemented in the user file
+  * @param  Spins Number of times the flag was found not ready
+  * @retval None
+  */
+__weak void HAL_WaitFlagCallback(uint32_t Spins)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Spins);
+}
+
 /**
   * @}
   */
@@ -176,7 +176,6 @@ HAL_StatusTypeDef HAL_LCD_DeInit(LCD_HandleTypeDef *hlcd)
   */
 HAL_StatusTypeDef HAL_LCD_Init(LCD_HandleTypeDef *hlcd)
 {
-  uint32_t tickstart = 0x00;
   uint8_t counter = 0;
     
   /* Check the LCD handle allocation */
@@ -255,30 +254,18 @@ HAL_StatusTypeDef HAL_LCD_Init(LCD_HandleTypeDef *hlcd)
   /* Enable the peripheral */
   __HAL_LCD_ENABLE(hlcd);
   
-  /* Get timeout */
-  tickstart = HAL_GetTick();
-      
   /* Wait Until the LCD is enabled */
-  while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_ENS) == RESET)
+  if (HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_ENS, LCD_FLAG_ENS, LCD_TIMEOUT_VALUE) != HAL_OK)
   {
-    if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-    { 
-      hlcd->ErrorCode = HAL_LCD_ERROR_ENS;     
-      return HAL_TIMEOUT;
-    } 
+    hlcd->ErrorCode = HAL_LCD_ERROR_ENS;     
+    return HAL_TIMEOUT;
   }
   
-  /* Get timeout */
-  tickstart = HAL_GetTick();
-  
   /*!< Wait Until the LCD Booster is ready */
-  while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_RDY) == RESET)
+  if (HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_RDY, LCD_FLAG_RDY, LCD_TIMEOUT_VALUE) != HAL_OK)
   {
-    if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-    {   
-      hlcd->ErrorCode = HAL_LCD_ERROR_RDY;  
-      return HAL_TIMEOUT;
-    } 
+    hlcd->ErrorCode = HAL_LCD_ERROR_RDY;  
+    return HAL_TIMEOUT;
   }
  
   /* Initialize the LCD state */
@@ -378,8 +365,6 @@ HAL_StatusTypeDef HAL_LCD_Init(LCD_HandleTypeDef *hlcd)
   */
 HAL_StatusTypeDef HAL_LCD_Write(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterIndex, uint32_t RAMRegisterMask, uint32_t Data)
 {
-  uint32_t tickstart = 0x00; 
-  
   if((hlcd->State == HAL_LCD_STATE_READY) || (hlcd->State == HAL_LCD_STATE_BUSY))
   {
     /* Check the parameters */
@@ -391,21 +376,15 @@ HAL_StatusTypeDef HAL_LCD_Write(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterInd
       __HAL_LOCK(hlcd);
       hlcd->State = HAL_LCD_STATE_BUSY;
       
-      /* Get timeout */
-      tickstart = HAL_GetTick();
-      
       /*!< Wait Until the LCD is ready */
-      while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDR) != RESET)
+      if (HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_UDR, 0U, LCD_TIMEOUT_VALUE) != HAL_OK)
       {
-        if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-        { 
-          hlcd->ErrorCode = HAL_LCD_ERROR_UDR;
-          
-          /* Process Unlocked */
-          __HAL_UNLOCK(hlcd);
-          
-          return HAL_TIMEOUT;
-        } 
+        hlcd->ErrorCode = HAL_LCD_ERROR_UDR;
+        
+        /* Process Unlocked */
+        __HAL_UNLOCK(hlcd);
+        
+        return HAL_TIMEOUT;
       }
     }
     
@@ -427,7 +406,6 @@ HAL_StatusTypeDef HAL_LCD_Write(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterInd
   */
 HAL_StatusTypeDef HAL_LCD_Clear(LCD_HandleTypeDef *hlcd)
 {
-  uint32_t tickstart = 0x00; 
   uint32_t counter = 0;
   
   if((hlcd->State == HAL_LCD_STATE_READY) || (hlcd->State == HAL_LCD_STATE_BUSY))
@@ -437,21 +415,15 @@ HAL_StatusTypeDef HAL_LCD_Clear(LCD_HandleTypeDef *hlcd)
     
     hlcd->State = HAL_LCD_STATE_BUSY;
     
-    /* Get timeout */
-    tickstart = HAL_GetTick();
-    
     /*!< Wait Until the LCD is ready */
-    while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDR) != RESET)
+    if (HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_UDR, 0U, LCD_TIMEOUT_VALUE) != HAL_OK)
     {
-      if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-      { 
-        hlcd->ErrorCode = HAL_LCD_ERROR_UDR;
-        
-        /* Process Unlocked */
-        __HAL_UNLOCK(hlcd);
-        
-        return HAL_TIMEOUT;
-      } 
+      hlcd->ErrorCode = HAL_LCD_ERROR_UDR;
+      
+      /* Process Unlocked */
+      __HAL_UNLOCK(hlcd);
+      
+      return HAL_TIMEOUT;
     }
     /* Clear the LCD_RAM registers */
     for(counter = LCD_RAM_REGISTER0; counter <= LCD_RAM_REGISTER15; counter++)
@@ -486,7 +458,7 @@ HAL_StatusTypeDef HAL_LCD_Clear(LCD_HandleTypeDef *hlcd)
   */
 HAL_StatusTypeDef HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd)
 {
-  uint32_t tickstart = 0x00;
+  HAL_StatusTypeDef status;
   
   /* Clear the Update Display Done flag before starting the update display request */
   __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_UDD);
@@ -494,21 +466,24 @@ HAL_StatusTypeDef HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd)
   /* Enable the display request */
   hlcd->Instance->SR |= LCD_SR_UDR;
   
-  /* Get timeout */
-  tickstart = HAL_GetTick();
-  
-  /*!< Wait Until the LCD display is done */
-  while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDD) == RESET)
+  /*!< Wait Until the LCD display is done: up to a frame, sleep on WFE when
+       the Update Display Done interrupt is enabled */
+  if (READ_BIT(hlcd->Instance->FCR, LCD_FCR_UDDIE) != 0U)
   {
-    if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-    { 
-      hlcd->ErrorCode = HAL_LCD_ERROR_UDD;
-      
-      /* Process Unlocked */
-      __HAL_UNLOCK(hlcd);
+    status = HAL_WaitFlagEvent(&hlcd->Instance->SR, LCD_FLAG_UDD, LCD_FLAG_UDD, LCD_TIMEOUT_VALUE, LCD_IRQn);
+  }
+  else
+  {
+    status = HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_UDD, LCD_FLAG_UDD, LCD_TIMEOUT_VALUE);
+  }
+  if (status != HAL_OK)
+  {
+    hlcd->ErrorCode = HAL_LCD_ERROR_UDD;
+    
+    /* Process Unlocked */
+    __HAL_UNLOCK(hlcd);
   
-      return HAL_TIMEOUT;
-    }
+    return HAL_TIMEOUT;
   }
 
   hlcd->State = HAL_LCD_STATE_READY;
@@ -577,19 +552,11 @@ uint32_t HAL_LCD_GetError(LCD_HandleTypeDef *hlcd)
   */
 HAL_StatusTypeDef LCD_WaitForSynchro(LCD_HandleTypeDef *hlcd)
 {
-  uint32_t tickstart = 0x00; 
-  
-  /* Get timeout */
-  tickstart = HAL_GetTick();
-
   /* Loop until FCRSF flag is set */
-  while(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_FCRSF) == RESET)
+  if (HAL_WaitFlag(&hlcd->Instance->SR, LCD_FLAG_FCRSF, LCD_FLAG_FCRSF, LCD_TIMEOUT_VALUE) != HAL_OK)
   {
-    if((HAL_GetTick() - tickstart ) > LCD_TIMEOUT_VALUE)
-    {
-      hlcd->ErrorCode = HAL_LCD_ERROR_FCRSF;
-      return HAL_TIMEOUT;
-    }
+    hlcd->ErrorCode = HAL_LCD_ERROR_FCRSF;
+    return HAL_TIMEOUT;
   }
 
   return HAL_OK;
@@ -348,8 +348,6 @@ HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc)
   */
 HAL_StatusTypeDef HAL_RTC_DeInit(RTC_HandleTypeDef *hrtc)
 {
-  uint32_t tickstart;
-
   /* Check the parameters */
   assert_param(IS_RTC_ALL_INSTANCE(hrtc->Instance));
 
@@ -378,21 +376,16 @@ HAL_StatusTypeDef HAL_RTC_DeInit(RTC_HandleTypeDef *hrtc)
     /* Reset All CR bits except CR[2:0] */
     hrtc->Instance->CR &= 0x00000007U;
 
-    tickstart = HAL_GetTick();
-
     /* Wait till WUTWF flag is set and if Time out is reached exit */
-    while (((hrtc->Instance->ISR) & RTC_ISR_WUTWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_WUTWF, RTC_ISR_WUTWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        /* Set RTC state */
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      /* Set RTC state */
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
 
     /* Reset all RTC CR register bits */
@@ -1059,7 +1052,6 @@ HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDat
   */
 HAL_StatusTypeDef HAL_RTC_SetAlarm(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sAlarm, uint32_t Format)
 {
-  uint32_t tickstart;
   uint32_t tmpreg;
 
 #if defined(STM32L100xBA) || defined (STM32L151xBA) || defined (STM32L152xBA) || defined(STM32L100xC) || defined (STM32L151xC) || defined (STM32L152xC) || defined (STM32L162xC) || defined(STM32L151xCA) || defined (STM32L151xD) || defined (STM32L152xCA) || defined (STM32L152xD) || defined (STM32L162xCA) || defined (STM32L162xD) || defined(STM32L151xE) || defined(STM32L151xDX) || defined (STM32L152xE) || defined (STM32L152xDX) || defined (STM32L162xE) || defined (STM32L162xDX)
@@ -1164,22 +1156,18 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sA
     /* In case of interrupt mode is used, the interrupt source must disabled */
     __HAL_RTC_ALARM_DISABLE_IT(hrtc, RTC_IT_ALRA);
 
-    tickstart = HAL_GetTick();
     /* Wait till RTC ALRAWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRAWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRAWF, RTC_ISR_ALRAWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
 
     hrtc->Instance->ALRMAR = (uint32_t)tmpreg;
@@ -1198,22 +1186,18 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sA
     /* In case of interrupt mode is used, the interrupt source must disabled */
     __HAL_RTC_ALARM_DISABLE_IT(hrtc, RTC_IT_ALRB);
 
-    tickstart = HAL_GetTick();
     /* Wait till RTC ALRBWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRBWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRBWF, RTC_ISR_ALRBWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
 
     hrtc->Instance->ALRMBR = (uint32_t)tmpreg;
@@ -1252,7 +1236,6 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sA
   */
 HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sAlarm, uint32_t Format)
 {
-  uint32_t tickstart = 0;
   uint32_t tmpreg = 0;
 #if defined(STM32L100xBA) || defined (STM32L151xBA) || defined (STM32L152xBA) || defined(STM32L100xC) || defined (STM32L151xC) || defined (STM32L152xC) || defined (STM32L162xC) || defined(STM32L151xCA) || defined (STM32L151xD) || defined (STM32L152xCA) || defined (STM32L152xD) || defined (STM32L162xCA) || defined (STM32L162xD) || defined(STM32L151xE) || defined(STM32L151xDX) || defined (STM32L152xE) || defined (STM32L152xDX) || defined (STM32L162xE) || defined (STM32L162xDX)
   uint32_t subsecondtmpreg = 0;
@@ -1353,22 +1336,18 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef
     /* Clear flag alarm A */
     __HAL_RTC_ALARM_CLEAR_FLAG(hrtc, RTC_FLAG_ALRAF);
 
-    tickstart = HAL_GetTick();
     /* Wait till RTC ALRAWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRAWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRAWF, RTC_ISR_ALRAWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
 
     hrtc->Instance->ALRMAR = (uint32_t)tmpreg;
@@ -1389,22 +1368,18 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef
     /* Clear flag alarm B */
     __HAL_RTC_ALARM_CLEAR_FLAG(hrtc, RTC_FLAG_ALRBF);
 
-    tickstart = HAL_GetTick();
     /* Wait till RTC ALRBWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRBWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRBWF, RTC_ISR_ALRBWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
 
     hrtc->Instance->ALRMBR = (uint32_t)tmpreg;
@@ -1445,8 +1420,6 @@ HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef
   */
 HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc, uint32_t Alarm)
 {
-  uint32_t tickstart;
-
   /* Check the parameters */
   assert_param(IS_RTC_ALARM(Alarm));
 
@@ -1466,23 +1439,18 @@ HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc, uint32_t Alar
     /* In case of interrupt mode is used, the interrupt source must disabled */
     __HAL_RTC_ALARM_DISABLE_IT(hrtc, RTC_IT_ALRA);
 
-    tickstart = HAL_GetTick();
-
     /* Wait till RTC ALRxWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRAWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRAWF, RTC_ISR_ALRAWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
   }
   else
@@ -1493,23 +1461,18 @@ HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc, uint32_t Alar
     /* In case of interrupt mode is used, the interrupt source must disabled */
     __HAL_RTC_ALARM_DISABLE_IT(hrtc, RTC_IT_ALRB);
 
-    tickstart = HAL_GetTick();
-
     /* Wait till RTC ALRxWF flag is set and if Time out is reached exit */
-    while (__HAL_RTC_ALARM_GET_FLAG(hrtc, RTC_FLAG_ALRBWF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_ALRBWF, RTC_ISR_ALRBWF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        /* Enable the write protection for RTC registers */
-        __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
+      /* Enable the write protection for RTC registers */
+      __HAL_RTC_WRITEPROTECTION_ENABLE(hrtc);
 
-        hrtc->State = HAL_RTC_STATE_TIMEOUT;
+      hrtc->State = HAL_RTC_STATE_TIMEOUT;
 
-        /* Process Unlocked */
-        __HAL_UNLOCK(hrtc);
+      /* Process Unlocked */
+      __HAL_UNLOCK(hrtc);
 
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
   }
   /* Enable the write protection for RTC registers */
@@ -1722,8 +1685,6 @@ HAL_StatusTypeDef HAL_RTC_PollForAlarmAEvent(RTC_HandleTypeDef *hrtc, uint32_t T
   */
 HAL_StatusTypeDef HAL_RTC_WaitForSynchro(RTC_HandleTypeDef *hrtc)
 {
-  uint32_t tickstart;
-
 #if defined(STM32L100xBA) || defined (STM32L151xBA) || defined (STM32L152xBA) || defined(STM32L100xC) || defined (STM32L151xC) || defined (STM32L152xC) || defined (STM32L162xC) || defined(STM32L151xCA) || defined (STM32L151xD) || defined (STM32L152xCA) || defined (STM32L152xD) || defined (STM32L162xCA) || defined (STM32L162xD) || defined(STM32L151xE) || defined(STM32L151xDX) || defined (STM32L152xE) || defined (STM32L152xDX) || defined (STM32L162xE) || defined (STM32L162xDX)
   /* If RTC_CR_BYPSHAD bit = 0, wait for synchro else this check is not needed */
   if ((hrtc->Instance->CR & RTC_CR_BYPSHAD) == RESET)
@@ -1732,15 +1693,10 @@ HAL_StatusTypeDef HAL_RTC_WaitForSynchro(RTC_HandleTypeDef *hrtc)
     /* Clear RSF flag */
     hrtc->Instance->ISR &= (uint32_t)RTC_RSF_MASK;
 
-    tickstart = HAL_GetTick();
-
     /* Wait the registers to be synchronised */
-    while ((hrtc->Instance->ISR & RTC_ISR_RSF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_RSF, RTC_ISR_RSF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
   }
 
@@ -1795,22 +1751,16 @@ HAL_RTCStateTypeDef HAL_RTC_GetState(RTC_HandleTypeDef *hrtc)
   */
 HAL_StatusTypeDef RTC_EnterInitMode(RTC_HandleTypeDef *hrtc)
 {
-  uint32_t tickstart;
-
   /* Check if the Initialization mode is set */
   if ((hrtc->Instance->ISR & RTC_ISR_INITF) == 0U)
   {
     /* Set the Initialization mode */
     hrtc->Instance->ISR = (uint32_t)RTC_INIT_MASK;
 
-    tickstart = HAL_GetTick();
     /* Wait till RTC is in INIT state and if Time out is reached exit */
-    while ((hrtc->Instance->ISR & RTC_ISR_INITF) == 0U)
+    if (HAL_WaitFlag(&hrtc->Instance->ISR, RTC_ISR_INITF, RTC_ISR_INITF, RTC_TIMEOUT_VALUE) != HAL_OK)
     {
-      if ((HAL_GetTick() - tickstart) >  RTC_TIMEOUT_VALUE)
-      {
-        return HAL_TIMEOUT;
-      }
+      return HAL_TIMEOUT;
     }
   }
 
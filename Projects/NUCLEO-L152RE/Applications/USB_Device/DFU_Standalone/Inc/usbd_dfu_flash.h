@@ -32,6 +32,7 @@
 extern USBD_DFU_MediaTypeDef  USBD_DFU_Flash_fops;
 
 /* Exported functions ------------------------------------------------------- */
+uint32_t Flash_If_UpdatePending(void);
 
 #endif /* __USBD_DFU_FLASH_H_ */
 
@@ -59,8 +59,9 @@ int main(void)
   /* Configure KEY Button */
   BSP_PB_Init(BUTTON_USER, BUTTON_MODE_GPIO);
 
-  /* Check if the KEY Button is pressed */
-  if(BSP_PB_GetState(BUTTON_USER) == GPIO_PIN_SET)
+  /* Check if the KEY Button is pressed, and that no delta image was
+     interrupted: a partly patched application is not started */
+  if((BSP_PB_GetState(BUTTON_USER) == GPIO_PIN_SET) && (Flash_If_UpdatePending() == 0U))
   {
     /* Test if user code is programmed starting from address 0x08007000 */
     if(((*(__IO uint32_t*)USBD_DFU_APP_DEFAULT_ADD) & 0x2FFE0000 ) == 0x20000000)
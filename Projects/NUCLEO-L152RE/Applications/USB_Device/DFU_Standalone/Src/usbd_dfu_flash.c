@@ -3,6 +3,42 @@
   * @file    USB_Device/DFU_Standalone/Src/usbd_dfu_flash.c
   * @author  MCD Application Team
   * @brief   Memory management layer
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) The downloaded bytes are gathered in a RAM copy of their flash page.
+        A page is written when the download leaves it: left alone if its
+        content did not change, else erased and programmed in two half
+        pages by HAL_FLASHEx_HalfPageProgram(), run from RAM. An update
+        only wears the pages it changes; the DFU erase commands are
+        accepted and do nothing.
+    (#) A download starting with DFU_DELTA_MAGIC at USBD_DFU_APP_DEFAULT_ADD
+        is a delta image, made by Utilities/Delta/dfu_delta.py: a header,
+        then operations patching the application in place. Each operation
+        keeps (COPY) or replaces (DATA) the next bytes of the application,
+        so each byte of the new image only depends on the old byte at the
+        same address. The delta is refused unless the flash holds the image
+        it was made from (BaseCrc), and checked against TargetCrc at the
+        end of the download.
+    (#) While a delta is applied, a checkpoint in data EEPROM holds its
+        TargetCrc and the end of the last page written. After a reset or a
+        lost connection the same delta is accepted again although the flash
+        no longer matches BaseCrc, and the pages below the checkpoint are
+        skipped: the update resumes where it stopped. Flash_If_UpdatePending()
+        keeps the device in DFU mode until then.
+    (#) Before a page is erased for a delta, its content is saved with its
+        address in data EEPROM, below the checkpoint. A reset between the
+        erase and the end of the programming leaves a torn page: the resume
+        takes the bytes kept by the COPY operations from the saved copy,
+        not from the flash. The copy costs up to 66 data EEPROM words per
+        page changed, only the words that differ are written.
+        Utilities/HostTest/dfu_test.c cuts the power at each flash and data
+        EEPROM operation of a delta, then resumes it.
+
+  @endverbatim
   ******************************************************************************
   * @attention
   *
@@ -20,17 +56,110 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_dfu_flash.h"
 #include "stm32l1xx_hal.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Delta image header, little endian
+  */
+typedef struct
+{
+  uint32_t Magic;          /*!< DFU_DELTA_MAGIC                               */
+  uint32_t Address;        /*!< First byte of the patched image, page aligned */
+  uint32_t BaseSize;       /*!< Bytes of the image the delta applies to       */
+  uint32_t BaseCrc;        /*!< CRC of those bytes                            */
+  uint32_t TargetSize;     /*!< Bytes of the new image, multiple of 4         */
+  uint32_t TargetCrc;      /*!< CRC of the new image                          */
+} DFU_DeltaHeaderTypeDef;
+
+/**
+  * @brief  Progress of a delta image, in data EEPROM
+  */
+typedef struct
+{
+  uint32_t TargetCrc;      /*!< Delta being applied, 0 if none                */
+  uint32_t Address;        /*!< The pages below are written                   */
+} DFU_CheckpointTypeDef;
+
+/**
+  * @brief  Copy of the page being rewritten by a delta, in data EEPROM
+  */
+typedef struct
+{
+  uint32_t TargetCrc;      /*!< Delta being applied                           */
+  uint32_t Address;        /*!< Page saved, written last, 0 if none           */
+  uint32_t Data[FLASH_PAGE_SIZE / 4U];
+} DFU_SavedPageTypeDef;
+
+/**
+  * @brief  Download decoder state
+  */
+typedef enum
+{
+  DFU_STREAM_IDLE = 0,     /*!< No download since the last DeInit             */
+  DFU_STREAM_IMAGE,        /*!< Plain image, bytes written at their address   */
+  DFU_STREAM_HEADER,       /*!< Delta header being received                   */
+  DFU_STREAM_OP,           /*!< Next operation byte                           */
+  DFU_STREAM_LENGTH_LOW,   /*!< 16-bit operation length                       */
+  DFU_STREAM_LENGTH_HIGH,
+  DFU_STREAM_DATA,         /*!< Bytes of a DATA operation                     */
+  DFU_STREAM_ERROR         /*!< Refused, until the next download              */
+} DFU_StreamTypeDef;
+
 /* Private define ------------------------------------------------------------*/
 /*128 pages of 2 Kbytes*/
 #define FLASH_DESC_STR      "@Internal Flash   /0x08000000/12*01Ka,84*01Kg"
 #define FLASH_ERASE_TIME    (uint16_t)50
-#define FLASH_PROGRAM_TIME  (uint16_t)50                                                             
-                                                             
+#define FLASH_PROGRAM_TIME  (uint16_t)50
+
+/* "DLT1", first word of a delta image */
+#define DFU_DELTA_MAGIC         0x31544C44U
+
+/* Operation byte: DATA or COPY, length 1 to 127, or 0 for a 16-bit length */
+#define DFU_OP_DATA             0x80U
+#define DFU_OP_LENGTH           0x7FU
+
+#define DFU_HALF_PAGE_SIZE      (FLASH_PAGE_SIZE / 2U)
+#define DFU_NO_PAGE             0xFFFFFFFFU
+
+/* Last 8 bytes of the data EEPROM, away from the application data */
+#define DFU_CHECKPOINT_ADDRESS  (FLASH_EEPROM_END + 1U - sizeof(DFU_CheckpointTypeDef))
+
+/* Right below the checkpoint */
+#define DFU_SAVED_PAGE_ADDRESS  (DFU_CHECKPOINT_ADDRESS - sizeof(DFU_SavedPageTypeDef))
+
 /* Private macro -------------------------------------------------------------*/
+#define DFU_PAGE_OF(address)    ((address) & ~(FLASH_PAGE_SIZE - 1U))
+
 /* Private variables ---------------------------------------------------------*/
+static CRC_HandleTypeDef CrcHandle;
+
+/* RAM copy of the page being written, word aligned for the half page writes */
+static uint32_t PageBuffer[FLASH_PAGE_SIZE / 4U];
+static uint32_t PageAddress = DFU_NO_PAGE;
+
+static DFU_StreamTypeDef StreamState = DFU_STREAM_IDLE;
+static uint32_t StreamNext;             /* Next download address           */
+static uint32_t OutAddress;             /* Next byte of the image          */
+static uint32_t OutEnd;                 /* End of the image                */
+static uint32_t ResumeAddress;          /* Pages below are already written */
+static uint32_t RestoreAddress = DFU_NO_PAGE; /* Page read from the saved copy */
+static uint32_t OpLength;
+static uint8_t  OpCode;
+
+static DFU_DeltaHeaderTypeDef Delta;
+static uint32_t DeltaCount;             /* Header bytes received           */
+
 /* Private function prototypes -----------------------------------------------*/
+static uint16_t DFU_PageFlush(void);
+static uint16_t DFU_PageSave(uint32_t Page);
+static uint16_t DFU_EepromWrite(const uint32_t *Word, uint32_t Value);
+static uint16_t DFU_Put(const uint8_t *Data, uint32_t Size);
+static uint16_t DFU_DeltaStart(void);
+static uint16_t DFU_DeltaEnd(void);
+static uint16_t DFU_Stream(const uint8_t *Data, uint32_t Size);
+static void     DFU_Checkpoint(uint32_t TargetCrc, uint32_t Address);
+
 /* Extern function prototypes ------------------------------------------------*/
 uint16_t Flash_If_Init(void);
 uint16_t Flash_If_Erase(uint32_t Add);
@@ -46,7 +175,7 @@ USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops= {
   Flash_If_Erase,
   Flash_If_Write,
   Flash_If_Read,
-  Flash_If_GetStatus,  
+  Flash_If_GetStatus,
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -56,48 +185,63 @@ USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops= {
   * @retval 0 if operation is successeful, MAL_FAIL else.
   */
 uint16_t Flash_If_Init(void)
-{ 
-  /* Unlock the internal flash */  
+{
+  /* CRC-32/MPEG-2 of the delta images */
+  __HAL_RCC_CRC_CLK_ENABLE();
+  CrcHandle.Instance = CRC;
+  HAL_CRC_Init(&CrcHandle);
+
+  /* Unlock the internal flash, the data EEPROM with it */
   HAL_FLASH_Unlock();
   return 0;
 }
 
 /**
   * @brief  De-Initializes Memory.
+  * @note   Called when the download ends: the last page is written and a
+  *         delta image checked.
   * @param  None
   * @retval 0 if operation is successeful, MAL_FAIL else.
   */
 uint16_t Flash_If_DeInit(void)
-{ 
+{
+  uint16_t status = 0;
+
+  switch (StreamState)
+  {
+  case DFU_STREAM_IDLE:
+    break;
+
+  case DFU_STREAM_IMAGE:
+    status = DFU_PageFlush();
+    break;
+
+  case DFU_STREAM_OP:
+    status = DFU_DeltaEnd();
+    break;
+
+  default:
+    /* Delta cut short: the pages decoded so far are kept for a resume */
+    DFU_PageFlush();
+    status = 1;
+    break;
+  }
+  StreamState = DFU_STREAM_IDLE;
+
   /* Lock the internal flash */
   HAL_FLASH_Lock();
-  return 0;
+  return status;
 }
 
 /**
   * @brief  Erases sector.
+  * @note   Nothing is erased here: Flash_If_Write() erases a page only when
+  *         its content changes.
   * @param  Add: Address of sector to be erased.
   * @retval 0 if operation is successeful, MAL_FAIL else.
   */
 uint16_t Flash_If_Erase(uint32_t Add)
 {
-  uint32_t NbOfPages = 0;
-  uint32_t PageError = 0;
-  /* Variable contains Flash operation status */
-  HAL_StatusTypeDef status;
-  FLASH_EraseInitTypeDef eraseinitstruct;
-
-   /* Get the number of sector to erase from 1st sector*/
-  NbOfPages = (USBD_DFU_APP_END_ADD - USBD_DFU_APP_DEFAULT_ADD) / FLASH_PAGE_SIZE;
-  eraseinitstruct.TypeErase = FLASH_TYPEERASE_PAGES;
-  eraseinitstruct.PageAddress = USBD_DFU_APP_DEFAULT_ADD;
-  eraseinitstruct.NbPages = NbOfPages;
-  status = HAL_FLASHEx_Erase(&eraseinitstruct, &PageError);
-
-  if (status != HAL_OK)
-  {
-    return 1;
-  }
   return 0;
 }
 
@@ -110,28 +254,57 @@ uint16_t Flash_If_Erase(uint32_t Add)
   */
 uint16_t Flash_If_Write(uint8_t *src, uint8_t *dest, uint32_t Len)
 {
-  uint32_t i = 0;
-  
-  for(i = 0; i < Len; i+=4)
+  uint32_t address = (uint32_t)dest;
+
+  if (address == USBD_DFU_APP_DEFAULT_ADD)
   {
-    /* Device voltage range supposed to be [2.7V to 3.6V], the operation will
-       be done by byte */ 
-    if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, (uint32_t)(dest+i), *(uint32_t*)(src+i)) == HAL_OK)
+    /* New download, plain or delta image */
+    if (DFU_PageFlush() != 0U)
     {
-     /* Check the written value */
-      if(*(uint32_t *)(src + i) != *(uint32_t*)(dest+i))
-      {
-        /* Flash content doesn't match SRAM content */
-        return 2;
-      }
+      StreamState = DFU_STREAM_ERROR;
+      return 1;
+    }
+    ResumeAddress = 0U;
+    RestoreAddress = DFU_NO_PAGE;
+    if ((Len >= 4U) && (*(uint32_t *)src == DFU_DELTA_MAGIC))
+    {
+      StreamState = DFU_STREAM_HEADER;
+      DeltaCount = 0U;
     }
     else
     {
-      /* Error occurred while writing data in Flash memory */
-      return 1;
+      StreamState = DFU_STREAM_IMAGE;
+      OutEnd = USBD_DFU_APP_END_ADD;
     }
   }
-  return 0;
+  else if (StreamState == DFU_STREAM_IDLE)
+  {
+    /* Plain image elsewhere in the application area */
+    ResumeAddress = 0U;
+    RestoreAddress = DFU_NO_PAGE;
+    StreamState = DFU_STREAM_IMAGE;
+    OutEnd = USBD_DFU_APP_END_ADD;
+  }
+  else if ((StreamState != DFU_STREAM_IMAGE) && (address != StreamNext))
+  {
+    /* Delta blocks out of order: the patched image would be wrong */
+    StreamState = DFU_STREAM_ERROR;
+  }
+  StreamNext = address + Len;
+
+  switch (StreamState)
+  {
+  case DFU_STREAM_IMAGE:
+    OutAddress = address;
+    return DFU_Put(src, Len);
+
+  case DFU_STREAM_ERROR:
+  case DFU_STREAM_IDLE:
+    return 1;
+
+  default:
+    return DFU_Stream(src, Len);
+  }
 }
 
 /**
@@ -145,13 +318,16 @@ uint8_t *Flash_If_Read(uint8_t *src, uint8_t *dest, uint32_t Len)
 {
   uint32_t i = 0;
   uint8_t *psrc = src;
-  
+
+  /* The page in RAM is read back from flash */
+  DFU_PageFlush();
+
   for(i = 0; i < Len; i++)
   {
     dest[i] = *psrc++;
   }
   /* Return a valid address to avoid HardFault */
-  return (uint8_t*)(dest); 
+  return (uint8_t*)(dest);
 }
 
 /**
@@ -167,17 +343,369 @@ uint16_t Flash_If_GetStatus(uint32_t Add, uint8_t Cmd, uint8_t *buffer)
   case DFU_MEDIA_PROGRAM:
     buffer[1] = (uint8_t)FLASH_PROGRAM_TIME;
     buffer[2] = (uint8_t)(FLASH_PROGRAM_TIME << 8);
-    buffer[3] = 0;  
+    buffer[3] = 0;
     break;
-    
+
   case DFU_MEDIA_ERASE:
   default:
     buffer[1] = (uint8_t)FLASH_ERASE_TIME;
     buffer[2] = (uint8_t)(FLASH_ERASE_TIME << 8);
-    buffer[3] = 0;  
+    buffer[3] = 0;
     break;
-  }                             
-  return 0; 
+  }
+  return 0;
+}
+
+/**
+  * @brief  Tells if a delta image was interrupted.
+  * @param  None
+  * @retval 1 if the application is partly patched, 0 else.
+  */
+uint32_t Flash_If_UpdatePending(void)
+{
+  return (((DFU_CheckpointTypeDef *)DFU_CHECKPOINT_ADDRESS)->TargetCrc != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Writes the page in RAM to flash if it changed.
+  * @param  None
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+static uint16_t DFU_PageFlush(void)
+{
+  FLASH_EraseInitTypeDef erase;
+  uint32_t error, half;
+  uint32_t page = PageAddress;
+
+  PageAddress = DFU_NO_PAGE;
+  if ((page == DFU_NO_PAGE) || (page < ResumeAddress) ||
+      (memcmp(PageBuffer, (const void *)page, FLASH_PAGE_SIZE) == 0))
+  {
+    return 0;
+  }
+
+  /* The bytes a delta keeps are lost if the power fails between the erase
+     and the end of the programming */
+  if ((ResumeAddress != 0U) && (DFU_PageSave(page) != 0U))
+  {
+    return 1;
+  }
+
+  erase.TypeErase   = FLASH_TYPEERASE_PAGES;
+  erase.PageAddress = page;
+  erase.NbPages     = 1U;
+  if (HAL_FLASHEx_Erase(&erase, &error) != HAL_OK)
+  {
+    return 1;
+  }
+
+  /* 32 words at a time from RAM, instead of one word per operation */
+  for (half = 0U; half < FLASH_PAGE_SIZE; half += DFU_HALF_PAGE_SIZE)
+  {
+    if (HAL_FLASHEx_HalfPageProgram(page + half, &PageBuffer[half / 4U]) != HAL_OK)
+    {
+      return 1;
+    }
+  }
+
+  if (memcmp(PageBuffer, (const void *)page, FLASH_PAGE_SIZE) != 0)
+  {
+    /* Flash content doesn't match SRAM content */
+    return 2;
+  }
+
+  /* A page flushed before the decoder left it is patched again on resume */
+  if ((ResumeAddress != 0U) && (OutAddress >= (page + FLASH_PAGE_SIZE)))
+  {
+    DFU_Checkpoint(Delta.TargetCrc, page + FLASH_PAGE_SIZE);
+  }
+  return 0;
+}
+
+/**
+  * @brief  Saves a page of the application in data EEPROM before it is
+  *         erased for a delta.
+  * @note   Address is cleared first and written last: a torn save leaves no
+  *         copy, and the page is not erased yet. A page already saved is not
+  *         saved again, its flash content may be the torn one.
+  * @param  Page: Page address
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+static uint16_t DFU_PageSave(uint32_t Page)
+{
+  const DFU_SavedPageTypeDef *saved = (const DFU_SavedPageTypeDef *)DFU_SAVED_PAGE_ADDRESS;
+  const uint32_t *flash = (const uint32_t *)Page;
+  uint16_t status = 0;
+  uint32_t i;
+
+  if ((saved->TargetCrc == Delta.TargetCrc) && (saved->Address == Page))
+  {
+    return 0;
+  }
+
+  status |= DFU_EepromWrite(&saved->Address, 0U);
+  for (i = 0U; i < (FLASH_PAGE_SIZE / 4U); i++)
+  {
+    status |= DFU_EepromWrite(&saved->Data[i], flash[i]);
+  }
+  status |= DFU_EepromWrite(&saved->TargetCrc, Delta.TargetCrc);
+  status |= DFU_EepromWrite(&saved->Address, Page);
+  return status;
+}
+
+/**
+  * @brief  Writes a data EEPROM word if its value changes.
+  * @param  Word: Data EEPROM word
+  * @param  Value: New value
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+static uint16_t DFU_EepromWrite(const uint32_t *Word, uint32_t Value)
+{
+  if (*Word == Value)
+  {
+    return 0;
+  }
+  return (HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD, (uint32_t)Word, Value) == HAL_OK) ? 0U : 1U;
+}
+
+/**
+  * @brief  Writes the next bytes of the image.
+  * @param  Data: New bytes, or NULL to keep the bytes in flash
+  * @param  Size: Number of bytes
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+static uint16_t DFU_Put(const uint8_t *Data, uint32_t Size)
+{
+  uint32_t count;
+
+  if ((OutAddress < USBD_DFU_APP_DEFAULT_ADD) || (OutAddress > OutEnd) ||
+      (Size > (OutEnd - OutAddress)))
+  {
+    return 1;
+  }
+
+  while (Size != 0U)
+  {
+    if (DFU_PAGE_OF(OutAddress) != PageAddress)
+    {
+      if (DFU_PageFlush() != 0U)
+      {
+        return 1;
+      }
+      PageAddress = DFU_PAGE_OF(OutAddress);
+      if (PageAddress == RestoreAddress)
+      {
+        /* Page being rewritten when the delta stopped: it may be torn */
+        memcpy(PageBuffer, ((const DFU_SavedPageTypeDef *)DFU_SAVED_PAGE_ADDRESS)->Data, FLASH_PAGE_SIZE);
+        RestoreAddress = DFU_NO_PAGE;
+      }
+      else
+      {
+        memcpy(PageBuffer, (const void *)PageAddress, FLASH_PAGE_SIZE);
+      }
+    }
+
+    count = PageAddress + FLASH_PAGE_SIZE - OutAddress;
+    if (count > Size)
+    {
+      count = Size;
+    }
+    if (Data != NULL)
+    {
+      memcpy((uint8_t *)PageBuffer + (OutAddress - PageAddress), Data, count);
+      Data += count;
+    }
+    OutAddress += count;
+    Size -= count;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Checks a delta header against the flash and the checkpoint.
+  * @param  None
+  * @retval 0 if the delta applies, MAL_FAIL else.
+  */
+static uint16_t DFU_DeltaStart(void)
+{
+  const DFU_CheckpointTypeDef *checkpoint = (const DFU_CheckpointTypeDef *)DFU_CHECKPOINT_ADDRESS;
+  const DFU_SavedPageTypeDef *saved = (const DFU_SavedPageTypeDef *)DFU_SAVED_PAGE_ADDRESS;
+
+  if ((Delta.Address < USBD_DFU_APP_DEFAULT_ADD) ||
+      (DFU_PAGE_OF(Delta.Address) != Delta.Address) ||
+      (Delta.TargetSize > (USBD_DFU_APP_END_ADD - Delta.Address)) ||
+      (Delta.BaseSize > (USBD_DFU_APP_END_ADD - Delta.Address)) ||
+      ((Delta.TargetSize % 4U) != 0U) || ((Delta.BaseSize % 4U) != 0U) ||
+      (Delta.TargetCrc == 0U))
+  {
+    return 1;
+  }
+
+  if ((checkpoint->TargetCrc == Delta.TargetCrc) &&
+      (checkpoint->Address >= Delta.Address) &&
+      (checkpoint->Address <= (Delta.Address + Delta.TargetSize + FLASH_PAGE_SIZE)))
+  {
+    /* Same delta again: carry on after the last page written, the page
+       saved above it is read from its copy */
+    ResumeAddress = checkpoint->Address;
+    if ((saved->TargetCrc == Delta.TargetCrc) && (saved->Address >= ResumeAddress) &&
+        (saved->Address < (Delta.Address + Delta.TargetSize)))
+    {
+      RestoreAddress = saved->Address;
+    }
+  }
+  else if ((HAL_CRC_Calculate(&CrcHandle, (uint32_t *)Delta.Address, Delta.BaseSize / 4U) == Delta.BaseCrc) ||
+           (HAL_CRC_Calculate(&CrcHandle, (uint32_t *)Delta.Address, Delta.TargetSize / 4U) == Delta.TargetCrc))
+  {
+    /* From the base image, or again over the target image: no page changes.
+       A copy left by an earlier delta does not apply to this flash. */
+    ResumeAddress = Delta.Address;
+    DFU_EepromWrite(&saved->Address, 0U);
+    DFU_Checkpoint(Delta.TargetCrc, ResumeAddress);
+  }
+  else
+  {
+    /* Made for another image */
+    return 1;
+  }
+
+  OutAddress = Delta.Address;
+  OutEnd     = Delta.Address + Delta.TargetSize;
+  return 0;
+}
+
+/**
+  * @brief  Writes the last page and checks the patched image.
+  * @param  None
+  * @retval 0 if the image is right, MAL_FAIL else.
+  */
+static uint16_t DFU_DeltaEnd(void)
+{
+  if ((DFU_PageFlush() != 0U) || (OutAddress != OutEnd) ||
+      (HAL_CRC_Calculate(&CrcHandle, (uint32_t *)Delta.Address, Delta.TargetSize / 4U) != Delta.TargetCrc))
+  {
+    /* The checkpoint stays: the same delta can be sent again */
+    return 1;
+  }
+
+  DFU_Checkpoint(0U, 0U);
+  return 0;
+}
+
+/**
+  * @brief  Decodes the next bytes of a delta image.
+  * @param  Data: Downloaded bytes
+  * @param  Size: Number of bytes
+  * @retval 0 if operation is successeful, MAL_FAIL else.
+  */
+static uint16_t DFU_Stream(const uint8_t *Data, uint32_t Size)
+{
+  uint32_t count;
+
+  while (Size != 0U)
+  {
+    switch (StreamState)
+    {
+    case DFU_STREAM_HEADER:
+      ((uint8_t *)&Delta)[DeltaCount++] = *Data++;
+      Size--;
+      if (DeltaCount == sizeof(Delta))
+      {
+        StreamState = (DFU_DeltaStart() == 0U) ? DFU_STREAM_OP : DFU_STREAM_ERROR;
+      }
+      break;
+
+    case DFU_STREAM_OP:
+      OpCode   = *Data & DFU_OP_DATA;
+      OpLength = *Data & DFU_OP_LENGTH;
+      Data++;
+      Size--;
+      StreamState = (OpLength == 0U) ? DFU_STREAM_LENGTH_LOW : DFU_STREAM_DATA;
+      break;
+
+    case DFU_STREAM_LENGTH_LOW:
+      OpLength = *Data++;
+      Size--;
+      StreamState = DFU_STREAM_LENGTH_HIGH;
+      break;
+
+    case DFU_STREAM_LENGTH_HIGH:
+      OpLength |= (uint32_t)*Data++ << 8;
+      Size--;
+      StreamState = DFU_STREAM_DATA;
+      break;
+
+    case DFU_STREAM_DATA:
+      if (OpCode == DFU_OP_DATA)
+      {
+        count = (OpLength < Size) ? OpLength : Size;
+        if (DFU_Put(Data, count) != 0U)
+        {
+          StreamState = DFU_STREAM_ERROR;
+          break;
+        }
+        Data += count;
+        Size -= count;
+      }
+      else
+      {
+        count = OpLength;
+        if (DFU_Put(NULL, count) != 0U)
+        {
+          StreamState = DFU_STREAM_ERROR;
+          break;
+        }
+      }
+      OpLength -= count;
+      if (OpLength == 0U)
+      {
+        StreamState = DFU_STREAM_OP;
+      }
+      break;
+
+    default:
+      return 1;
+    }
+  }
+
+  /* A COPY ending the block is applied before the next one arrives */
+  if ((StreamState == DFU_STREAM_DATA) && (OpCode != DFU_OP_DATA))
+  {
+    if (DFU_Put(NULL, OpLength) != 0U)
+    {
+      StreamState = DFU_STREAM_ERROR;
+      return 1;
+    }
+    StreamState = DFU_STREAM_OP;
+  }
+
+  return (StreamState == DFU_STREAM_ERROR) ? 1U : 0U;
+}
+
+/**
+  * @brief  Records the progress of a delta image in data EEPROM.
+  * @note   The address is written before a new TargetCrc, and the TargetCrc
+  *         cleared first: a torn update leaves no checkpoint, never a wrong
+  *         one. The data EEPROM was unlocked with the program memory by
+  *         HAL_FLASH_Unlock(): HAL_FLASHEx_DATAEEPROM_Lock() would lock both.
+  * @param  TargetCrc: Delta being applied, 0 when done
+  * @param  Address: End of the last page written
+  * @retval None
+  */
+static void DFU_Checkpoint(uint32_t TargetCrc, uint32_t Address)
+{
+  const DFU_CheckpointTypeDef *checkpoint = (const DFU_CheckpointTypeDef *)DFU_CHECKPOINT_ADDRESS;
+
+  if (TargetCrc != 0U)
+  {
+    HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD,
+                                   (uint32_t)&checkpoint->Address, Address);
+  }
+  if (checkpoint->TargetCrc != TargetCrc)
+  {
+    HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD,
+                                   (uint32_t)&checkpoint->TargetCrc, TargetCrc);
+  }
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
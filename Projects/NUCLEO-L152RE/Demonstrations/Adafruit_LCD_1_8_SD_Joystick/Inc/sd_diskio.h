@@ -24,9 +24,19 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32_adafruit_sd.h"
 /* Exported types ------------------------------------------------------------*/
+/* Sector cache counters */
+typedef struct
+{
+  uint32_t Hits;        /* Single sector reads served by the cache */
+  uint32_t Misses;      /* Single sector reads from the card */
+  uint32_t Writes;      /* Single sector writes to the cache */
+  uint32_t WriteBacks;  /* Dirty sectors written to the card */
+} SD_CacheStatsTypeDef;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 extern const Diskio_drvTypeDef  SD_Driver;
+void SD_GetCacheStats(SD_CacheStatsTypeDef *Stats);
 
 #endif /* __SD_DISKIO_H */
 
@@ -26,6 +26,19 @@
 #define BITMAP_BUFFER_SIZE 512 /* You can adapt this size depending on the amount of RAM available */
 #define BITMAP_HEADER_SIZE sizeof(BmpHeader) /* Bitmap specificity */
 #define MIN(a,b) (((a)<(b))?(a):(b))
+
+/* Streaming of the bitmaps: each f_read() covers BITMAP_STREAM_SECTORS whole
+   sectors from a sector aligned file position, so that FatFs reads them with
+   one multi-block disk_read() straight into the stream buffer */
+#define BITMAP_STREAM_SECTORS  4
+#define BITMAP_STREAM_SIZE     (BITMAP_STREAM_SECTORS * _MAX_SS)
+#define BITMAP_ROW_MAX         ((160 * 3 + 3) & ~3) /* Longest row of a 24 bpp image */
+#define BITMAP_PIXELS_MAX      ((BITMAP_ROW_MAX + BITMAP_STREAM_SIZE) / 2)
+
+/* BMP compression types */
+#define BITMAP_BI_RGB          0
+#define BITMAP_BI_BITFIELDS    3
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 uint8_t aBuffer[BITMAP_HEADER_SIZE + BITMAP_BUFFER_SIZE];
@@ -34,78 +47,285 @@ DIR MyDirectory;
 FIL MyFile;
 UINT BytesWritten, BytesRead;
 
+/* Sectors read from the file, after the end of the row left from the
+   previous read */
+static uint8_t aStreamBuffer[BITMAP_ROW_MAX + BITMAP_STREAM_SIZE];
+
+/* Converted rows, ping-pong: one is sent by the SPI DMA while the next rows
+   are converted into the other */
+static uint16_t aPixelBuffer[2][BITMAP_PIXELS_MAX];
+
+/* SPI DMA towards the LCD */
+SPI_HandleTypeDef LcdSpiHandle;
+static DMA_HandleTypeDef LcdDmaHandle;
+static __IO uint32_t LcdDmaBusy = 0;
+
 /* Private function prototypes -----------------------------------------------*/
+static void     Storage_LcdDmaInit(void);
+static void     Storage_LcdDmaStart(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pPixels);
+static void     Storage_LcdDmaWait(void);
+static uint32_t Storage_ConvertRows(uint16_t *pPixels, const uint8_t *pRows, uint32_t Width, uint32_t Height,
+                                    uint32_t Stride, BmpHeader *pHeader, uint32_t BottomUp);
+
 /* Private functions ---------------------------------------------------------*/
 
 /**
-  * @brief  Open a file and display it on lcd
-  * @param  DirName: the Directory name to open
-  * @param  FileName: the file name to open
-  * @param  BufferAddress: A pointer to a buffer to copy the file to
-  * @param  FileLen: the File length
+  * @brief  Take over the TX DMA of the LCD SPI.
+  * @note   SPI1 is configured by the BSP: the handle below only mirrors its
+  *         2 lines, 8 bit, no CRC settings for HAL_SPI_Transmit_DMA(), the SPI
+  *         registers are not written again.
+  * @param  None
+  * @retval None
+  */
+static void Storage_LcdDmaInit(void)
+{
+  if (LcdSpiHandle.Instance != NULL)
+  {
+    return;
+  }
+
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* SPI1_TX is on DMA1 channel 3 */
+  LcdDmaHandle.Instance                 = DMA1_Channel3;
+  LcdDmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  LcdDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  LcdDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  LcdDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  LcdDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  LcdDmaHandle.Init.Mode                = DMA_NORMAL;
+  LcdDmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&LcdDmaHandle);
+
+  LcdSpiHandle.Instance               = NUCLEO_SPIx;
+  LcdSpiHandle.Init.Mode              = SPI_MODE_MASTER;
+  LcdSpiHandle.Init.Direction         = SPI_DIRECTION_2LINES;
+  LcdSpiHandle.Init.DataSize          = SPI_DATASIZE_8BIT;
+  LcdSpiHandle.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+  LcdSpiHandle.State                  = HAL_SPI_STATE_READY;
+  __HAL_LINKDMA(&LcdSpiHandle, hdmatx, LcdDmaHandle);
+
+  HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
+
+/**
+  * @brief  Open a LCD window and start sending its pixels through the DMA.
+  * @note   The SD card shares the SPI: the transfer must be over, see
+  *         Storage_LcdDmaWait(), before the next f_read().
+  * @param  Xpos: Window column
+  * @param  Ypos: Window line
+  * @param  Width: Window width
+  * @param  Height: Window height
+  * @param  pPixels: Width x Height pixels, RGB565 high byte first
+  * @retval None
+  */
+static void Storage_LcdDmaStart(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pPixels)
+{
+  st7735_SetDisplayWindow(Xpos, Ypos, Width, Height);
+  LCD_IO_WriteReg(LCD_REG_44);
+
+  /* Pixel data, the chip select is released by the transfer complete */
+  LCD_DC_HIGH();
+  LCD_CS_LOW();
+  LcdDmaBusy = 1;
+  if (HAL_SPI_Transmit_DMA(&LcdSpiHandle, (uint8_t *)pPixels, (uint16_t)(Width * Height * 2)) != HAL_OK)
+  {
+    LCD_CS_HIGH();
+    LcdDmaBusy = 0;
+  }
+}
+
+/**
+  * @brief  Wait for the end of the LCD transfer.
+  * @param  None
+  * @retval None
+  */
+static void Storage_LcdDmaWait(void)
+{
+  while (LcdDmaBusy != 0)
+  {
+  }
+}
+
+/**
+  * @brief  Tx Transfer completed callback: release the LCD.
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* The last byte is still shifted out when the DMA ends */
+  while (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_BSY) != RESET)
+  {
+  }
+  LCD_CS_HIGH();
+  LcdDmaBusy = 0;
+}
+
+/**
+  * @brief  Convert bitmap rows to the LCD pixel format.
+  * @note   The rows of a bottom-up bitmap are stored in reverse order, so
+  *         that the pixels are sent top to bottom.
+  * @param  pPixels: Converted pixels, RGB565 high byte first
+  * @param  pRows: First row read from the file
+  * @param  Width: Pixels per row
+  * @param  Height: Rows to convert
+  * @param  Stride: Bytes per row in the file, padding included
+  * @param  pHeader: Bitmap header
+  * @param  BottomUp: Non zero for a bottom-up bitmap
+  * @retval Number of pixels converted
+  */
+static uint32_t Storage_ConvertRows(uint16_t *pPixels, const uint8_t *pRows, uint32_t Width, uint32_t Height,
+                                    uint32_t Stride, BmpHeader *pHeader, uint32_t BottomUp)
+{
+  uint32_t row, col, pixel;
+  const uint8_t *psrc;
+  uint8_t *pdst;
+
+  for (row = 0; row < Height; row++)
+  {
+    psrc = pRows + row * Stride;
+    pdst = (uint8_t *)(pPixels + ((BottomUp != 0) ? (Height - 1 - row) : row) * Width);
+
+    if (pHeader->bpp == 24)
+    {
+      /* BGR888 */
+      for (col = 0; col < Width; col++, psrc += 3)
+      {
+        pixel = ((psrc[2] & 0xF8U) << 8) | ((psrc[1] & 0xFCU) << 3) | (psrc[0] >> 3);
+        *pdst++ = (uint8_t)(pixel >> 8);
+        *pdst++ = (uint8_t)pixel;
+      }
+    }
+    else if (pHeader->ctype == BITMAP_BI_BITFIELDS)
+    {
+      /* RGB565 little endian */
+      for (col = 0; col < Width; col++, psrc += 2)
+      {
+        *pdst++ = psrc[1];
+        *pdst++ = psrc[0];
+      }
+    }
+    else
+    {
+      /* XRGB1555 little endian */
+      for (col = 0; col < Width; col++, psrc += 2)
+      {
+        pixel = psrc[0] | (psrc[1] << 8);
+        pixel = ((pixel & 0x7FE0U) << 1) | ((pixel & 0x0200U) >> 4) | (pixel & 0x001FU);
+        *pdst++ = (uint8_t)(pixel >> 8);
+        *pdst++ = (uint8_t)pixel;
+      }
+    }
+  }
+  return Width * Height;
+}
+
+/**
+  * @brief  Open a bitmap file and display it on lcd
+  * @note   The file is streamed: the sectors read are converted while the
+  *         previous rows are sent to the LCD by the SPI DMA. 16 bpp (565 or
+  *         555) and 24 bpp bitmaps are supported, bottom-up or top-down.
+  * @param  Xpoz: Column of the bitmap on the LCD
+  * @param  Ypoz: Line of the bitmap on the LCD
+  * @param  BmpName: the file name to open
   * @retval err: Error status (0=> success, 1=> fail)
   */
 uint32_t Storage_OpenReadFile(uint8_t Xpoz, uint16_t Ypoz, const char *BmpName)
 {
-  uint32_t size = 0;
   FIL bmpfile;
-  uint32_t nbline;
-  BmpHeader* pbmpheader = (BmpHeader*)aBuffer;
-  
-  /* Close a bmp file */
-  f_open(&bmpfile, BmpName, FA_READ);
-  
-  /* Read the constant part of the header from the file and store it at the top of aBuffer*/
-  f_read(&bmpfile, &aBuffer, BITMAP_HEADER_SIZE, &BytesRead);
-  
-  /* Get the size of the data stored inside the file */
-  size = pbmpheader->fsize - pbmpheader->offset;
-  
-  /* Start reading at the top of the file */
-  f_lseek(&bmpfile, 0);
-  
-  /* Read the entire header from the file and store it at the top of aBuffer */
-  f_read(&bmpfile, &aBuffer, pbmpheader->offset, &BytesRead);
-  
-  /* Compute the number of entire lines which can be stored inside the buffer */
-  nbline = (BITMAP_BUFFER_SIZE - pbmpheader->offset + BITMAP_HEADER_SIZE)/(pbmpheader->w * 2);
-  
-  /* As long as the entire bitmap file as not been displayed */
-  do
+  BmpHeader header;
+  uint32_t width, height, stride, bottomup;
+  uint32_t pos, skip, carry = 0, avail, nbline;
+  uint32_t linedone = 0, ready = 0, readyline = 0, readyy = 0, pingpong = 0;
+  uint32_t err = 0;
+
+  if (f_open(&bmpfile, BmpName, FA_READ) != FR_OK)
   {
-    uint32_t nbbytetoread;
-    
-    /* Get the number of bytes which can be stored inside the buffer */
-    nbbytetoread = MIN(size,nbline*pbmpheader->w*2);
-  
-    /* Adapt the total size of the bitmap, stored inside the header, to this chunck */
-    pbmpheader->fsize = pbmpheader->offset + nbbytetoread;
-  
-    /* Adapt the number of line, stored inside the header, to this chunck */
-    pbmpheader->h = nbbytetoread/(pbmpheader->w*2);
-    
-    /* Start reading at the end of the file */
-    f_lseek(&bmpfile, pbmpheader->offset + size - nbbytetoread);
-    
-    /* Store this chunck (or the entire part if possible) of the file inside a buffer */
-    f_read(&bmpfile, aBuffer + pbmpheader->offset, nbbytetoread, &BytesRead);
-  
-    /* Draw the bitmap */
-    BSP_LCD_DrawBitmap(Xpoz, Ypoz, aBuffer);    
-      
-    /* Update the remaining number of bytes to read */
-    size -= nbbytetoread;
-    
-    /* Change the display position of the next bitmap */
-    Ypoz += nbline;
-      
-  }while (size > 0);
-  
+    return 1;
+  }
+
+  /* Read the constant part of the header */
+  if ((f_read(&bmpfile, &header, BITMAP_HEADER_SIZE, &BytesRead) != FR_OK) ||
+      (BytesRead != BITMAP_HEADER_SIZE) || (header.B != 'B') || (header.M != 'M') ||
+      ((header.bpp != 16) && (header.bpp != 24)) ||
+      ((header.ctype != BITMAP_BI_RGB) && (header.ctype != BITMAP_BI_BITFIELDS)))
+  {
+    f_close(&bmpfile);
+    return 1;
+  }
+
+  /* A negative height is a top-down bitmap */
+  width = header.w;
+  bottomup = ((int32_t)header.h > 0) ? 1 : 0;
+  height = (bottomup != 0) ? header.h : (uint32_t)(-(int32_t)header.h);
+  stride = (width * header.bpp / 8 + 3) & ~3U;
+
+  if ((width == 0) || (stride > BITMAP_ROW_MAX) ||
+      ((Xpoz + width) > BSP_LCD_GetXSize()) || ((Ypoz + height) > BSP_LCD_GetYSize()))
+  {
+    f_close(&bmpfile);
+    return 1;
+  }
+
+  Storage_LcdDmaInit();
+
+  /* Start reading on the sector holding the first pixel */
+  pos = header.offset & ~(uint32_t)(_MAX_SS - 1);
+  skip = header.offset - pos;
+  f_lseek(&bmpfile, pos);
+
+  while ((linedone < height) || (ready != 0))
+  {
+    /* Read the next sectors while the SPI is free */
+    if (linedone < height)
+    {
+      if ((f_read(&bmpfile, aStreamBuffer + carry, BITMAP_STREAM_SIZE, &BytesRead) != FR_OK) ||
+          ((carry + BytesRead) < (skip + stride)))
+      {
+        err = 1;
+        linedone = height;
+      }
+    }
+
+    /* Send the rows converted at the previous turn */
+    if (ready != 0)
+    {
+      Storage_LcdDmaStart(Xpoz, (uint16_t)readyy, (uint16_t)width, (uint16_t)readyline,
+                          aPixelBuffer[pingpong ^ 1]);
+      ready = 0;
+    }
+
+    /* Convert the whole rows read meanwhile */
+    if (linedone < height)
+    {
+      avail = carry + BytesRead - skip;
+      nbline = MIN(avail / stride, height - linedone);
+
+      Storage_ConvertRows(aPixelBuffer[pingpong], aStreamBuffer + skip, width, nbline,
+                          stride, &header, bottomup);
+
+      readyline = nbline;
+      readyy = Ypoz + ((bottomup != 0) ? (height - linedone - nbline) : linedone);
+      ready = 1;
+      pingpong ^= 1;
+      linedone += nbline;
+
+      /* Keep the end of a row cut by the sector boundary */
+      carry = avail - nbline * stride;
+      memmove(aStreamBuffer, aStreamBuffer + skip + nbline * stride, carry);
+      skip = 0;
+    }
+
+    Storage_LcdDmaWait();
+  }
+
   /* Close the bmp file */
   f_close(&bmpfile);
-  
-  return 0;
-}      
+
+  return err;
+}
 
 /**
   * @brief  Copy file BmpName1 to BmpName2 
@@ -2,7 +2,7 @@
   ******************************************************************************
   * @file    Demonstrations/Adafruit_LCD_1_8_SD_Joystick/Src/sd_diskio.c
   * @author  MCD Application Team
-  * @brief   SD Disk I/O driver
+  * @brief   SD Disk I/O driver, with SPI DMA data blocks and a sector cache
   ******************************************************************************
   * @attention
   *
@@ -20,9 +20,18 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ff_gen_drv.h"
 #include "sd_diskio.h"
-
+#include "stm32l1xx_nucleo.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
+/* Cached sector */
+typedef struct
+{
+  DWORD    Sector;      /* SD_CACHE_FREE if the entry holds no sector */
+  uint32_t LastUse;     /* SdCacheClock at the last access, for the LRU */
+  uint32_t Dirty;       /* Written by FatFs, not yet on the card */
+} SD_CacheEntryTypeDef;
+
 /* Private define ------------------------------------------------------------*/
 /* use the default SD timout as defined in the platform BSP driver*/
 #if defined(SDMMC_DATATIMEOUT)
@@ -37,6 +46,7 @@
 #if !defined (SD_BLOCK_SIZE)
 #define SD_BLOCK_SIZE   512
 #endif
+
 /*
  * Depending on the usecase, the SD card initialization could be done at the
  * application level, if it is the case define the flag below to disable
@@ -45,12 +55,66 @@
 
 /* #define DISABLE_SD_INIT */
 
+/*
+ * SPI mode commands and tokens of the data blocks. The BSP only handles
+ * standard capacity cards: the blocks are addressed in bytes.
+ */
+#define SD_SPI_CMD_READ_BLOCK   17U
+#define SD_SPI_CMD_WRITE_BLOCK  24U
+#define SD_SPI_START_TOKEN      0xFEU
+#define SD_SPI_DATA_ACCEPTED    0x05U
+#define SD_SPI_R1_TRIES         8U
+
+/* Longest wait for a data token or for the end of a write, in ms */
+#define SD_SPI_TIMEOUT          500U
+
+/*
+ * Number of sectors kept in RAM. FatFs accesses FAT and directory sectors one
+ * at a time through its window while file data of more than one sector is
+ * transferred directly: single sector requests go through the cache, the
+ * others go straight to the card. Define it to 0 to disable the cache.
+ * Utilities/HostTest/sd_test.c runs the cache on a fake card.
+ */
+#if !defined(SD_CACHE_SECTORS)
+#define SD_CACHE_SECTORS 8
+#endif
+
+#define SD_CACHE_FREE 0xFFFFFFFFU
+
 /* Private variables ---------------------------------------------------------*/
 /* Disk status */
 static volatile DSTATUS Stat = STA_NOINIT;
 
+/* SPI1 and its DMA channels, for the data blocks */
+SPI_HandleTypeDef SdSpiHandle;
+static DMA_HandleTypeDef SdDmaTxHandle;
+static DMA_HandleTypeDef SdDmaRxHandle;
+
+/* Bytes received while a block is written, dropped */
+static uint8_t SdSpiSink[SD_BLOCK_SIZE];
+
+#if SD_CACHE_SECTORS > 0
+static SD_CacheEntryTypeDef SdCache[SD_CACHE_SECTORS];
+static uint32_t SdCacheData[SD_CACHE_SECTORS][SD_BLOCK_SIZE / 4];
+static uint32_t SdCacheClock = 0;
+#endif
+static SD_CacheStatsTypeDef SdCacheStats;
+
 /* Private function prototypes -----------------------------------------------*/
 static DSTATUS SD_CheckStatus(BYTE lun);
+static void SD_SpiInit(void);
+static uint8_t SD_SpiByte(uint8_t Data);
+static uint8_t SD_SpiCommand(uint8_t Cmd, uint32_t Arg);
+static DRESULT SD_SpiBlock(uint8_t *pTx, uint8_t *pRx);
+static void SD_SpiRelease(void);
+static DRESULT SD_ReadDirect(BYTE *buff, DWORD sector, UINT count);
+static DRESULT SD_WriteDirect(const BYTE *buff, DWORD sector, UINT count);
+#if SD_CACHE_SECTORS > 0
+static int32_t SD_CacheFind(DWORD sector);
+static int32_t SD_CacheAlloc(void);
+static DRESULT SD_CacheSync(void);
+static void SD_CacheInvalidate(void);
+#endif
 DSTATUS SD_initialize (BYTE);
 DSTATUS SD_status (BYTE);
 DRESULT SD_read (BYTE, BYTE*, DWORD, UINT);
@@ -88,6 +152,350 @@ static DSTATUS SD_CheckStatus(BYTE lun)
   return Stat;
 }
 
+/**
+  * @brief  Takes over the SPI DMA channels for the data blocks
+  * @note   SPI1 is configured by the BSP: the handle below only mirrors its
+  *         2 lines, 8 bit, no CRC settings for HAL_SPI_TransmitReceive_DMA(),
+  *         the SPI registers are not written again. The TX channel is shared
+  *         with the LCD streaming of fatfs_storage.c, never at the same time.
+  * @param  None
+  * @retval None
+  */
+static void SD_SpiInit(void)
+{
+  if(SdSpiHandle.Instance != NULL)
+  {
+    return;
+  }
+
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* SPI1_RX is on DMA1 channel 2, SPI1_TX on DMA1 channel 3 */
+  SdDmaRxHandle.Instance                 = DMA1_Channel2;
+  SdDmaRxHandle.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  SdDmaRxHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SdDmaRxHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  SdDmaRxHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  SdDmaRxHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  SdDmaRxHandle.Init.Mode                = DMA_NORMAL;
+  SdDmaRxHandle.Init.Priority            = DMA_PRIORITY_VERY_HIGH;
+  HAL_DMA_Init(&SdDmaRxHandle);
+
+  SdDmaTxHandle.Instance                 = DMA1_Channel3;
+  SdDmaTxHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  SdDmaTxHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SdDmaTxHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  SdDmaTxHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  SdDmaTxHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  SdDmaTxHandle.Init.Mode                = DMA_NORMAL;
+  SdDmaTxHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init(&SdDmaTxHandle);
+
+  SdSpiHandle.Instance               = NUCLEO_SPIx;
+  SdSpiHandle.Init.Mode              = SPI_MODE_MASTER;
+  SdSpiHandle.Init.Direction         = SPI_DIRECTION_2LINES;
+  SdSpiHandle.Init.DataSize          = SPI_DATASIZE_8BIT;
+  SdSpiHandle.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+  SdSpiHandle.State                  = HAL_SPI_STATE_READY;
+  __HAL_LINKDMA(&SdSpiHandle, hdmarx, SdDmaRxHandle);
+  __HAL_LINKDMA(&SdSpiHandle, hdmatx, SdDmaTxHandle);
+
+  HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0x0F, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
+
+/**
+  * @brief  Sends a byte to the card and returns the byte received
+  * @param  Data: Byte to send, 0xFF to only receive
+  * @retval Byte received
+  */
+static uint8_t SD_SpiByte(uint8_t Data)
+{
+  uint8_t rx = 0xFF;
+
+  HAL_SPI_TransmitReceive(&SdSpiHandle, &Data, &rx, 1, SD_SPI_TIMEOUT);
+  return rx;
+}
+
+/**
+  * @brief  Selects the card and sends a command
+  * @note   The card stays selected: SD_SpiRelease() ends the transaction.
+  * @param  Cmd: Command index
+  * @param  Arg: Command argument
+  * @retval R1 response, 0 if the command is accepted
+  */
+static uint8_t SD_SpiCommand(uint8_t Cmd, uint32_t Arg)
+{
+  uint8_t r1 = 0xFF;
+  uint32_t i;
+
+  SD_CS_LOW();
+  SD_SpiByte(0xFF);
+
+  SD_SpiByte(0x40U | Cmd);
+  SD_SpiByte((uint8_t)(Arg >> 24));
+  SD_SpiByte((uint8_t)(Arg >> 16));
+  SD_SpiByte((uint8_t)(Arg >> 8));
+  SD_SpiByte((uint8_t)Arg);
+  /* The CRC is only checked in the SPI mode for CMD0 and CMD8 */
+  SD_SpiByte(0xFF);
+
+  for(i = 0; (i < SD_SPI_R1_TRIES) && ((r1 & 0x80U) != 0U); i++)
+  {
+    r1 = SD_SpiByte(0xFF);
+  }
+  return r1;
+}
+
+/**
+  * @brief  Exchanges a data block with the card through the DMA
+  * @param  pTx: SD_BLOCK_SIZE bytes to send
+  * @param  pRx: SD_BLOCK_SIZE bytes received, may be pTx: each byte is sent
+  *         before the byte at the same place is received
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_SpiBlock(uint8_t *pTx, uint8_t *pRx)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  if(HAL_SPI_TransmitReceive_DMA(&SdSpiHandle, pTx, pRx, SD_BLOCK_SIZE) != HAL_OK)
+  {
+    return RES_ERROR;
+  }
+
+  while(HAL_SPI_GetState(&SdSpiHandle) != HAL_SPI_STATE_READY)
+  {
+    if((HAL_GetTick() - tickstart) >= SD_SPI_TIMEOUT)
+    {
+      HAL_SPI_DMAStop(&SdSpiHandle);
+      return RES_ERROR;
+    }
+  }
+  return RES_OK;
+}
+
+/**
+  * @brief  Deselects the card, then gives it the clocks it needs to release
+  *         its data output
+  * @param  None
+  * @retval None
+  */
+static void SD_SpiRelease(void)
+{
+  SD_CS_HIGH();
+  SD_SpiByte(0xFF);
+}
+
+/**
+  * @brief  Reads sectors from the card
+  * @note   The commands and tokens are exchanged byte per byte, the data
+  *         blocks by the DMA at the full SPI clock, rather than through the
+  *         single byte transfers of BSP_SD_ReadBlocks().
+  * @param  *buff: Data buffer to store read data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_ReadDirect(BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+  uint32_t tickstart;
+  uint8_t token;
+
+  for(; (count > 0) && (res == RES_OK); count--, sector++, buff += SD_BLOCK_SIZE)
+  {
+    if(SD_SpiCommand(SD_SPI_CMD_READ_BLOCK, sector * SD_BLOCK_SIZE) != 0)
+    {
+      res = RES_ERROR;
+    }
+    else
+    {
+      tickstart = HAL_GetTick();
+      do
+      {
+        token = SD_SpiByte(0xFF);
+      } while((token == 0xFF) && ((HAL_GetTick() - tickstart) < SD_SPI_TIMEOUT));
+
+      if(token != SD_SPI_START_TOKEN)
+      {
+        res = RES_ERROR;
+      }
+      else
+      {
+        /* The buffer is sent as the 0xFF clocking the data in */
+        memset(buff, 0xFF, SD_BLOCK_SIZE);
+        res = SD_SpiBlock(buff, buff);
+        /* CRC, not checked */
+        SD_SpiByte(0xFF);
+        SD_SpiByte(0xFF);
+      }
+    }
+    SD_SpiRelease();
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Writes sectors to the card
+  * @param  *buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_WriteDirect(const BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+  uint32_t tickstart;
+
+  for(; (count > 0) && (res == RES_OK); count--, sector++, buff += SD_BLOCK_SIZE)
+  {
+    if(SD_SpiCommand(SD_SPI_CMD_WRITE_BLOCK, sector * SD_BLOCK_SIZE) != 0)
+    {
+      res = RES_ERROR;
+    }
+    else
+    {
+      SD_SpiByte(0xFF);
+      SD_SpiByte(SD_SPI_START_TOKEN);
+      res = SD_SpiBlock((uint8_t*)buff, SdSpiSink);
+      /* CRC, not checked */
+      SD_SpiByte(0xFF);
+      SD_SpiByte(0xFF);
+
+      if((res == RES_OK) && ((SD_SpiByte(0xFF) & 0x1FU) != SD_SPI_DATA_ACCEPTED))
+      {
+        res = RES_ERROR;
+      }
+
+      /* The card holds its data output low while it programs the block */
+      tickstart = HAL_GetTick();
+      while((res == RES_OK) && (SD_SpiByte(0xFF) != 0xFF))
+      {
+        if((HAL_GetTick() - tickstart) >= SD_SPI_TIMEOUT)
+        {
+          res = RES_ERROR;
+        }
+      }
+    }
+    SD_SpiRelease();
+  }
+
+  return res;
+}
+
+#if SD_CACHE_SECTORS > 0
+/**
+  * @brief  Looks for a sector in the cache
+  * @param  sector: Sector address (LBA)
+  * @retval Entry index, -1 if the sector is not cached
+  */
+static int32_t SD_CacheFind(DWORD sector)
+{
+  int32_t i;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    if(SdCache[i].Sector == sector)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+  * @brief  Gets a cache entry for a new sector: a free one, else the least
+  *         recently used one, written back first if it is dirty
+  * @param  None
+  * @retval Entry index, -1 if the write back failed
+  */
+static int32_t SD_CacheAlloc(void)
+{
+  int32_t i, lru = 0;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    if(SdCache[i].Sector == SD_CACHE_FREE)
+    {
+      return i;
+    }
+    /* Ages rather than use times, so that the clock may wrap around */
+    if((SdCacheClock - SdCache[i].LastUse) > (SdCacheClock - SdCache[lru].LastUse))
+    {
+      lru = i;
+    }
+  }
+
+  if(SdCache[lru].Dirty != 0)
+  {
+    if(SD_WriteDirect((BYTE*)SdCacheData[lru], SdCache[lru].Sector, 1) != RES_OK)
+    {
+      return -1;
+    }
+    SdCache[lru].Dirty = 0;
+    SdCacheStats.WriteBacks++;
+  }
+  SdCache[lru].Sector = SD_CACHE_FREE;
+
+  return lru;
+}
+
+/**
+  * @brief  Writes all the dirty sectors back to the card
+  * @note   Sectors are written in ascending order, the sequence the card
+  *         handles best.
+  * @param  None
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_CacheSync(void)
+{
+  int32_t i, next;
+
+  do
+  {
+    next = -1;
+    for(i = 0; i < SD_CACHE_SECTORS; i++)
+    {
+      if((SdCache[i].Dirty != 0) && ((next < 0) || (SdCache[i].Sector < SdCache[next].Sector)))
+      {
+        next = i;
+      }
+    }
+
+    if(next >= 0)
+    {
+      if(SD_WriteDirect((BYTE*)SdCacheData[next], SdCache[next].Sector, 1) != RES_OK)
+      {
+        return RES_ERROR;
+      }
+      SdCache[next].Dirty = 0;
+      SdCacheStats.WriteBacks++;
+    }
+  } while(next >= 0);
+
+  return RES_OK;
+}
+
+/**
+  * @brief  Drops all the cached sectors, the card may have been changed
+  * @param  None
+  * @retval None
+  */
+static void SD_CacheInvalidate(void)
+{
+  int32_t i;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    SdCache[i].Sector = SD_CACHE_FREE;
+    SdCache[i].Dirty = 0;
+  }
+}
+#endif /* SD_CACHE_SECTORS > 0 */
+
 /**
   * @brief  Initializes a Drive
   * @param  lun : not used
@@ -96,6 +504,9 @@ static DSTATUS SD_CheckStatus(BYTE lun)
 DSTATUS SD_initialize(BYTE lun)
 {
   Stat = STA_NOINIT;
+#if SD_CACHE_SECTORS > 0
+  SD_CacheInvalidate();
+#endif
 #if !defined(DISABLE_SD_INIT)
 
   if(BSP_SD_Init() == MSD_OK)
@@ -106,6 +517,7 @@ DSTATUS SD_initialize(BYTE lun)
 #else
   Stat = SD_CheckStatus(lun);
 #endif
+  SD_SpiInit();
   return Stat;
 }
 
@@ -121,6 +533,8 @@ DSTATUS SD_status(BYTE lun)
 
 /**
   * @brief  Reads Sector(s)
+  * @note   A single sector is read through the cache. Larger reads go to the
+  *         card, then get the sectors of the range still dirty in the cache.
   * @param  lun : not used
   * @param  *buff: Data buffer to store read data
   * @param  sector: Sector address (LBA)
@@ -129,23 +543,54 @@ DSTATUS SD_status(BYTE lun)
   */
 DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 {
-  DRESULT res = RES_ERROR;
-  if(BSP_SD_ReadBlocks((uint32_t*)buff,
-                       (uint64_t)(sector * SD_BLOCK_SIZE),
-                       SD_BLOCK_SIZE, count) == MSD_OK)
+  DRESULT res;
+#if SD_CACHE_SECTORS > 0
+  int32_t i;
+
+  if(count == 1)
   {
-    /* wait until the read operation is finished */
-    while(BSP_SD_GetStatus()!= MSD_OK)
+    i = SD_CacheFind(sector);
+    if(i >= 0)
     {
+      SdCacheStats.Hits++;
     }
-    res = RES_OK;
+    else
+    {
+      SdCacheStats.Misses++;
+      i = SD_CacheAlloc();
+      if((i < 0) || (SD_ReadDirect((BYTE*)SdCacheData[i], sector, 1) != RES_OK))
+      {
+        return RES_ERROR;
+      }
+      SdCache[i].Sector = sector;
+    }
+    SdCache[i].LastUse = ++SdCacheClock;
+    memcpy(buff, SdCacheData[i], SD_BLOCK_SIZE);
+    return RES_OK;
   }
+#endif /* SD_CACHE_SECTORS > 0 */
+
+  res = SD_ReadDirect(buff, sector, count);
+
+#if SD_CACHE_SECTORS > 0
+  for(i = 0; (i < SD_CACHE_SECTORS) && (res == RES_OK); i++)
+  {
+    if((SdCache[i].Dirty != 0) && (SdCache[i].Sector >= sector) && ((SdCache[i].Sector - sector) < count))
+    {
+      memcpy(buff + (SdCache[i].Sector - sector) * SD_BLOCK_SIZE, SdCacheData[i], SD_BLOCK_SIZE);
+    }
+  }
+#endif /* SD_CACHE_SECTORS > 0 */
 
   return res;
 }
 
 /**
   * @brief  Writes Sector(s)
+  * @note   A single sector is only written to the cache, to the card when
+  *         it is evicted or on CTRL_SYNC: the FAT and directory sectors
+  *         updated again and again while a file grows reach the card once.
+  *         Larger writes go to the card and update the cached copies.
   * @param  lun : not used
   * @param  *buff: Data to be written
   * @param  sector: Sector address (LBA)
@@ -155,19 +600,42 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 #if _USE_WRITE == 1
 DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
 {
-  DRESULT res = RES_ERROR;
+  DRESULT res;
+#if SD_CACHE_SECTORS > 0
+  int32_t i;
 
-  if(BSP_SD_WriteBlocks((uint32_t*)buff,
-                        (uint64_t)(sector * SD_BLOCK_SIZE),
-                        SD_BLOCK_SIZE, count) == MSD_OK)
+  if(count == 1)
+  {
+    i = SD_CacheFind(sector);
+    if(i < 0)
+    {
+      i = SD_CacheAlloc();
+      if(i < 0)
+      {
+        return RES_ERROR;
+      }
+      SdCache[i].Sector = sector;
+    }
+    memcpy(SdCacheData[i], buff, SD_BLOCK_SIZE);
+    SdCache[i].Dirty = 1;
+    SdCache[i].LastUse = ++SdCacheClock;
+    SdCacheStats.Writes++;
+    return RES_OK;
+  }
+#endif /* SD_CACHE_SECTORS > 0 */
+
+  res = SD_WriteDirect(buff, sector, count);
 
+#if SD_CACHE_SECTORS > 0
+  for(i = 0; (i < SD_CACHE_SECTORS) && (res == RES_OK); i++)
   {
-	/* wait until the Write operation is finished */
-    while(BSP_SD_GetStatus() != MSD_OK)
+    if((SdCache[i].Sector != SD_CACHE_FREE) && (SdCache[i].Sector >= sector) && ((SdCache[i].Sector - sector) < count))
     {
+      memcpy(SdCacheData[i], buff + (SdCache[i].Sector - sector) * SD_BLOCK_SIZE, SD_BLOCK_SIZE);
+      SdCache[i].Dirty = 0;
     }
-    res = RES_OK;
   }
+#endif /* SD_CACHE_SECTORS > 0 */
 
   return res;
 }
@@ -192,7 +660,11 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
   {
   /* Make sure that no pending write process */
   case CTRL_SYNC :
+#if SD_CACHE_SECTORS > 0
+    res = SD_CacheSync();
+#else
     res = RES_OK;
+#endif
     break;
 
   /* Get number of sectors on the disk (DWORD) */
@@ -224,5 +696,15 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
 }
 #endif /* _USE_IOCTL == 1 */
 
+/**
+  * @brief  Gets the sector cache counters
+  * @param  Stats: Counters since the start
+  * @retval None
+  */
+void SD_GetCacheStats(SD_CacheStatsTypeDef *Stats)
+{
+  *Stats = SdCacheStats;
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -27,6 +27,9 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+extern SPI_HandleTypeDef LcdSpiHandle;
+extern SPI_HandleTypeDef SdSpiHandle;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -149,6 +152,37 @@ void EXTI15_10_IRQHandler(void)
   HAL_GPIO_EXTI_IRQHandler(USER_BUTTON_PIN);
 }
 
+/**
+  * @brief  This function handles DMA1 channel 2 interrupt request, the SPI
+  *         reception of the SD data blocks.
+  * @param  None
+  * @retval None
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(SdSpiHandle.hdmarx);
+}
+
+/**
+  * @brief  This function handles DMA1 channel 3 interrupt request, the SPI
+  *         transfers of the bitmaps to the LCD and of the SD data blocks.
+  * @note   The two never run at once: the interrupt goes to the handle whose
+  *         transfer is on the channel.
+  * @param  None
+  * @retval None
+  */
+void DMA1_Channel3_IRQHandler(void)
+{
+  if((SdSpiHandle.hdmatx != NULL) && (HAL_DMA_GetState(SdSpiHandle.hdmatx) == HAL_DMA_STATE_BUSY))
+  {
+    HAL_DMA_IRQHandler(SdSpiHandle.hdmatx);
+  }
+  else
+  {
+    HAL_DMA_IRQHandler(LcdSpiHandle.hdmatx);
+  }
+}
+
 /**
   * @brief  This function handles PPP interrupt request.
   * @param  None
@@ -40,6 +40,8 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void SDIO_IRQHandler(void);
+void DMA2_Channel4_IRQHandler(void);
 #ifdef __cplusplus
 }
 #endif
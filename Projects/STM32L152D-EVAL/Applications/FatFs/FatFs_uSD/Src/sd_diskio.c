@@ -2,7 +2,7 @@
   ******************************************************************************
   * @file    FatFs/FatFs_uSD/Src/sd_diskio.c
   * @author  MCD Application Team
-  * @brief   SD Disk I/O driver
+  * @brief   SD Disk I/O driver, with DMA transfers and a sector cache
   ******************************************************************************
   * @attention
   *
@@ -20,9 +20,17 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ff_gen_drv.h"
 #include "sd_diskio.h"
-
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
+/* Cached sector */
+typedef struct
+{
+  DWORD    Sector;      /* SD_CACHE_FREE if the entry holds no sector */
+  uint32_t LastUse;     /* SdCacheClock at the last access, for the LRU */
+  uint32_t Dirty;       /* Written by FatFs, not yet on the card */
+} SD_CacheEntryTypeDef;
+
 /* Private define ------------------------------------------------------------*/
 /* use the default SD timout as defined in the platform BSP driver*/
 #if defined(SDMMC_DATATIMEOUT)
@@ -43,12 +51,48 @@
 
 /* #define DISABLE_SD_INIT */
 
+/*
+ * Number of sectors kept in RAM. FatFs accesses FAT and directory sectors one
+ * at a time through its window while file data of more than one sector is
+ * transferred directly: single sector requests go through the cache, the
+ * others go straight to the card. Define it to 0 to disable the cache.
+ * Utilities/HostTest/sd_test.c runs the cache on a fake card.
+ */
+#if !defined(SD_CACHE_SECTORS)
+#define SD_CACHE_SECTORS 8
+#endif
+
+#define SD_CACHE_FREE 0xFFFFFFFFU
+
 /* Private variables ---------------------------------------------------------*/
 /* Disk status */
 static volatile DSTATUS Stat = STA_NOINIT;
 
+/* DMA transfer status, set by the BSP callbacks */
+static volatile uint32_t ReadStatus = 0;
+static volatile uint32_t WriteStatus = 0;
+
+/* Word aligned sector for the DMA transfers of unaligned FatFs buffers */
+static uint32_t SdScratch[SD_DEFAULT_BLOCK_SIZE / 4];
+
+#if SD_CACHE_SECTORS > 0
+static SD_CacheEntryTypeDef SdCache[SD_CACHE_SECTORS];
+static uint32_t SdCacheData[SD_CACHE_SECTORS][SD_DEFAULT_BLOCK_SIZE / 4];
+static uint32_t SdCacheClock = 0;
+#endif
+static SD_CacheStatsTypeDef SdCacheStats;
+
 /* Private function prototypes -----------------------------------------------*/
 static DSTATUS SD_CheckStatus(BYTE lun);
+static DRESULT SD_WaitTransfer(volatile uint32_t *Status);
+static DRESULT SD_ReadDirect(BYTE *buff, DWORD sector, UINT count);
+static DRESULT SD_WriteDirect(const BYTE *buff, DWORD sector, UINT count);
+#if SD_CACHE_SECTORS > 0
+static int32_t SD_CacheFind(DWORD sector);
+static int32_t SD_CacheAlloc(void);
+static DRESULT SD_CacheSync(void);
+static void SD_CacheInvalidate(void);
+#endif
 DSTATUS SD_initialize (BYTE);
 DSTATUS SD_status (BYTE);
 DRESULT SD_read (BYTE, BYTE*, DWORD, UINT);
@@ -86,6 +130,216 @@ static DSTATUS SD_CheckStatus(BYTE lun)
   return Stat;
 }
 
+/**
+  * @brief  Waits for the end of a DMA transfer and for the card to be ready
+  * @param  Status: ReadStatus or WriteStatus
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_WaitTransfer(volatile uint32_t *Status)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(*Status == 0)
+  {
+    if((HAL_GetTick() - tickstart) >= SD_TIMEOUT)
+    {
+      return RES_ERROR;
+    }
+  }
+
+  while(BSP_SD_GetCardState() != MSD_OK)
+  {
+    if((HAL_GetTick() - tickstart) >= SD_TIMEOUT)
+    {
+      return RES_ERROR;
+    }
+  }
+
+  return RES_OK;
+}
+
+/**
+  * @brief  Reads sectors from the card through the DMA
+  * @note   The SDIO DMA moves words: a buffer which is not word aligned is
+  *         read one sector at a time through SdScratch.
+  * @param  *buff: Data buffer to store read data
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to read
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_ReadDirect(BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+
+  if(((uint32_t)buff & 3U) == 0U)
+  {
+    ReadStatus = 0;
+    if(BSP_SD_ReadBlocks_DMA((uint32_t*)buff, (uint32_t)sector, count) != MSD_OK)
+    {
+      return RES_ERROR;
+    }
+    return SD_WaitTransfer(&ReadStatus);
+  }
+
+  for(; (count > 0) && (res == RES_OK); count--, sector++, buff += SD_DEFAULT_BLOCK_SIZE)
+  {
+    ReadStatus = 0;
+    if(BSP_SD_ReadBlocks_DMA(SdScratch, (uint32_t)sector, 1) != MSD_OK)
+    {
+      return RES_ERROR;
+    }
+    res = SD_WaitTransfer(&ReadStatus);
+    memcpy(buff, SdScratch, SD_DEFAULT_BLOCK_SIZE);
+  }
+
+  return res;
+}
+
+/**
+  * @brief  Writes sectors to the card through the DMA
+  * @param  *buff: Data to be written
+  * @param  sector: Sector address (LBA)
+  * @param  count: Number of sectors to write
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_WriteDirect(const BYTE *buff, DWORD sector, UINT count)
+{
+  DRESULT res = RES_OK;
+
+  if(((uint32_t)buff & 3U) == 0U)
+  {
+    WriteStatus = 0;
+    if(BSP_SD_WriteBlocks_DMA((uint32_t*)buff, (uint32_t)sector, count) != MSD_OK)
+    {
+      return RES_ERROR;
+    }
+    return SD_WaitTransfer(&WriteStatus);
+  }
+
+  for(; (count > 0) && (res == RES_OK); count--, sector++, buff += SD_DEFAULT_BLOCK_SIZE)
+  {
+    memcpy(SdScratch, buff, SD_DEFAULT_BLOCK_SIZE);
+    WriteStatus = 0;
+    if(BSP_SD_WriteBlocks_DMA(SdScratch, (uint32_t)sector, 1) != MSD_OK)
+    {
+      return RES_ERROR;
+    }
+    res = SD_WaitTransfer(&WriteStatus);
+  }
+
+  return res;
+}
+
+#if SD_CACHE_SECTORS > 0
+/**
+  * @brief  Looks for a sector in the cache
+  * @param  sector: Sector address (LBA)
+  * @retval Entry index, -1 if the sector is not cached
+  */
+static int32_t SD_CacheFind(DWORD sector)
+{
+  int32_t i;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    if(SdCache[i].Sector == sector)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+  * @brief  Gets a cache entry for a new sector: a free one, else the least
+  *         recently used one, written back first if it is dirty
+  * @param  None
+  * @retval Entry index, -1 if the write back failed
+  */
+static int32_t SD_CacheAlloc(void)
+{
+  int32_t i, lru = 0;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    if(SdCache[i].Sector == SD_CACHE_FREE)
+    {
+      return i;
+    }
+    /* Ages rather than use times, so that the clock may wrap around */
+    if((SdCacheClock - SdCache[i].LastUse) > (SdCacheClock - SdCache[lru].LastUse))
+    {
+      lru = i;
+    }
+  }
+
+  if(SdCache[lru].Dirty != 0)
+  {
+    if(SD_WriteDirect((BYTE*)SdCacheData[lru], SdCache[lru].Sector, 1) != RES_OK)
+    {
+      return -1;
+    }
+    SdCache[lru].Dirty = 0;
+    SdCacheStats.WriteBacks++;
+  }
+  SdCache[lru].Sector = SD_CACHE_FREE;
+
+  return lru;
+}
+
+/**
+  * @brief  Writes all the dirty sectors back to the card
+  * @note   Sectors are written in ascending order, the sequence the card
+  *         handles best.
+  * @param  None
+  * @retval DRESULT: Operation result
+  */
+static DRESULT SD_CacheSync(void)
+{
+  int32_t i, next;
+
+  do
+  {
+    next = -1;
+    for(i = 0; i < SD_CACHE_SECTORS; i++)
+    {
+      if((SdCache[i].Dirty != 0) && ((next < 0) || (SdCache[i].Sector < SdCache[next].Sector)))
+      {
+        next = i;
+      }
+    }
+
+    if(next >= 0)
+    {
+      if(SD_WriteDirect((BYTE*)SdCacheData[next], SdCache[next].Sector, 1) != RES_OK)
+      {
+        return RES_ERROR;
+      }
+      SdCache[next].Dirty = 0;
+      SdCacheStats.WriteBacks++;
+    }
+  } while(next >= 0);
+
+  return RES_OK;
+}
+
+/**
+  * @brief  Drops all the cached sectors, the card may have been changed
+  * @param  None
+  * @retval None
+  */
+static void SD_CacheInvalidate(void)
+{
+  int32_t i;
+
+  for(i = 0; i < SD_CACHE_SECTORS; i++)
+  {
+    SdCache[i].Sector = SD_CACHE_FREE;
+    SdCache[i].Dirty = 0;
+  }
+}
+#endif /* SD_CACHE_SECTORS > 0 */
+
 /**
   * @brief  Initializes a Drive
   * @param  lun : not used
@@ -94,6 +348,9 @@ static DSTATUS SD_CheckStatus(BYTE lun)
 DSTATUS SD_initialize(BYTE lun)
 {
   Stat = STA_NOINIT;
+#if SD_CACHE_SECTORS > 0
+  SD_CacheInvalidate();
+#endif
 #if !defined(DISABLE_SD_INIT)
 
   if(BSP_SD_Init() == MSD_OK)
@@ -119,6 +376,8 @@ DSTATUS SD_status(BYTE lun)
 
 /**
   * @brief  Reads Sector(s)
+  * @note   A single sector is read through the cache. Larger reads go to the
+  *         card, then get the sectors of the range still dirty in the cache.
   * @param  lun : not used
   * @param  *buff: Data buffer to store read data
   * @param  sector: Sector address (LBA)
@@ -127,24 +386,54 @@ DSTATUS SD_status(BYTE lun)
   */
 DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 {
-  DRESULT res = RES_ERROR;
+  DRESULT res;
+#if SD_CACHE_SECTORS > 0
+  int32_t i;
 
-  if(BSP_SD_ReadBlocks((uint32_t*)buff,
-                       (uint32_t) (sector),
-                       count, SD_TIMEOUT) == MSD_OK)
+  if(count == 1)
   {
-    /* wait until the read operation is finished */
-    while(BSP_SD_GetCardState()!= MSD_OK)
+    i = SD_CacheFind(sector);
+    if(i >= 0)
     {
+      SdCacheStats.Hits++;
+    }
+    else
+    {
+      SdCacheStats.Misses++;
+      i = SD_CacheAlloc();
+      if((i < 0) || (SD_ReadDirect((BYTE*)SdCacheData[i], sector, 1) != RES_OK))
+      {
+        return RES_ERROR;
+      }
+      SdCache[i].Sector = sector;
+    }
+    SdCache[i].LastUse = ++SdCacheClock;
+    memcpy(buff, SdCacheData[i], SD_DEFAULT_BLOCK_SIZE);
+    return RES_OK;
+  }
+#endif /* SD_CACHE_SECTORS > 0 */
+
+  res = SD_ReadDirect(buff, sector, count);
+
+#if SD_CACHE_SECTORS > 0
+  for(i = 0; (i < SD_CACHE_SECTORS) && (res == RES_OK); i++)
+  {
+    if((SdCache[i].Dirty != 0) && (SdCache[i].Sector >= sector) && ((SdCache[i].Sector - sector) < count))
+    {
+      memcpy(buff + (SdCache[i].Sector - sector) * SD_DEFAULT_BLOCK_SIZE, SdCacheData[i], SD_DEFAULT_BLOCK_SIZE);
     }
-    res = RES_OK;
   }
+#endif /* SD_CACHE_SECTORS > 0 */
 
   return res;
 }
 
 /**
   * @brief  Writes Sector(s)
+  * @note   A single sector is only written to the cache, to the card when
+  *         it is evicted or on CTRL_SYNC: the FAT and directory sectors
+  *         updated again and again while a file grows reach the card once.
+  *         Larger writes go to the card and update the cached copies.
   * @param  lun : not used
   * @param  *buff: Data to be written
   * @param  sector: Sector address (LBA)
@@ -154,18 +443,42 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 #if _USE_WRITE == 1
 DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
 {
-  DRESULT res = RES_ERROR;
+  DRESULT res;
+#if SD_CACHE_SECTORS > 0
+  int32_t i;
 
-  if(BSP_SD_WriteBlocks((uint32_t*)buff,
-                        (uint32_t)(sector),
-                        count, SD_TIMEOUT) == MSD_OK)
+  if(count == 1)
   {
-    /* wait until the Write operation is finished */
-    while(BSP_SD_GetCardState() != MSD_OK)
+    i = SD_CacheFind(sector);
+    if(i < 0)
     {
+      i = SD_CacheAlloc();
+      if(i < 0)
+      {
+        return RES_ERROR;
+      }
+      SdCache[i].Sector = sector;
     }
-    res = RES_OK;
+    memcpy(SdCacheData[i], buff, SD_DEFAULT_BLOCK_SIZE);
+    SdCache[i].Dirty = 1;
+    SdCache[i].LastUse = ++SdCacheClock;
+    SdCacheStats.Writes++;
+    return RES_OK;
   }
+#endif /* SD_CACHE_SECTORS > 0 */
+
+  res = SD_WriteDirect(buff, sector, count);
+
+#if SD_CACHE_SECTORS > 0
+  for(i = 0; (i < SD_CACHE_SECTORS) && (res == RES_OK); i++)
+  {
+    if((SdCache[i].Sector != SD_CACHE_FREE) && (SdCache[i].Sector >= sector) && ((SdCache[i].Sector - sector) < count))
+    {
+      memcpy(SdCacheData[i], buff + (SdCache[i].Sector - sector) * SD_DEFAULT_BLOCK_SIZE, SD_DEFAULT_BLOCK_SIZE);
+      SdCache[i].Dirty = 0;
+    }
+  }
+#endif /* SD_CACHE_SECTORS > 0 */
 
   return res;
 }
@@ -190,7 +503,11 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
   {
   /* Make sure that no pending write process */
   case CTRL_SYNC :
+#if SD_CACHE_SECTORS > 0
+    res = SD_CacheSync();
+#else
     res = RES_OK;
+#endif
     break;
 
   /* Get number of sectors on the disk (DWORD) */
@@ -222,5 +539,35 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
 }
 #endif /* _USE_IOCTL == 1 */
 
+/**
+  * @brief  Gets the sector cache counters
+  * @param  Stats: Counters since the start
+  * @retval None
+  */
+void SD_GetCacheStats(SD_CacheStatsTypeDef *Stats)
+{
+  *Stats = SdCacheStats;
+}
+
+/**
+  * @brief  Tx Transfer completed callback
+  * @param  None
+  * @retval None
+  */
+void BSP_SD_WriteCpltCallback(void)
+{
+  WriteStatus = 1;
+}
+
+/**
+  * @brief  Rx Transfer completed callback
+  * @param  None
+  * @retval None
+  */
+void BSP_SD_ReadCpltCallback(void)
+{
+  ReadStatus = 1;
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
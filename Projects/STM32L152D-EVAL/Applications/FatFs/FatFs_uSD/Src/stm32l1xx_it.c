@@ -25,6 +25,8 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+extern SD_HandleTypeDef uSdHandle;
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -137,6 +139,34 @@ void SysTick_Handler(void)
 /*  file (startup_stm32l1xx.s).                                               */
 /******************************************************************************/
 
+/**
+  * @brief  This function handles SDIO interrupt request.
+  * @param  None
+  * @retval None
+  */
+void SDIO_IRQHandler(void)
+{
+  BSP_SD_IRQHandler();
+}
+
+/**
+  * @brief  This function handles DMA2 channel 4 interrupt request, shared
+  *         by the SDIO reads and writes.
+  * @param  None
+  * @retval None
+  */
+void DMA2_Channel4_IRQHandler(void)
+{
+  if((uSdHandle.Context & (SD_CONTEXT_READ_SINGLE_BLOCK | SD_CONTEXT_READ_MULTIPLE_BLOCK)) != 0U)
+  {
+    BSP_SD_DMA_Rx_IRQHandler();
+  }
+  else
+  {
+    BSP_SD_DMA_Tx_IRQHandler();
+  }
+}
+
 /**
   * @brief  This function handles PPP interrupt request.
   * @param  None
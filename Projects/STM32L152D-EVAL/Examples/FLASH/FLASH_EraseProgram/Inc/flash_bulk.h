@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_EraseProgram/Inc/flash_bulk.h
+  * @author  MCD Application Team
+  * @brief   Header for flash_bulk.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FLASH_BULK_H
+#define __FLASH_BULK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Work done by FLASHBULK_Write() since FLASHBULK_Init()
+  */
+typedef struct
+{
+  uint32_t Pages;          /*!< Pages written: erased, then two half pages */
+  uint32_t Skipped;        /*!< Pages that already held the data           */
+  uint32_t Merged;         /*!< Pages partly written, read back first      */
+} FLASHBULK_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define FLASHBULK_HALF_PAGE_SIZE  (FLASH_PAGE_SIZE / 2U)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              FLASHBULK_Init(void);
+HAL_StatusTypeDef FLASHBULK_Write(uint32_t Address, const uint8_t *Data, uint32_t Size);
+void              FLASHBULK_GetStats(FLASHBULK_StatsTypeDef *Stats);
+
+#endif /* __FLASH_BULK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
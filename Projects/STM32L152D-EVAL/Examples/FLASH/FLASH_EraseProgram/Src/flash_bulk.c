@@ -0,0 +1,184 @@
+/**
+  ******************************************************************************
+  * @file    FLASH/FLASH_EraseProgram/Src/flash_bulk.c
+  * @author  MCD Application Team
+  * @brief   Bulk writes to the program memory, by half pages from RAM.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    (#) Call FLASHBULK_Init() once, then unlock the program memory with
+        HAL_FLASH_Unlock() before FLASHBULK_Write(), as for
+        HAL_FLASH_Program().
+    (#) FLASHBULK_Write() copies a buffer of any size, from any address, to
+        any address of the program memory, as memcpy() would: the bytes of
+        the pages around it are kept.
+    (#) The buffer is split on page boundaries. Each page is built in RAM:
+        the buffer bytes alone for a whole page, merged with the page read
+        back from flash for the head and the tail of an unaligned buffer.
+        A page that already holds these bytes is left alone, the others are
+        erased and written by HAL_FLASHEx_HalfPageProgram(), 32 words per
+        operation from RAM instead of one word for HAL_FLASH_Program().
+    (#) Each page written is checked by comparing the CRC unit result of
+        the flash page with the one of the RAM page.
+
+    [..]
+    (@) During a half page write no code can be fetched from flash:
+        HAL_FLASHEx_HalfPageProgram() runs from RAM with the interrupts
+        masked, for about one flash programming time.
+    (@) The source buffer may be in flash: it is copied to the RAM page
+        before anything is erased.
+    (@) Utilities/HostTest/flash_bulk_test.c runs FLASHBULK_Write() on a
+        simulated program memory.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "flash_bulk.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define FLASHBULK_PAGE_WORDS      (FLASH_PAGE_SIZE / 4U)
+
+/* Private macro -------------------------------------------------------------*/
+#define FLASHBULK_PAGE_OF(address)  ((address) & ~(FLASH_PAGE_SIZE - 1U))
+
+/* Private variables ---------------------------------------------------------*/
+static CRC_HandleTypeDef BulkCrcHandle;
+
+/* Page being written, word aligned for the half page writes */
+static uint32_t BulkPage[FLASHBULK_PAGE_WORDS];
+
+static FLASHBULK_StatsTypeDef BulkStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef FLASHBULK_WritePage(uint32_t Page);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Write the RAM page to flash, unless it is already there.
+  * @param  Page: Page address
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FLASHBULK_WritePage(uint32_t Page)
+{
+  FLASH_EraseInitTypeDef erase;
+  uint32_t error, half;
+
+  if (memcmp(BulkPage, (const void *)Page, FLASH_PAGE_SIZE) == 0)
+  {
+    BulkStats.Skipped++;
+    return HAL_OK;
+  }
+
+  erase.TypeErase   = FLASH_TYPEERASE_PAGES;
+  erase.PageAddress = Page;
+  erase.NbPages     = 1U;
+  if (HAL_FLASHEx_Erase(&erase, &error) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  for (half = 0U; half < FLASH_PAGE_SIZE; half += FLASHBULK_HALF_PAGE_SIZE)
+  {
+    if (HAL_FLASHEx_HalfPageProgram(Page + half, &BulkPage[half / 4U]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (HAL_CRC_Calculate(&BulkCrcHandle, (uint32_t *)Page, FLASHBULK_PAGE_WORDS) !=
+      HAL_CRC_Calculate(&BulkCrcHandle, BulkPage, FLASHBULK_PAGE_WORDS))
+  {
+    return HAL_ERROR;
+  }
+
+  BulkStats.Pages++;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize the CRC unit used to check the pages written.
+  * @param  None
+  * @retval None
+  */
+void FLASHBULK_Init(void)
+{
+  __HAL_RCC_CRC_CLK_ENABLE();
+  BulkCrcHandle.Instance = CRC;
+  HAL_CRC_Init(&BulkCrcHandle);
+
+  memset(&BulkStats, 0, sizeof(BulkStats));
+}
+
+/**
+  * @brief  Copy a buffer to the program memory.
+  * @note   The program memory must be unlocked.
+  * @param  Address: Destination, any alignment
+  * @param  Data: Source, any alignment, in RAM or flash
+  * @param  Size: Number of bytes
+  * @retval HAL status, HAL_ERROR if a page could not be written or checked
+  */
+HAL_StatusTypeDef FLASHBULK_Write(uint32_t Address, const uint8_t *Data, uint32_t Size)
+{
+  uint32_t page, offset, count;
+
+  while (Size != 0U)
+  {
+    page   = FLASHBULK_PAGE_OF(Address);
+    offset = Address - page;
+    count  = FLASH_PAGE_SIZE - offset;
+    if (count > Size)
+    {
+      count = Size;
+    }
+
+    /* Head or tail of the buffer: the rest of the page is kept */
+    if (count != FLASH_PAGE_SIZE)
+    {
+      memcpy(BulkPage, (const void *)page, FLASH_PAGE_SIZE);
+      BulkStats.Merged++;
+    }
+    memcpy((uint8_t *)BulkPage + offset, Data, count);
+
+    if (FLASHBULK_WritePage(page) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    Address += count;
+    Data    += count;
+    Size    -= count;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Pages written, skipped and merged since FLASHBULK_Init().
+  * @param  Stats: Copy of the counters
+  * @retval None
+  */
+void FLASHBULK_GetStats(FLASHBULK_StatsTypeDef *Stats)
+{
+  *Stats = BulkStats;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -20,6 +20,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "flash_bulk.h"
 
 /** @addtogroup STM32L1xx_HAL_Examples
   * @{
@@ -35,6 +36,11 @@
 #define FLASH_USER_END_ADDR     ADDR_FLASH_PAGE_127 + FLASH_PAGE_SIZE   /* End @ of user Flash area */
 
 #define DATA_32                 ((uint32_t)0x12345678)
+#define DATA_32_BULK            ((uint32_t)0x9ABCDEF0)
+
+/* Bytes per FLASHBULK_Write() call: not a multiple of the page size, each
+   call ends in the middle of a page */
+#define BULK_CHUNK_SIZE         1000U
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -44,6 +50,14 @@ __IO uint32_t data32 = 0 , MemoryProgramStatus = 0;
 /*Variable used for Erase procedure*/
 static FLASH_EraseInitTypeDef EraseInitStruct;
 
+/* Buffer written by half pages */
+static uint32_t BulkBuffer[BULK_CHUNK_SIZE / 4U];
+
+/* Benchmark, in ms: erase and word programming of the user Flash area, then
+   the same area rewritten by FLASHBULK_Write() */
+__IO uint32_t WordProgramTime = 0, BulkProgramTime = 0;
+FLASHBULK_StatsTypeDef BulkStats;
+
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void Error_Handler(void);
@@ -77,9 +91,14 @@ int main(void)
   /* Configure the system clock to 32 MHz */
   SystemClock_Config();
 
+  /* CRC unit checking the half page writes */
+  FLASHBULK_Init();
+
   /* Unlock the Flash to enable the flash control register access *************/
   HAL_FLASH_Unlock();
 
+  WordProgramTime = HAL_GetTick();
+
   /* Erase the user Flash area
     (area defined by FLASH_USER_START_ADDR and FLASH_USER_END_ADDR) ***********/
 
@@ -125,6 +144,8 @@ int main(void)
     }
   }
 
+  WordProgramTime = HAL_GetTick() - WordProgramTime;
+
   /* Lock the Flash to disable the flash control register access (recommended
      to protect the FLASH memory against possible unwanted operation) *********/
   HAL_FLASH_Lock();
@@ -146,6 +167,54 @@ int main(void)
     Address = Address + 4;
   }
 
+  /* Rewrite the user Flash area by half pages, in chunks ending anywhere in
+     a page, and time it (the pages are erased by FLASHBULK_Write) *********/
+  for (Address = 0; Address < (BULK_CHUNK_SIZE / 4U); Address++)
+  {
+    BulkBuffer[Address] = DATA_32_BULK;
+  }
+
+  HAL_FLASH_Unlock();
+  BulkProgramTime = HAL_GetTick();
+
+  Address = FLASH_USER_START_ADDR;
+  while (Address < FLASH_USER_END_ADDR)
+  {
+    data32 = FLASH_USER_END_ADDR - Address;
+    if (data32 > BULK_CHUNK_SIZE)
+    {
+      data32 = BULK_CHUNK_SIZE;
+    }
+    if (FLASHBULK_Write(Address, (uint8_t *)BulkBuffer, data32) != HAL_OK)
+    {
+      /* Error occurred while writing data in Flash memory.
+         User can add here some code to deal with this error */
+      while (1)
+      {
+        BSP_LED_On(LED3);
+      }
+    }
+    Address = Address + data32;
+  }
+
+  BulkProgramTime = HAL_GetTick() - BulkProgramTime;
+  HAL_FLASH_Lock();
+  FLASHBULK_GetStats(&BulkStats);
+
+  /* Check the data written by half pages */
+  Address = FLASH_USER_START_ADDR;
+
+  while (Address < FLASH_USER_END_ADDR)
+  {
+    data32 = *(__IO uint32_t *)Address;
+
+    if (data32 != DATA_32_BULK)
+    {
+      MemoryProgramStatus++;
+    }
+    Address = Address + 4;
+  }
+
   /*Check if there is an issue to program data*/
   if (MemoryProgramStatus == 0)
   {
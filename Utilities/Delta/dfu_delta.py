@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""Delta images for the DFU_Standalone bootloader of the NUCLEO-L152RE.
+
+Usage:
+  dfu_delta.py make  BASE TARGET -o DELTA [--address ADDRESS]
+  dfu_delta.py apply BASE DELTA -o TARGET
+
+make   writes the delta that turns the application BASE, as it is in flash,
+       into TARGET. Both are raw binaries linked at ADDRESS.
+apply  rebuilds TARGET from BASE and DELTA, as the bootloader does.
+
+The delta is downloaded as a plain binary at USBD_DFU_APP_DEFAULT_ADD: its
+first word tells the bootloader to decode it instead of writing it. Format,
+little endian:
+
+  header   magic "DLT1", address, base size, base CRC, target size,
+           target CRC, six 32-bit words
+  ops      one byte: bit 7 set for DATA, clear for COPY, bits 6-0 the
+           length, or 0 for a 16-bit length in the next two bytes.
+           COPY keeps the next bytes of the flash, DATA replaces them with
+           the bytes following the operation.
+
+The CRCs are those of the STM32 CRC unit (CRC-32/MPEG-2) over 32-bit words.
+Only the whole words of BASE are trusted to be in flash; the bytes after
+them are always sent.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x31544C44
+HEADER = struct.Struct('<6I')
+DEFAULT_ADDRESS = 0x08007000   # USBD_DFU_APP_DEFAULT_ADD
+PAGE_SIZE = 256
+
+OP_DATA = 0x80
+OP_SHORT = 0x7F
+OP_LONG = 0xFFFF
+
+# A COPY shorter than this costs more than sending the bytes
+MIN_COPY = 3
+
+
+def crc32_mpeg2(data):
+    """CRC unit of the STM32L1: words read little endian, fed MSB first."""
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack('<I', data):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else crc << 1
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def pad(data):
+    """Fill with the erased flash value up to a whole word."""
+    return data + bytes(-len(data) % 4)
+
+
+def op(code, length):
+    if length <= OP_SHORT:
+        return bytes([code | length])
+    return bytes([code]) + struct.pack('<H', length)
+
+
+def ops(kind, length, data=b''):
+    out = bytearray()
+    pos = 0
+    while pos < length:
+        count = min(length - pos, OP_LONG)
+        out += op(kind, count)
+        if kind == OP_DATA:
+            out += data[pos:pos + count]
+        pos += count
+    return out
+
+
+def make(base, target, address):
+    if address % PAGE_SIZE:
+        raise ValueError('address 0x%08X is not page aligned' % address)
+    base = base[:len(base) & ~3]
+    target = pad(target)
+    target_crc = crc32_mpeg2(target)
+    if target_crc == 0:
+        raise ValueError('target CRC is 0, reserved: change the image')
+
+    # Runs of bytes equal in flash and in the target
+    same = [i < len(base) and base[i] == target[i] for i in range(len(target))]
+    out = bytearray(HEADER.pack(MAGIC, address, len(base), crc32_mpeg2(base),
+                                len(target), target_crc))
+    pos = 0
+    while pos < len(target):
+        end = pos
+        while end < len(target) and same[end]:
+            end += 1
+        if end > pos and (end - pos >= MIN_COPY or end == len(target)):
+            out += ops(0, end - pos)
+            pos = end
+            continue
+        # DATA up to the next COPY worth its operation byte
+        while end < len(target):
+            if same[end]:
+                run = end
+                while run < len(target) and same[run]:
+                    run += 1
+                if run - end >= MIN_COPY or run == len(target):
+                    break
+                end = run
+            else:
+                end += 1
+        out += ops(OP_DATA, end - pos, target[pos:end])
+        pos = end
+    return bytes(out)
+
+
+def apply(base, delta):
+    magic, address, base_size, base_crc, size, target_crc = HEADER.unpack_from(delta)
+    if magic != MAGIC:
+        raise ValueError('not a delta image')
+    flash = bytearray(base[:base_size])
+    if len(flash) != base_size or crc32_mpeg2(bytes(flash)) != base_crc:
+        raise ValueError('delta made for another image')
+    flash += bytes(max(size - base_size, 0))
+    pos, out = HEADER.size, 0
+    while pos < len(delta):
+        code = delta[pos]
+        length = code & OP_SHORT
+        pos += 1
+        if length == 0:
+            length, = struct.unpack_from('<H', delta, pos)
+            pos += 2
+        if code & OP_DATA:
+            flash[out:out + length] = delta[pos:pos + length]
+            pos += length
+        out += length
+    target = bytes(flash[:size])
+    if out != size or crc32_mpeg2(target) != target_crc:
+        raise ValueError('patched image does not match the target CRC')
+    return target
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('make', help='delta from BASE to TARGET')
+    p.add_argument('base')
+    p.add_argument('target')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('--address', type=lambda s: int(s, 0), default=DEFAULT_ADDRESS)
+
+    p = sub.add_parser('apply', help='TARGET from BASE and DELTA')
+    p.add_argument('base')
+    p.add_argument('delta')
+    p.add_argument('-o', '--output', required=True)
+
+    args = parser.parse_args()
+    with open(args.base, 'rb') as f:
+        base = f.read()
+
+    try:
+        if args.command == 'make':
+            with open(args.target, 'rb') as f:
+                target = f.read()
+            delta = make(base, target, args.address)
+            if apply(base, delta) != pad(target):
+                raise ValueError('internal error: delta does not rebuild the target')
+            with open(args.output, 'wb') as f:
+                f.write(delta)
+            pages = sum(1 for p in range(0, len(pad(target)), PAGE_SIZE)
+                        if pad(target)[p:p + PAGE_SIZE] != base[p:p + PAGE_SIZE])
+            print('%d bytes, %.1f%% of the target, %d of %d pages to write'
+                  % (len(delta), 100.0 * len(delta) / max(len(target), 1), pages,
+                     (len(pad(target)) + PAGE_SIZE - 1) // PAGE_SIZE))
+        else:
+            with open(args.delta, 'rb') as f:
+                delta = f.read()
+            with open(args.output, 'wb') as f:
+                f.write(apply(base, delta))
+    except ValueError as e:
+        print('error: %s' % e, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Decoder of the fault records saved by Application/Src/fault.c.
+
+Usage:
+  fault_decode.py DUMP [--base ADDRESS] [--map MAP]
+
+DUMP is a read of the data EEPROM holding the ring, FAULT_RECORDS records of
+8 words from FAULT_RING_ADDRESS (0x08080100, 256 bytes): either a raw binary
+file or the hexadecimal words of a memory window, one or more per line. An
+address ending with ':' at the start of a line is skipped.
+
+--base  address of the first byte of DUMP, FAULT_RING_ADDRESS by default.
+        A dump of the whole data EEPROM is read with --base 0x08080000.
+--map   IAR linker map of the image that faulted: the PC and LR are given
+        with the function they fall in.
+
+Record, little endian words:
+  header   0xFA in the upper byte, exception number in bits 16-23,
+           sequence number below. Records are listed oldest first.
+  pc, lr, xpsr  stacked by the exception, 0xFFFFFFFF if the stack pointer
+           was out of the RAM
+  cfsr, hfsr, fault address (MMFAR or BFAR when valid, or 0)
+  info     RCC_CSR reset flags in the upper byte, low byte of EXC_RETURN in
+           bits 16-23, RTC_BKP_WDG_STAGE below
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, '..', 'Footprint'))
+import footprint  # noqa: E402
+
+FAULT_RING_ADDRESS = 0x08080100
+FAULT_RECORDS = 8
+RECORD = struct.Struct('<8I')
+FAULT_MAGIC = 0xFA
+NO_FRAME = 0xFFFFFFFF
+
+EXCEPTIONS = {3: 'HardFault', 4: 'MemManage', 5: 'BusFault', 6: 'UsageFault'}
+
+CFSR_BITS = (
+    (0, 'IACCVIOL', 'MemManage: instruction access violation'),
+    (1, 'DACCVIOL', 'MemManage: data access violation'),
+    (3, 'MUNSTKERR', 'MemManage: on exception return unstacking'),
+    (4, 'MSTKERR', 'MemManage: on exception entry stacking'),
+    (7, 'MMARVALID', 'MMFAR holds the faulting address'),
+    (8, 'IBUSERR', 'BusFault: instruction prefetch'),
+    (9, 'PRECISERR', 'BusFault: precise data access'),
+    (10, 'IMPRECISERR', 'BusFault: imprecise data access, PC is after it'),
+    (11, 'UNSTKERR', 'BusFault: on exception return unstacking'),
+    (12, 'STKERR', 'BusFault: on exception entry stacking'),
+    (15, 'BFARVALID', 'BFAR holds the faulting address'),
+    (16, 'UNDEFINSTR', 'UsageFault: undefined instruction'),
+    (17, 'INVSTATE', 'UsageFault: invalid state, Thumb bit clear'),
+    (18, 'INVPC', 'UsageFault: invalid EXC_RETURN'),
+    (19, 'NOCP', 'UsageFault: no coprocessor'),
+    (24, 'UNALIGNED', 'UsageFault: unaligned access'),
+    (25, 'DIVBYZERO', 'UsageFault: divide by zero'),
+)
+
+HFSR_BITS = (
+    (1, 'VECTTBL', 'vector table read'),
+    (30, 'FORCED', 'escalated from a configurable fault'),
+    (31, 'DEBUGEVT', 'debug event'),
+)
+
+RESET_FLAGS = (
+    (25, 'OBL'), (26, 'PIN'), (27, 'POR'), (28, 'SFT'),
+    (29, 'IWDG'), (30, 'WWDG'), (31, 'LPWR'),
+)
+
+# WDG_StageTypeDef of Application/Inc/watchdog.h
+STAGES = {1: 'BOOT', 2: 'IDLE', 3: 'EVENT', 4: 'WAKEUP', 5: 'SENSE',
+          6: 'DISPLAY', 7: 'LOG'}
+
+EXC_RETURN = {0xF1: 'handler, MSP', 0xF9: 'thread, MSP', 0xFD: 'thread, PSP'}
+
+HEX_WORD = re.compile(r'^(0x)?[0-9a-fA-F]{8}$')
+
+
+def read_dump(path):
+    """Bytes of DUMP, binary or hexadecimal words."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    try:
+        text = data.decode('ascii')
+    except UnicodeDecodeError:
+        return data
+    words = []
+    for line in text.splitlines():
+        tokens = line.replace(',', ' ').split()
+        if tokens and tokens[0].endswith(':'):
+            tokens = tokens[1:]
+        for token in tokens:
+            if not HEX_WORD.match(token):
+                break
+            words.append(int(token, 16))
+    if not words:
+        return data
+    return struct.pack('<%dI' % len(words), *words)
+
+
+def bits(value, table):
+    return [name for bit, name, _ in table if value & (1 << bit)]
+
+
+def load_symbols(path):
+    with open(path, 'r', encoding='latin-1') as f:
+        lines = [l.rstrip('\r\n') for l in f]
+    return sorted((address & ~1, size, name)
+                  for name, size, kind, _, address in footprint.parse_entries(lines)
+                  if kind == 'Code')
+
+
+def symbol(symbols, address):
+    """function+offset of a code address, or '' if not in the map."""
+    if not symbols or address == NO_FRAME:
+        return ''
+    address &= ~1
+    best = None
+    for start, size, name in symbols:
+        if start > address:
+            break
+        if size == 0 or address < start + size:
+            best = (start, name)
+    if best is None:
+        return ''
+    return '  %s+0x%x' % (best[1], address - best[0])
+
+
+def decode(data, base, symbols):
+    offset = FAULT_RING_ADDRESS - base
+    if offset < 0 or offset + FAULT_RECORDS * RECORD.size > len(data):
+        raise ValueError('the dump does not cover the ring at 0x%08X' % FAULT_RING_ADDRESS)
+
+    records = []
+    for slot in range(FAULT_RECORDS):
+        fields = RECORD.unpack_from(data, offset + slot * RECORD.size)
+        if fields[0] >> 24 == FAULT_MAGIC:
+            records.append((fields[0] & 0xFFFF, slot, fields))
+    if not records:
+        print('No fault recorded')
+        return 0
+
+    for sequence, slot, fields in sorted(records):
+        header, pc, lr, psr, cfsr, hfsr, address, info = fields
+        exception = (header >> 16) & 0xFF
+        stage = info & 0xFF
+        print('Fault #%d (slot %d): %s' % (sequence, slot,
+                                           EXCEPTIONS.get(exception, 'exception %d' % exception)))
+        if pc == NO_FRAME:
+            print('  frame     not on the stack')
+        else:
+            print('  pc        0x%08X%s' % (pc, symbol(symbols, pc)))
+            print('  lr        0x%08X%s' % (lr, symbol(symbols, lr)))
+            print('  xpsr      0x%08X' % psr)
+        print('  cfsr      0x%08X  %s' % (cfsr, ' '.join(bits(cfsr, CFSR_BITS))))
+        for bit, _, text in CFSR_BITS:
+            if cfsr & (1 << bit):
+                print('              %s' % text)
+        print('  hfsr      0x%08X  %s' % (hfsr, ' '.join(bits(hfsr, HFSR_BITS))))
+        if cfsr & ((1 << 7) | (1 << 15)):
+            print('  address   0x%08X' % address)
+        print('  reset     %s' % (' '.join(n for b, n in RESET_FLAGS if info & (1 << b)) or '-'))
+        print('  return    0x%02X  %s' % ((info >> 16) & 0xFF,
+                                          EXC_RETURN.get((info >> 16) & 0xFF, '')))
+        print('  stage     %s, detail %d' % (STAGES.get(stage, str(stage)), (info >> 8) & 0xFF))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('dump', help='data EEPROM dump, binary or hexadecimal words')
+    parser.add_argument('--base', type=lambda s: int(s, 0), default=FAULT_RING_ADDRESS,
+                        help='address of the first byte of the dump')
+    parser.add_argument('--map', help='IAR linker map of the image')
+    args = parser.parse_args()
+
+    symbols = load_symbols(args.map) if args.map else None
+    try:
+        return decode(read_dump(args.dump), args.base, symbols)
+    except ValueError as e:
+        print('fault_decode.py: %s' % e, file=sys.stderr)
+        return 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+"""Flash and RAM footprint of the clock image, from the IAR linker map.
+
+Usage:
+  footprint.py report   MAP [--symbols N]
+  footprint.py baseline MAP [-o BASELINE]
+  footprint.py check    MAP [-b BASELINE] [--tolerance BYTES] [--budget BYTES]
+
+report    per object and per library sizes, the HAL modules linked and the
+          N largest symbols.
+baseline  write the per object sizes of MAP to BASELINE.
+check     compare MAP with BASELINE. Every object that grew by more than
+          --tolerance bytes of read-only memory (code + constants) or of
+          read-write memory is flagged, as are the objects new to the image.
+          Exits with 1 on a regression or when the read-only total is over
+          --budget.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, '..', '..'))
+DEFAULT_MAP = os.path.join(ROOT, 'Application', 'EWARM', 'STM32L152C-Discovery',
+                           'List', 'Project.map')
+DEFAULT_BASELINE = os.path.join(ROOT, 'Application', 'EWARM', 'footprint_baseline.csv')
+
+# STM32L152xC: 256 Kbytes of flash
+DEFAULT_BUDGET = 256 * 1024
+
+COLUMNS = ('ro code', 'ro data', 'rw data')
+# Rows of the module summary that are not objects: alignment gaps, and the
+# stack, heap and init tables
+LINKER_ROWS = ('Gaps', 'Linker created')
+HAL_MODULE = re.compile(r'^stm32l1xx_(hal|ll)_?(\w*)\.o$')
+ENTRY = re.compile(r"^\s*(0x[0-9a-fA-F']+)\s+(0x[0-9a-fA-F']+)?\s*(Code|Data|--)\s+"
+                   r"(\w+)\s+(.*?)\s*$")
+
+
+class Module:
+    """Sizes of one linked object."""
+
+    def __init__(self, name, library, ro_code=0, ro_data=0, rw_data=0):
+        self.name = name
+        self.library = library
+        self.ro_code = ro_code
+        self.ro_data = ro_data
+        self.rw_data = rw_data
+
+    @property
+    def key(self):
+        return '%s:%s' % (self.library, self.name)
+
+    @property
+    def ro(self):
+        return self.ro_code + self.ro_data
+
+
+def number(text):
+    """IAR numbers use ' as thousands separator."""
+    text = text.replace("'", '').strip()
+    if not text:
+        return 0
+    return int(text, 0)
+
+
+def section(lines, title):
+    """Lines of a '*** TITLE' section of the map."""
+    out = None
+    for line in lines:
+        if line.startswith('*** '):
+            if out is not None:
+                break
+            if line[4:].strip() == title:
+                out = []
+            continue
+        if out is not None:
+            out.append(line)
+    if out is None:
+        raise ValueError('no %s section in the map' % title)
+    return out
+
+
+def parse_modules(lines):
+    """Objects of the MODULE SUMMARY, with the library they come from."""
+    modules = []
+    ends = None
+    library = None
+    for line in section(lines, 'MODULE SUMMARY'):
+        if ends is None:
+            if all(c in line for c in COLUMNS):
+                ends = [line.index(c) + len(c) for c in COLUMNS]
+            continue
+        stripped = line.strip()
+        if not stripped or stripped.startswith('-'):
+            continue
+        if not line.startswith(' ') and stripped.endswith(']') and ':' in stripped:
+            # Object folder or library, the folder path is left out
+            library = stripped[:stripped.rindex(':')]
+            library = os.path.basename(library.replace('\\', '/')) or library
+            continue
+        if stripped.startswith('Grand Total'):
+            break
+        if line.startswith(' ') and library is not None:
+            name, owner = stripped.split()[0], library
+            if name.endswith(':'):
+                continue
+            for special in LINKER_ROWS:
+                if stripped.startswith(special):
+                    name, owner = special, 'linker'
+            start = len(line) - len(line.lstrip())
+            fields, prev = [], start + len(name)
+            for end in ends:
+                fields.append(number(line[prev:end]))
+                prev = end
+            modules.append(Module(name, owner, *fields))
+    return modules
+
+
+def parse_entries(lines):
+    """Symbols of the ENTRY LIST: (name, size, kind, object, address)."""
+    entries = []
+    pending = None
+    for line in section(lines, 'ENTRY LIST'):
+        if not line.strip() or line.startswith('Entry') or line.startswith('-----'):
+            continue
+        if line.startswith('['):
+            break
+        if not line.startswith(' '):
+            # Long names are alone on their line, the fields follow
+            parts = line.split(None, 1)
+            pending = parts[0]
+            if len(parts) == 1:
+                continue
+            line = ' ' + parts[1]
+        match = ENTRY.match(line)
+        if match is None or pending is None:
+            pending = None
+            continue
+        size = number(match.group(2)) if match.group(2) else 0
+        entries.append((pending, size, match.group(3), match.group(5), number(match.group(1))))
+        pending = None
+    return entries
+
+
+def load(path):
+    with open(path, 'r', encoding='latin-1') as f:
+        lines = [l.rstrip('\r\n') for l in f]
+    return parse_modules(lines), parse_entries(lines)
+
+
+def read_baseline(path):
+    modules = {}
+    with open(path, 'r') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#') or line.startswith('library,'):
+                continue
+            library, name, ro_code, ro_data, rw_data = line.split(',')
+            m = Module(name, library, int(ro_code), int(ro_data), int(rw_data))
+            modules[m.key] = m
+    return modules
+
+
+def write_baseline(path, modules):
+    with open(path, 'w', newline='\n') as f:
+        f.write('# Footprint baseline, written by Utilities/Footprint/footprint.py\n')
+        f.write('library,object,ro_code,ro_data,rw_data\n')
+        for m in sorted(modules, key=lambda m: (m.library, m.name)):
+            f.write('%s,%s,%d,%d,%d\n' % (m.library, m.name, m.ro_code, m.ro_data, m.rw_data))
+
+
+def totals(modules):
+    return (sum(m.ro_code for m in modules), sum(m.ro_data for m in modules),
+            sum(m.rw_data for m in modules))
+
+
+def cmd_report(args):
+    modules, entries = load(args.map)
+    row = '%-40s %8s %8s %8s'
+
+    print(row % ('Object', 'ro code', 'ro data', 'rw data'))
+    for library in sorted(set(m.library for m in modules)):
+        group = [m for m in modules if m.library == library]
+        print('%s:' % library)
+        for m in sorted(group, key=lambda m: -m.ro):
+            print(row % ('  ' + m.name, m.ro_code, m.ro_data, m.rw_data))
+        print(row % ('  total', *totals(group)))
+    print(row % ('Total', *totals(modules)))
+
+    hal = sorted(HAL_MODULE.match(m.name).group(2) or 'core'
+                 for m in modules if HAL_MODULE.match(m.name))
+    print('\nHAL/LL modules linked (%d): %s' % (len(hal), ', '.join(hal)))
+
+    if args.symbols:
+        print('\nLargest symbols:')
+        for name, size, kind, obj, _ in sorted(entries, key=lambda e: -e[1])[:args.symbols]:
+            print('  %-36s %6d  %-4s  %s' % (name, size, kind, obj))
+    return 0
+
+
+def cmd_baseline(args):
+    modules, _ = load(args.map)
+    write_baseline(args.output, modules)
+    print('%d objects written to %s' % (len(modules), args.output))
+    return 0
+
+
+def cmd_check(args):
+    modules, _ = load(args.map)
+    base = read_baseline(args.baseline)
+    current = dict((m.key, m) for m in modules)
+    regressions = 0
+    row = '%-52s %8s %8s %8s'
+
+    print(row % ('Object', 'ro', 'delta', 'rw delta'))
+    for key in sorted(set(base) | set(current)):
+        new, old = current.get(key), base.get(key)
+        if new is None:
+            print(row % (key, 0, -old.ro, -old.rw_data) + '  removed')
+            continue
+        if old is None:
+            old = Module(new.name, new.library)
+        d_ro, d_rw = new.ro - old.ro, new.rw_data - old.rw_data
+        if d_ro == 0 and d_rw == 0:
+            continue
+        flag = ''
+        if d_ro > args.tolerance or d_rw > args.tolerance or key not in base:
+            flag = '  REGRESSION' if key in base else '  NEW'
+            regressions += 1
+        print(row % (key, new.ro, '%+d' % d_ro, '%+d' % d_rw) + flag)
+
+    ro_code, ro_data, rw_data = totals(modules)
+    b_code, b_data, b_rw = totals(base.values())
+    print('\nRead-only: %d bytes (%+d), read-write: %d bytes (%+d), budget %d bytes'
+          % (ro_code + ro_data, ro_code + ro_data - b_code - b_data,
+             rw_data, rw_data - b_rw, args.budget))
+
+    status = 0
+    if regressions:
+        print('%d object(s) over the baseline' % regressions)
+        status = 1
+    if ro_code + ro_data > args.budget:
+        print('Read-only total over the flash budget')
+        status = 1
+    return status
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('report', help='per object and per symbol sizes')
+    p.add_argument('map', nargs='?', default=DEFAULT_MAP)
+    p.add_argument('--symbols', type=int, default=20, help='largest symbols listed')
+    p.set_defaults(func=cmd_report)
+
+    p = sub.add_parser('baseline', help='write the baseline from a map')
+    p.add_argument('map', nargs='?', default=DEFAULT_MAP)
+    p.add_argument('-o', '--output', default=DEFAULT_BASELINE)
+    p.set_defaults(func=cmd_baseline)
+
+    p = sub.add_parser('check', help='compare a map with the baseline')
+    p.add_argument('map', nargs='?', default=DEFAULT_MAP)
+    p.add_argument('-b', '--baseline', default=DEFAULT_BASELINE)
+    p.add_argument('--tolerance', type=int, default=0,
+                   help='growth in bytes accepted per object')
+    p.add_argument('--budget', type=int, default=DEFAULT_BUDGET,
+                   help='read-only bytes available in flash')
+    p.set_defaults(func=cmd_check)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
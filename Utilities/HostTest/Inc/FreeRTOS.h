@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/FreeRTOS.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the FreeRTOS kernel header: the types and the
+  *          port macros rtos_tick.c uses, on functions of the test.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* As in the Cortex-M3 port */
+typedef uint32_t      TickType_t;
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+
+/* Exported macro ------------------------------------------------------------*/
+/* As in the Cortex-M3 port, portEND_SWITCHING_ISR() included */
+#define portSET_INTERRUPT_MASK_FROM_ISR()       ulPortRaiseBASEPRI()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(__M__) vPortSetBASEPRI(__M__)
+#define portYIELD()                             vPortYield()
+#define portYIELD_FROM_ISR(__X__)               do { if ((__X__) != pdFALSE) { portYIELD(); } } while (0)
+
+/* Exported functions ------------------------------------------------------- */
+UBaseType_t ulPortRaiseBASEPRI(void);
+void        vPortSetBASEPRI(UBaseType_t Mask);
+void        vPortYield(void);
+
+#endif /* INC_FREERTOS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/ff_gen_drv.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the FatFs driver interface used by the
+  *          sd_diskio.c drivers: the types and the disk_ioctl() codes only.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FF_GEN_DRV_H
+#define __FF_GEN_DRV_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef unsigned int UINT;
+typedef uint8_t      BYTE;
+typedef uint16_t     WORD;
+typedef uint32_t     DWORD;
+typedef BYTE         DSTATUS;
+
+typedef enum
+{
+  RES_OK = 0,
+  RES_ERROR,
+  RES_WRPRT,
+  RES_NOTRDY,
+  RES_PARERR
+} DRESULT;
+
+typedef struct
+{
+  DSTATUS (*disk_initialize)(BYTE);
+  DSTATUS (*disk_status)(BYTE);
+  DRESULT (*disk_read)(BYTE, BYTE*, DWORD, UINT);
+  DRESULT (*disk_write)(BYTE, const BYTE*, DWORD, UINT);
+  DRESULT (*disk_ioctl)(BYTE, BYTE, void*);
+} Diskio_drvTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define _USE_WRITE        1
+#define _USE_IOCTL        1
+
+#define STA_NOINIT        0x01
+#define CTRL_SYNC         0
+#define GET_SECTOR_COUNT  1
+#define GET_SECTOR_SIZE   2
+#define GET_BLOCK_SIZE    3
+
+#endif /* __FF_GEN_DRV_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/host_hal.h
+  * @author  MCD Application Team
+  * @brief   Host build of the application modules: the HAL and CMSIS headers
+  *          are the ones of the target, the core intrinsics and the core
+  *          peripherals and the RCC are redirected to host stand-ins.
+  *
+  *          Include this file first, then the module source under test: the
+  *          macros below only apply to the code that follows them.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_HAL_H
+#define __HOST_HAL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Core intrinsics: barriers are host fences, PRIMASK is a variable */
+#define __DMB()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#undef  __NOP
+#undef  __WFI
+#undef  __WFE
+#define __NOP()                 ((void)0)
+#define __WFI()                 HOST_Wfi()
+#define __WFE()                 HOST_Wfi()
+#define __disable_irq()         (HostPrimask = 1U)
+#define __enable_irq()          (HostPrimask = 0U)
+#define __get_PRIMASK()         (HostPrimask)
+#define __set_PRIMASK(__M__)    (HostPrimask = (__M__))
+
+/* The inline NVIC functions of core_cm3.h use the fixed addresses */
+#undef  NVIC_EnableIRQ
+#undef  NVIC_DisableIRQ
+#undef  NVIC_ClearPendingIRQ
+#undef  NVIC_SystemReset
+#define NVIC_EnableIRQ(__IRQ__)        ((void)(__IRQ__))
+#define NVIC_DisableIRQ(__IRQ__)       ((void)(__IRQ__))
+#define NVIC_ClearPendingIRQ(__IRQ__)  ((void)(__IRQ__))
+#define NVIC_SystemReset()             HOST_Reset()
+
+/* Core peripherals in host memory */
+#undef  DWT
+#define DWT                     (&HostDwt)
+#undef  SCB
+#define SCB                     (&HostScb)
+#undef  SysTick
+#define SysTick                 (&HostSysTick)
+
+/* Clock gating of the peripherals in host memory */
+#undef  RCC
+#define RCC                     (&HostRcc)
+
+/* Test checks: a failure is reported with its line, the test goes on */
+#define HOST_CHECK(__COND__)    HOST_Check((__COND__) ? 1 : 0, #__COND__, __FILE__, __LINE__)
+
+/* Exported variables --------------------------------------------------------*/
+extern __IO uint32_t HostPrimask;
+extern DWT_Type      HostDwt;
+extern SCB_Type      HostScb;
+extern SysTick_Type  HostSysTick;
+extern RCC_TypeDef   HostRcc;
+extern uint32_t      HostFailed;
+
+/* Exported functions ------------------------------------------------------- */
+void     HOST_Check(int Passed, const char *Text, const char *File, int Line);
+int      HOST_Report(const char *Name);
+void     HOST_Wfi(void);
+void     HOST_Reset(void);
+uint64_t HOST_Nanoseconds(void);
+
+#endif /* __HOST_HAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
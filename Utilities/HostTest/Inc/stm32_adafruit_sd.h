@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/stm32_adafruit_sd.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the Adafruit shield SD BSP: the test
+  *          provides the functions, on a fake card.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32_ADAFRUIT_SD_H
+#define __STM32_ADAFRUIT_SD_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t CardCapacity;
+  uint32_t CardBlockSize;
+} SD_CardInfo;
+
+/* Exported constants --------------------------------------------------------*/
+#define MSD_OK            0x00U
+#define MSD_ERROR         0x01U
+#define SD_BLOCK_SIZE     512U
+
+/* Exported functions ------------------------------------------------------- */
+uint8_t BSP_SD_Init(void);
+uint8_t BSP_SD_GetStatus(void);
+uint8_t BSP_SD_GetCardInfo(SD_CardInfo *CardInfo);
+
+#endif /* __STM32_ADAFRUIT_SD_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
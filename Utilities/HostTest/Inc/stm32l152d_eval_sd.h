@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/stm32l152d_eval_sd.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the STM32L152D-EVAL SD BSP: the test
+  *          provides the functions, on a fake card.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32L152D_EVAL_SD_H
+#define __STM32L152D_EVAL_SD_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef HAL_SD_CardInfoTypeDef BSP_SD_CardInfo;
+
+/* Exported constants --------------------------------------------------------*/
+#define MSD_OK            0x00U
+#define MSD_ERROR         0x01U
+
+/* Exported functions ------------------------------------------------------- */
+uint8_t BSP_SD_Init(void);
+uint8_t BSP_SD_ReadBlocks_DMA(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOfBlocks);
+uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint32_t WriteAddr, uint32_t NumOfBlocks);
+uint8_t BSP_SD_GetCardState(void);
+void    BSP_SD_GetCardInfo(BSP_SD_CardInfo *CardInfo);
+void    BSP_SD_ReadCpltCallback(void);
+void    BSP_SD_WriteCpltCallback(void);
+
+#endif /* __STM32L152D_EVAL_SD_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/stm32l1xx_nucleo.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the NUCLEO-L152RE BSP: the SPI of the
+  *          shield and the SD chip select, driven by the test.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32L1XX_NUCLEO_H
+#define __STM32L1XX_NUCLEO_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l1xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define NUCLEO_SPIx       SPI1
+
+/* Exported macro ------------------------------------------------------------*/
+#define SD_CS_LOW()       HOST_SdSelect(1U)
+#define SD_CS_HIGH()      HOST_SdSelect(0U)
+
+/* Exported functions ------------------------------------------------------- */
+void HOST_SdSelect(uint32_t Selected);
+
+#endif /* __STM32L1XX_NUCLEO_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
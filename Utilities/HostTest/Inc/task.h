@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/task.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the FreeRTOS task header: the scheduler calls
+  *          rtos_tick.c makes, implemented by the test.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  eAbortSleep = 0,
+  eStandardSleep,
+  eNoTasksWaitingTimeout
+} eSleepModeStatus;
+
+/* Exported constants --------------------------------------------------------*/
+#define taskSCHEDULER_SUSPENDED     ((BaseType_t)0)
+#define taskSCHEDULER_NOT_STARTED   ((BaseType_t)1)
+#define taskSCHEDULER_RUNNING       ((BaseType_t)2)
+
+/* Exported functions ------------------------------------------------------- */
+BaseType_t       xTaskGetSchedulerState(void);
+BaseType_t       xTaskIncrementTick(void);
+eSleepModeStatus eTaskConfirmSleepModeStatus(void);
+void             vTaskStepTick(TickType_t xTicksToJump);
+
+#endif /* INC_TASK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
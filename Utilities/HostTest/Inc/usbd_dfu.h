@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/Inc/usbd_dfu.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the DFU class header of the STM32 USB device
+  *          library: the media interface of the flash layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_DFU_H
+#define __USB_DFU_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_conf.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define DFU_MEDIA_ERASE         0x00U
+#define DFU_MEDIA_PROGRAM       0x01U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const uint8_t *pStrDesc;
+  uint16_t (* Init)(void);
+  uint16_t (* DeInit)(void);
+  uint16_t (* Erase)(uint32_t Add);
+  uint16_t (* Write)(uint8_t *src, uint8_t *dest, uint32_t Len);
+  uint8_t *(* Read)(uint8_t *src, uint8_t *dest, uint32_t Len);
+  uint16_t (* GetStatus)(uint32_t Add, uint8_t cmd, uint8_t *buff);
+} USBD_DFU_MediaTypeDef;
+
+#endif /* __USB_DFU_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,390 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/chime_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the chime synthesiser of Application/Src/chime.c.
+  *
+  *          The DMA is played by the test: each half of the ping-pong
+  *          buffer is appended to the output, then the half or complete
+  *          transfer callback refills it, until the chime halts. Checked
+  *          for every chime: the samples of sound, the DAC codes within
+  *          0..4095, the silence after the end, and the halt on the
+  *          interrupt that follows the last half with sound, with the STOP
+  *          mode inhibit released and the clocks gated.
+  *
+  *          The sounds are written as 8 kHz WAV files next to the test
+  *          binary, to be listened to.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+
+/* The sample period is written to TIM6 */
+static TIM_TypeDef HostTim6;
+#undef  TIM6
+#define TIM6                    (&HostTim6)
+
+#include "chime.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Longest chime, the countdown alarm: 12 s */
+#define TEST_SAMPLES_MAX   CHIME_MS(13000U)
+
+/* Samples of sound of each chime, from its steps */
+#define TEST_HOUR_SAMPLES  CHIME_MS(500U + 500U + 500U + 1000U)
+#define TEST_ALARM_SAMPLES (CHIME_ALARM_REPEAT * CHIME_MS((5U * 80U) + 800U))
+#define TEST_TICK_SAMPLES  CHIME_MS(50U)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint16_t TestOut[TEST_SAMPLES_MAX];
+static uint32_t TestOutCount;
+static uint32_t TestInhibit;
+static uint32_t TestDmaStarts;
+static uint32_t TestDmaStops;
+static uint32_t TestPclk1 = 2097152U;
+
+static const char *TestNames[CHIME_COUNT] = {"hour", "alarm", "tick"};
+static const uint32_t TestSound[CHIME_COUNT] =
+{
+  TEST_HOUR_SAMPLES, TEST_ALARM_SAMPLES, TEST_TICK_SAMPLES
+};
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/* Other modules ------------------------------------------------------------ */
+void EVT_InhibitStop(uint32_t Source, FunctionalState State)
+{
+  HOST_CHECK(Source == EVT_STOP_CHIME);
+  TestInhibit = (State == ENABLE) ? 1U : 0U;
+}
+
+/* HAL ---------------------------------------------------------------------- */
+HAL_StatusTypeDef HAL_DAC_Init(DAC_HandleTypeDef *hdac)
+{
+  HAL_DAC_MspInit(hdac);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_ConfigChannel(DAC_HandleTypeDef *hdac, DAC_ChannelConfTypeDef *sConfig, uint32_t Channel)
+{
+  HOST_CHECK(Channel == CHIME_DAC_CHANNEL);
+  HOST_CHECK(sConfig->DAC_Trigger == DAC_TRIGGER_T6_TRGO);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t *pData, uint32_t Length,
+                                    uint32_t Alignment)
+{
+  HOST_CHECK((uint16_t *)pData == ChimeBuffer);
+  HOST_CHECK(Length == CHIME_BUFFER_SAMPLES);
+  HOST_CHECK(Alignment == DAC_ALIGN_12B_R);
+  TestDmaStarts++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Stop_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+  TestDmaStops++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim,
+                                                        TIM_MasterConfigTypeDef *sMasterConfig)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  HOST_CHECK(hdma->Init.Mode == DMA_CIRCULAR);
+  return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  HOST_CHECK(GPIO_Init->Pin == CHIME_DAC_PIN);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+  return TestPclk1;
+}
+
+/* Tests -------------------------------------------------------------------- */
+
+/**
+  * @brief  Half or complete transfer interrupt of the DAC channel in use.
+  * @param  Half: 0 for the first half, 1 for the second one
+  * @retval None
+  */
+static void TEST_Interrupt(uint32_t Half)
+{
+#if defined(USE_STM32L1XX_NUCLEO)
+  if (Half == 0U)
+  {
+    HAL_DAC_ConvHalfCpltCallbackCh1(&ChimeDacHandle);
+  }
+  else
+  {
+    HAL_DAC_ConvCpltCallbackCh1(&ChimeDacHandle);
+  }
+#else
+  if (Half == 0U)
+  {
+    HAL_DACEx_ConvHalfCpltCallbackCh2(&ChimeDacHandle);
+  }
+  else
+  {
+    HAL_DACEx_ConvCpltCallbackCh2(&ChimeDacHandle);
+  }
+#endif
+}
+
+/**
+  * @brief  Play the DMA until the chime halts: each half is output, then
+  *         its interrupt refills it.
+  * @param  MaxHalves: Halves to play at most, 0 for no limit
+  * @retval None
+  */
+static void TEST_Run(uint32_t MaxHalves)
+{
+  uint32_t half = 0U, played = 0U;
+
+  while ((CHIME_IsPlaying() != 0U) && ((MaxHalves == 0U) || (played < MaxHalves)))
+  {
+    HOST_CHECK((TestOutCount + CHIME_HALF_SAMPLES) <= TEST_SAMPLES_MAX);
+    if ((TestOutCount + CHIME_HALF_SAMPLES) > TEST_SAMPLES_MAX)
+    {
+      return;
+    }
+    memcpy(&TestOut[TestOutCount], &ChimeBuffer[half * CHIME_HALF_SAMPLES],
+           CHIME_HALF_SAMPLES * sizeof(uint16_t));
+    TestOutCount += CHIME_HALF_SAMPLES;
+    played++;
+    TEST_Interrupt(half);
+    half ^= 1U;
+  }
+}
+
+/**
+  * @brief  Write the output as a 16-bit mono WAV file.
+  * @param  Path: File name
+  * @retval None
+  */
+static void TEST_WriteWav(const char *Path)
+{
+  uint8_t header[44];
+  uint32_t bytes = TestOutCount * 2U, i;
+  FILE *file = fopen(Path, "wb");
+  int16_t value;
+
+  if (file == NULL)
+  {
+    printf("FAIL cannot write %s\n", Path);
+    HostFailed++;
+    return;
+  }
+
+  memcpy(&header[0], "RIFF", 4);
+  header[4]  = (uint8_t)(bytes + 36U);
+  header[5]  = (uint8_t)((bytes + 36U) >> 8);
+  header[6]  = (uint8_t)((bytes + 36U) >> 16);
+  header[7]  = (uint8_t)((bytes + 36U) >> 24);
+  memcpy(&header[8], "WAVEfmt ", 8);
+  header[16] = 16U; header[17] = 0U; header[18] = 0U; header[19] = 0U;
+  header[20] = 1U;  header[21] = 0U;                    /* PCM           */
+  header[22] = 1U;  header[23] = 0U;                    /* Mono          */
+  header[24] = (uint8_t)CHIME_SAMPLE_RATE;
+  header[25] = (uint8_t)(CHIME_SAMPLE_RATE >> 8);
+  header[26] = 0U;  header[27] = 0U;
+  header[28] = (uint8_t)(CHIME_SAMPLE_RATE * 2U);
+  header[29] = (uint8_t)((CHIME_SAMPLE_RATE * 2U) >> 8);
+  header[30] = 0U;  header[31] = 0U;
+  header[32] = 2U;  header[33] = 0U;                    /* Block align   */
+  header[34] = 16U; header[35] = 0U;                    /* Bits          */
+  memcpy(&header[36], "data", 4);
+  header[40] = (uint8_t)bytes;
+  header[41] = (uint8_t)(bytes >> 8);
+  header[42] = (uint8_t)(bytes >> 16);
+  header[43] = (uint8_t)(bytes >> 24);
+  fwrite(header, sizeof(header), 1U, file);
+
+  /* 12-bit DAC codes around mid scale to 16-bit samples, little endian */
+  for (i = 0U; i < TestOutCount; i++)
+  {
+    value = (int16_t)(((int32_t)TestOut[i] - CHIME_DAC_MID) * 16);
+    fputc(value & 0xFF, file);
+    fputc((value >> 8) & 0xFF, file);
+  }
+  fclose(file);
+}
+
+/**
+  * @brief  Play each chime to its end and check what the DAC received.
+  * @param  Dir: Directory of the WAV files
+  * @retval None
+  */
+static void TEST_Chimes(const char *Dir)
+{
+  char path[512];
+  uint32_t chime, i, sound, halves, outside, first, last;
+
+  for (chime = 0U; chime < CHIME_COUNT; chime++)
+  {
+    TestOutCount = 0U;
+    TestDmaStarts = TestDmaStops = 0U;
+
+    CHIME_Play((CHIME_TypeDef)chime);
+    HOST_CHECK(TestInhibit == 1U);
+    HOST_CHECK(TestDmaStarts == 1U);
+    HOST_CHECK(READ_BIT(RCC->APB1ENR, RCC_APB1ENR_TIM6EN | RCC_APB1ENR_DACEN) ==
+               (RCC_APB1ENR_TIM6EN | RCC_APB1ENR_DACEN));
+    TEST_Run(0U);
+
+    /* Played up to the half holding the end of the sound, then halted */
+    sound  = TestSound[chime];
+    halves = (sound / CHIME_HALF_SAMPLES) + 1U;
+    HOST_CHECK(CHIME_IsPlaying() == 0U);
+    HOST_CHECK(TestOutCount == (halves * CHIME_HALF_SAMPLES));
+    HOST_CHECK(TestDmaStops == 1U);
+    HOST_CHECK(TestInhibit == 0U);
+    HOST_CHECK(READ_BIT(RCC->APB1ENR, RCC_APB1ENR_TIM6EN | RCC_APB1ENR_DACEN) == 0U);
+
+    /* 12-bit codes, sound up to its length, silence after */
+    outside = 0U;
+    first = TestOutCount;
+    last = 0U;
+    for (i = 0U; i < TestOutCount; i++)
+    {
+      if (TestOut[i] > 4095U)
+      {
+        outside++;
+      }
+      if (TestOut[i] != CHIME_DAC_MID)
+      {
+        first = (first < i) ? first : i;
+        last = i + 1U;
+      }
+    }
+    HOST_CHECK(outside == 0U);
+    HOST_CHECK(first < CHIME_MS(1U));
+    HOST_CHECK(last <= sound);
+
+    snprintf(path, sizeof(path), "%s/chime_%s.wav", Dir, TestNames[chime]);
+    TEST_WriteWav(path);
+    printf("chime_test: %-5s %6lu samples of sound, %lu halves played, %s\n", TestNames[chime],
+           (unsigned long)sound, (unsigned long)halves, path);
+  }
+}
+
+/**
+  * @brief  The sample period follows PCLK1, also while playing, a chime
+  *         restarts in place and CHIME_Stop() halts at once.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Control(void)
+{
+  TestPclk1 = 32000000U;
+  TestDmaStarts = TestDmaStops = 0U;
+  TestOutCount = 0U;
+
+  CHIME_Play(CHIME_ALARM);
+  HOST_CHECK(HostTim6.ARR == ((32000000U / CHIME_SAMPLE_RATE) - 1U));
+  TEST_Run(10U);
+
+  /* Restarted from the first step, on the same DMA: the two halves already
+     filled with the alarm are played first */
+  CHIME_Play(CHIME_TICK);
+  HOST_CHECK(TestDmaStarts == 1U);
+  TEST_Run(0U);
+  HOST_CHECK(TestDmaStops == 1U);
+  HOST_CHECK(TestOutCount == ((10U + 2U + (TEST_TICK_SAMPLES / CHIME_HALF_SAMPLES) + 1U) * CHIME_HALF_SAMPLES));
+
+  TestPclk1 = 2097152U;
+  CHIME_Play(CHIME_HOUR);
+  HOST_CHECK(HostTim6.ARR == ((2097152U / CHIME_SAMPLE_RATE) - 1U));
+  TEST_Run(2U);
+
+  /* The core on the HSI for a TFT repaint or a sample set, then back */
+  TestPclk1 = 16000000U;
+  HostTim6.CNT = 200U;
+  CHIME_ClockUpdate();
+  HOST_CHECK((HostTim6.ARR == ((16000000U / CHIME_SAMPLE_RATE) - 1U)) && (HostTim6.CNT == 0U));
+  TEST_Run(2U);
+  TestPclk1 = 2097152U;
+  HostTim6.CNT = 1500U;
+  CHIME_ClockUpdate();
+  HOST_CHECK((HostTim6.ARR == ((2097152U / CHIME_SAMPLE_RATE) - 1U)) && (HostTim6.CNT == 0U));
+  CHIME_Stop();
+  HOST_CHECK(CHIME_IsPlaying() == 0U);
+  HOST_CHECK(TestDmaStops == 2U);
+  HOST_CHECK(TestInhibit == 0U);
+  CHIME_Stop();
+  HOST_CHECK(TestDmaStops == 2U);
+
+  /* Nothing to follow once stopped */
+  TestPclk1 = 16000000U;
+  CHIME_ClockUpdate();
+  HOST_CHECK(HostTim6.ARR == ((2097152U / CHIME_SAMPLE_RATE) - 1U));
+}
+
+int main(int argc, char *argv[])
+{
+  char dir[512] = ".";
+  const char *slash = strrchr(argv[0], '/');
+
+  if (slash != NULL)
+  {
+    snprintf(dir, sizeof(dir), "%.*s", (int)(slash - argv[0]), argv[0]);
+  }
+
+  CHIME_Init();
+  TEST_Chimes(dir);
+  TEST_Control();
+  return HOST_Report("chime_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
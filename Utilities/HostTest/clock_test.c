@@ -0,0 +1,478 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/clock_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the display modes of Application/Src/clock.c and
+  *          of the stopwatch and countdown of Application/Src/chrono.c.
+  *
+  *          The user button and the touch slider handlers are called as
+  *          button.c and touch.c call them, the 1 s wake-up and the Alarm B
+  *          events go through the rings of event.c. The RTC is a time stamp
+  *          moved by the test, which runs the Alarm B callback when the
+  *          stamp reaches the alarm.
+  *
+  *          Checked: the short press cycles the modes, the long press starts
+  *          and stops the timers and resets them right after a stop, the
+  *          slider steps the countdown preset, and a countdown started from
+  *          the button expires through EVT_COUNTDOWN_EXPIRED: the alarm
+  *          sounds and the countdown blinks, wherever the display was.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+#include "event.c"
+#include "chrono.c"
+#include "clock.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* 10:20:30, away from the hour chime */
+#define TEST_START_STAMP        (((10U * 3600U) + (20U * 60U) + 30U) * RTC_STAMP_FREQ)
+
+/* Private macro -------------------------------------------------------------*/
+#define TEST_SHOWN(__STR__)     (strcmp(TestShown, (__STR__)) == 0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t            TestStamp;
+static uint32_t            TestAlarm;
+static uint32_t            TestAlarmArmed;
+static uint32_t            TestAlarmsSet;
+
+static char                TestShown[16];
+static DISPLAY_BlinkTypeDef TestBlink;
+static uint32_t            TestContrast;
+static CHIME_TypeDef       TestChime;
+static uint32_t            TestChimePlaying;
+
+static EVT_HandlerTypeDef  TestButton;
+static EVT_HandlerTypeDef  TestTouch;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/* RTC ---------------------------------------------------------------------- */
+uint32_t RTC_GetStamp(void)
+{
+  return TestStamp;
+}
+
+void RTC_GetTime(uint8_t *hour, uint8_t *min, uint8_t *sec)
+{
+  uint32_t seconds = TestStamp / RTC_STAMP_FREQ;
+
+  *hour = (uint8_t)(seconds / 3600U);
+  *min = (uint8_t)((seconds / 60U) % 60U);
+  *sec = (uint8_t)(seconds % 60U);
+}
+
+void RTC_SetTime(uint8_t hour, uint8_t min)
+{
+  TestStamp = ((hour * 3600U) + (min * 60U)) * RTC_STAMP_FREQ;
+}
+
+void RTC_SetAlarmB(uint32_t stamp)
+{
+  TestAlarm = stamp % RTC_STAMP_PER_DAY;
+  TestAlarmArmed = 1U;
+  TestAlarmsSet++;
+}
+
+void RTC_CancelAlarmB(void)
+{
+  HOST_CHECK(TestAlarmArmed != 0U);
+  TestAlarmArmed = 0U;
+}
+
+void RTC_BackupWrite(uint32_t reg, uint32_t data)
+{
+}
+
+uint32_t RTC_BackupRead(uint32_t reg)
+{
+  return 0U;
+}
+
+/* Other modules ------------------------------------------------------------ */
+void DISPLAY_ShowString(const uint8_t *str)
+{
+  snprintf(TestShown, sizeof(TestShown), "%s", (const char *)str);
+}
+
+void DISPLAY_ShowFrame(const DISPLAY_FrameTypeDef *Frame)
+{
+}
+
+void DISPLAY_Blink(DISPLAY_BlinkTypeDef Blink)
+{
+  TestBlink = Blink;
+}
+
+void DISPLAY_Contrast(uint32_t Level)
+{
+  TestContrast = Level;
+}
+
+void CHIME_Play(CHIME_TypeDef Chime)
+{
+  TestChime = Chime;
+  TestChimePlaying = 1U;
+}
+
+void CHIME_Stop(void)
+{
+  TestChimePlaying = 0U;
+}
+
+uint32_t CHIME_IsPlaying(void)
+{
+  return TestChimePlaying;
+}
+
+void BTN_Init(EVT_HandlerTypeDef Handler)
+{
+  TestButton = Handler;
+}
+
+void TOUCH_Init(EVT_HandlerTypeDef Handler)
+{
+  TestTouch = Handler;
+}
+
+uint32_t SENSE_Read(SENSE_SnapshotTypeDef *Snapshot)
+{
+  return 0U;
+}
+
+uint32_t LOG_Now(void)
+{
+  return 0U;
+}
+
+void LOG_Write(LOG_TypeDef Type, uint16_t Arg, uint32_t Value)
+{
+}
+
+void PROF_Record(PROF_IdTypeDef Id, uint32_t StartCycles)
+{
+}
+
+void WDG_OnSecond(void)
+{
+}
+
+void SENSE_OnSecond(void)
+{
+}
+
+void BATT_OnSecond(void)
+{
+}
+
+void TOUCH_OnSecond(void)
+{
+}
+
+/* EVT_Sleep(), not called */
+void WDG_Idle(void)
+{
+}
+
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry)
+{
+}
+
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry)
+{
+}
+
+void SystemCoreClockUpdate(void)
+{
+}
+
+/* Tests -------------------------------------------------------------------- */
+/**
+  * @brief  Run the main loop until the rings are empty.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Dispatch(void)
+{
+  while (EVT_Dispatch() != 0U)
+  {
+  }
+}
+
+/**
+  * @brief  Move the RTC on by whole seconds, with a wake-up event each
+  *         second and the Alarm B interrupt when its stamp is reached.
+  * @param  Seconds: Seconds to run
+  * @retval None
+  */
+static void TEST_Run(uint32_t Seconds)
+{
+  uint32_t i, s;
+
+  for (i = 0U; i < Seconds; i++)
+  {
+    for (s = 0U; s < RTC_STAMP_FREQ; s++)
+    {
+      TestStamp = (TestStamp + 1U) % RTC_STAMP_PER_DAY;
+      if ((TestAlarmArmed != 0U) && (TestStamp == TestAlarm))
+      {
+        TestAlarmArmed = 0U;
+        HAL_RTCEx_AlarmBEventCallback(NULL);
+      }
+    }
+    HOST_CHECK(EVT_Post(EVT_SRC_RTC, EVT_RTC_WAKEUP, 0U) == HAL_OK);
+    TEST_Dispatch();
+  }
+}
+
+/**
+  * @brief  Press the user button.
+  * @param  Action: BTN_SHORT or BTN_LONG
+  * @retval None
+  */
+static void TEST_Press(BTN_ActionTypeDef Action)
+{
+  TestButton((uint32_t)Action);
+}
+
+/**
+  * @brief  Slide a finger on the slider, then release it.
+  * @param  From: First position
+  * @param  To: Last position
+  * @retval None
+  */
+static void TEST_Slide(uint32_t From, uint32_t To)
+{
+  TestTouch(From);
+  TestTouch(To);
+  TestTouch(TOUCH_RELEASED);
+}
+
+/**
+  * @brief  The short press goes through the modes and back to the time.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Modes(void)
+{
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_TIME);
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_STOPWATCH);
+  HOST_CHECK(TEST_SHOWN("00:00.00"));
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_COUNTDOWN);
+  HOST_CHECK(TEST_SHOWN("05:00.00"));
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_SENSE);
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_TIME);
+  HOST_CHECK(TEST_SHOWN("10:20:30"));
+
+  /* The long press still sets the time from there */
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(TEST_SHOWN("10:  :  "));
+  HOST_CHECK(TestBlink == DISPLAY_BLINK_FAST);
+  TEST_Run(2U * CLOCK_SET_TIMEOUT_S);
+  HOST_CHECK(ClockSetField == CLOCK_SET_NONE);
+  HOST_CHECK(TestBlink == DISPLAY_BLINK_OFF);
+  TestStamp = TEST_START_STAMP;
+}
+
+/**
+  * @brief  Stopwatch from the button: start, stop, resume, reset.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Stopwatch(void)
+{
+  CLOCK_SetMode(CLOCK_MODE_STOPWATCH);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchState() == CHRONO_RUNNING);
+  TEST_Run(65U);
+  HOST_CHECK(TEST_SHOWN("00:01:05"));
+
+  /* Stopped half a second later: frozen with hundredths */
+  TestStamp += RTC_STAMP_FREQ / 2U;
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchState() == CHRONO_STOPPED);
+  HOST_CHECK(TEST_SHOWN("01:05.50"));
+  TEST_Run(3U);
+  HOST_CHECK(TEST_SHOWN("01:05.50"));
+
+  /* Long after the stop, a long press resumes */
+  TEST_Run(CLOCK_RESET_S);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchState() == CHRONO_RUNNING);
+  TEST_Run(10U);
+  HOST_CHECK(TEST_SHOWN("00:01:15"));
+
+  /* Stop, then a second long press right after: reset */
+  TEST_Press(BTN_LONG);
+  TEST_Run(2U);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchState() == CHRONO_STOPPED);
+  HOST_CHECK(CHRONO_StopwatchElapsed() == 0U);
+  HOST_CHECK(TEST_SHOWN("00:00.00"));
+
+  /* Then a start again */
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchState() == CHRONO_RUNNING);
+  TEST_Run(1U);
+  TEST_Press(BTN_LONG);
+  TEST_Run(1U);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_StopwatchElapsed() == 0U);
+}
+
+/**
+  * @brief  Countdown preset from the slider, contrast when running.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Preset(void)
+{
+  CLOCK_SetMode(CLOCK_MODE_COUNTDOWN);
+  HOST_CHECK(TEST_SHOWN("05:00.00"));
+
+  /* Two steps up, three down */
+  TEST_Slide(100U, 100U + (2U * CLOCK_TOUCH_STEP));
+  HOST_CHECK(CHRONO_CountdownPreset() == (CHRONO_COUNTDOWN_DEFAULT_S + (2U * CLOCK_COUNTDOWN_STEP_S)));
+  HOST_CHECK(TEST_SHOWN("07:00.00"));
+  TEST_Slide(200U, 200U - (3U * CLOCK_TOUCH_STEP));
+  HOST_CHECK(TEST_SHOWN("04:00.00"));
+  HOST_CHECK(TestChime == CHIME_TICK);
+
+  /* Never below one step */
+  TEST_Slide(TOUCH_POSITION_MAX, 0U);
+  HOST_CHECK(CHRONO_CountdownPreset() == CLOCK_COUNTDOWN_STEP_S);
+  TEST_Slide(0U, 2U * CLOCK_TOUCH_STEP);
+  HOST_CHECK(CHRONO_CountdownPreset() == (3U * CLOCK_COUNTDOWN_STEP_S));
+
+  /* The other modes keep the contrast on the slider */
+  CLOCK_SetMode(CLOCK_MODE_TIME);
+  TEST_Slide(0U, TOUCH_POSITION_MAX);
+  HOST_CHECK(TestContrast == DISPLAY_CONTRAST_MAX);
+  HOST_CHECK(CHRONO_CountdownPreset() == (3U * CLOCK_COUNTDOWN_STEP_S));
+}
+
+/**
+  * @brief  Countdown from the button to EVT_COUNTDOWN_EXPIRED.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Countdown(void)
+{
+  uint32_t start;
+
+  CLOCK_SetMode(CLOCK_MODE_COUNTDOWN);
+  HOST_CHECK(TEST_SHOWN("03:00.00"));
+
+  /* Started: Alarm B on its end, to the stamp */
+  TEST_Press(BTN_LONG);
+  start = TestStamp;
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_RUNNING);
+  HOST_CHECK(TestAlarmArmed != 0U);
+  HOST_CHECK(TestAlarm == (start + (180U * RTC_STAMP_FREQ)));
+  TEST_Run(3U);
+  HOST_CHECK(TEST_SHOWN("00:02:57"));
+
+  /* The slider sets the contrast while it runs */
+  TEST_Slide(0U, TOUCH_POSITION_MAX);
+  HOST_CHECK(CHRONO_CountdownPreset() == 180U);
+
+  /* Paused for 10 s, the alarm moved along */
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_STOPPED);
+  HOST_CHECK(TestAlarmArmed == 0U);
+  HOST_CHECK(TEST_SHOWN("02:57.00"));
+  TEST_Run(10U);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_RUNNING);
+  HOST_CHECK(TestAlarm == (start + (190U * RTC_STAMP_FREQ)));
+
+  /* Expires while the time is shown: the countdown comes back on */
+  TEST_Press(BTN_SHORT);
+  TEST_Press(BTN_SHORT);
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_TIME);
+  TEST_Run(176U);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_RUNNING);
+  HOST_CHECK(TestChimePlaying == 0U);
+  TEST_Run(1U);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_EXPIRED);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_COUNTDOWN);
+  HOST_CHECK(TestChime == CHIME_ALARM);
+  HOST_CHECK(TestChimePlaying != 0U);
+  HOST_CHECK(TestBlink == DISPLAY_BLINK_SLOW);
+  HOST_CHECK(TEST_SHOWN("00:00.00"));
+  HOST_CHECK(EVT_GetDropped(EVT_SRC_RTC_ALARM) == 0U);
+
+  /* Short press silences, long press resets to the preset */
+  TEST_Press(BTN_SHORT);
+  HOST_CHECK(TestChimePlaying == 0U);
+  HOST_CHECK(CLOCK_GetMode() == CLOCK_MODE_COUNTDOWN);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_STOPPED);
+  HOST_CHECK(TestBlink == DISPLAY_BLINK_OFF);
+  HOST_CHECK(TEST_SHOWN("03:00.00"));
+
+  /* Restarted, then reset right after a stop */
+  TEST_Press(BTN_LONG);
+  TEST_Run(20U);
+  TEST_Press(BTN_LONG);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_STOPPED);
+  HOST_CHECK(CHRONO_CountdownRemaining() == (180U * RTC_STAMP_FREQ));
+  HOST_CHECK(TestAlarmArmed == 0U);
+}
+
+/**
+  * @brief  A countdown across midnight expires on time.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Midnight(void)
+{
+  TestStamp = RTC_STAMP_PER_DAY - (30U * RTC_STAMP_FREQ);
+  CLOCK_SetMode(CLOCK_MODE_COUNTDOWN);
+  TEST_Run(CLOCK_RESET_S + 1U);
+  TEST_Press(BTN_LONG);
+  HOST_CHECK(TestAlarm == ((180U - 24U) * RTC_STAMP_FREQ));
+  TEST_Run(179U);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_RUNNING);
+  TEST_Run(1U);
+  HOST_CHECK(CHRONO_CountdownState() == CHRONO_EXPIRED);
+}
+
+int main(void)
+{
+  TestStamp = TEST_START_STAMP;
+  EVT_Init();
+  CLOCK_Init();
+  HOST_CHECK((TestButton != NULL) && (TestTouch != NULL));
+
+  TEST_Modes();
+  TEST_Stopwatch();
+  TEST_Preset();
+  TEST_Countdown();
+  TEST_Midnight();
+  printf("clock_test: %u Alarm B settings\n", (unsigned)TestAlarmsSet);
+  return HOST_Report("clock_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
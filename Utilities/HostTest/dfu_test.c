@@ -0,0 +1,545 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/dfu_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the flash layer of the NUCLEO-L152RE DFU_Standalone
+  *          bootloader, usbd_dfu_flash.c: plain and delta images, and the
+  *          resume of a delta after a power failure.
+  *
+  *          The program memory and the data EEPROM are a shared mapping at
+  *          their addresses. Each download runs in a child process, the
+  *          reset of the bootloader: the flash operations are counted, and
+  *          the power fails at a given one. An erase then completes, a half
+  *          page is half programmed, a data EEPROM word is not written. The
+  *          same delta is downloaded again and must give the target image,
+  *          for a power failure at each operation, and for a second failure
+  *          while the page left torn by the first one is rewritten.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "usbd_dfu_flash.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Flash operations of a download, shared with the parent
+  */
+typedef struct
+{
+  uint32_t Budget;         /*!< Operations left before the power fails */
+  uint32_t Ops;            /*!< Operations completed                   */
+  uint32_t Erases;
+  uint32_t Halves;
+  uint32_t EepromWords;
+} TEST_StatsTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Program memory and data EEPROM */
+#define TEST_MAP_SIZE           (FLASH_EEPROM_END + 1U - FLASH_BASE)
+
+#define TEST_BASE_SIZE          (32U * FLASH_PAGE_SIZE)
+#define TEST_TARGET_SIZE        (TEST_BASE_SIZE + (2U * FLASH_PAGE_SIZE))
+#define TEST_DELTA_MAX          (sizeof(DFU_DeltaHeaderTypeDef) + (2U * TEST_TARGET_SIZE))
+
+/* Exit status of a download */
+#define TEST_DONE               0
+#define TEST_REFUSED            1
+#define TEST_CUT                2
+#define TEST_MISUSE             3
+
+#define TEST_NO_CUT             0xFFFFFFFFU
+
+/* Second power failures, from the start of the resume */
+#define TEST_SECOND_CUTS        8U
+
+/* Private macro -------------------------------------------------------------*/
+#define TEST_FLASH(address)     ((uint8_t *)(uintptr_t)(address))
+
+/* Private variables ---------------------------------------------------------*/
+static TEST_StatsTypeDef *TestStats;
+
+static uint8_t  TestBase[TEST_BASE_SIZE];
+static uint8_t  TestTarget[TEST_TARGET_SIZE];
+static uint8_t  TestDelta[TEST_DELTA_MAX];
+static uint32_t TestDeltaSize;
+static uint8_t  TestSnapshot[TEST_MAP_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Counts a flash operation.
+  * @param  None
+  * @retval 1 if the power fails during this one
+  */
+static uint32_t TEST_PowerFails(void)
+{
+  if (TestStats->Budget == 0U)
+  {
+    return 1U;
+  }
+  if (TestStats->Budget != TEST_NO_CUT)
+  {
+    TestStats->Budget--;
+  }
+  TestStats->Ops++;
+  return 0U;
+}
+
+/**
+  * @brief  CRC unit of the STM32L1, CRC-32/MPEG-2 over words.
+  * @param  Data: Words
+  * @param  Count: Number of words
+  * @retval CRC
+  */
+static uint32_t TEST_Crc(const uint32_t *Data, uint32_t Count)
+{
+  uint32_t crc = 0xFFFFFFFFU, i, bit;
+
+  for (i = 0U; i < Count; i++)
+  {
+    crc ^= Data[i];
+    for (bit = 0U; bit < 32U; bit++)
+    {
+      crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+/* HAL ---------------------------------------------------------------------- */
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  return HAL_OK;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  return TEST_Crc(pBuffer, BufferLength);
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+  uint32_t address = pEraseInit->PageAddress;
+
+  if ((pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES) || ((address % FLASH_PAGE_SIZE) != 0U) ||
+      (address < USBD_DFU_APP_DEFAULT_ADD) ||
+      ((address + (pEraseInit->NbPages * FLASH_PAGE_SIZE)) > USBD_DFU_APP_END_ADD))
+  {
+    _exit(TEST_MISUSE);
+  }
+
+  /* The erase completes, the power fails before the programming */
+  memset(TEST_FLASH(address), 0, pEraseInit->NbPages * FLASH_PAGE_SIZE);
+  if (TEST_PowerFails() != 0U)
+  {
+    _exit(TEST_CUT);
+  }
+  TestStats->Erases++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_HalfPageProgram(uint32_t Address, uint32_t *pBuffer)
+{
+  uint32_t *flash = (uint32_t *)TEST_FLASH(Address);
+  uint32_t i, words = DFU_HALF_PAGE_SIZE / 4U;
+
+  if (((Address % DFU_HALF_PAGE_SIZE) != 0U) || (Address < USBD_DFU_APP_DEFAULT_ADD) ||
+      ((Address + DFU_HALF_PAGE_SIZE) > USBD_DFU_APP_END_ADD))
+  {
+    _exit(TEST_MISUSE);
+  }
+  for (i = 0U; i < words; i++)
+  {
+    if (flash[i] != 0U)
+    {
+      /* Programmed without an erase */
+      _exit(TEST_MISUSE);
+    }
+  }
+
+  if (TEST_PowerFails() != 0U)
+  {
+    memcpy(flash, pBuffer, DFU_HALF_PAGE_SIZE / 2U);
+    _exit(TEST_CUT);
+  }
+  memcpy(flash, pBuffer, DFU_HALF_PAGE_SIZE);
+  TestStats->Halves++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data)
+{
+  if ((TypeProgram != FLASH_TYPEPROGRAMDATA_WORD) || ((Address % 4U) != 0U) ||
+      (Address < FLASH_EEPROM_BASE) || (Address > (FLASH_EEPROM_END - 3U)))
+  {
+    _exit(TEST_MISUSE);
+  }
+
+  if (TEST_PowerFails() != 0U)
+  {
+    _exit(TEST_CUT);
+  }
+  *(uint32_t *)TEST_FLASH(Address) = Data;
+  TestStats->EepromWords++;
+  return HAL_OK;
+}
+
+/* Tests -------------------------------------------------------------------- */
+/**
+  * @brief  Downloads an image, as the DFU class does, in a child process.
+  * @param  Image: Plain or delta image
+  * @param  Size: Bytes
+  * @param  Budget: Flash operations before the power fails, or TEST_NO_CUT
+  * @retval TEST_DONE, TEST_REFUSED, TEST_CUT or TEST_MISUSE
+  */
+static int TEST_Download(const uint8_t *Image, uint32_t Size, uint32_t Budget)
+{
+  uint32_t offset, length;
+  uint16_t status = 0;
+  int child;
+  pid_t pid;
+
+  memset(TestStats, 0, sizeof(*TestStats));
+  TestStats->Budget = Budget;
+
+  pid = fork();
+  if (pid == 0)
+  {
+    Flash_If_Init();
+    for (offset = 0U; offset < Size; offset += USBD_DFU_XFER_SIZE)
+    {
+      length = ((Size - offset) < USBD_DFU_XFER_SIZE) ? (Size - offset) : USBD_DFU_XFER_SIZE;
+      status |= Flash_If_Write((uint8_t *)&Image[offset],
+                               TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD + offset), length);
+    }
+    status |= Flash_If_DeInit();
+    _exit((status == 0U) ? TEST_DONE : TEST_REFUSED);
+  }
+
+  if ((pid < 0) || (waitpid(pid, &child, 0) != pid) || !WIFEXITED(child))
+  {
+    return TEST_MISUSE;
+  }
+  return WEXITSTATUS(child);
+}
+
+/**
+  * @brief  Programs the application area and clears the data EEPROM.
+  * @param  Image: Application, NULL to erase
+  * @param  Size: Bytes
+  * @retval None
+  */
+static void TEST_Flash(const uint8_t *Image, uint32_t Size)
+{
+  memset(TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD), 0, USBD_DFU_APP_END_ADD - USBD_DFU_APP_DEFAULT_ADD);
+  memset(TEST_FLASH(FLASH_EEPROM_BASE), 0, FLASH_EEPROM_END + 1U - FLASH_EEPROM_BASE);
+  if (Image != NULL)
+  {
+    memcpy(TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD), Image, Size);
+  }
+}
+
+/**
+  * @brief  Whether the application area holds an image, and zeros after it.
+  * @param  Image: Application
+  * @param  Size: Bytes
+  * @retval 1 if so
+  */
+static uint32_t TEST_Holds(const uint8_t *Image, uint32_t Size)
+{
+  return ((memcmp(TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD), Image, Size) == 0) &&
+          (TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD)[Size] == 0U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Appends a delta operation, as Utilities/Delta/dfu_delta.py does.
+  * @param  Code: DFU_OP_DATA or 0 for a COPY
+  * @param  Data: Bytes of a DATA operation
+  * @param  Length: Bytes
+  * @retval None
+  */
+static void TEST_DeltaOp(uint8_t Code, const uint8_t *Data, uint32_t Length)
+{
+  uint32_t count;
+
+  while (Length != 0U)
+  {
+    count = (Length > 0xFFFFU) ? 0xFFFFU : Length;
+    if (count <= DFU_OP_LENGTH)
+    {
+      TestDelta[TestDeltaSize++] = Code | (uint8_t)count;
+    }
+    else
+    {
+      TestDelta[TestDeltaSize++] = Code;
+      TestDelta[TestDeltaSize++] = (uint8_t)count;
+      TestDelta[TestDeltaSize++] = (uint8_t)(count >> 8);
+    }
+    if (Code == DFU_OP_DATA)
+    {
+      memcpy(&TestDelta[TestDeltaSize], Data, count);
+      TestDeltaSize += count;
+      Data += count;
+    }
+    Length -= count;
+  }
+}
+
+/**
+  * @brief  Builds the base and target images, and the delta between them:
+  *         some pages keep most of their bytes, some change entirely, two
+  *         are added.
+  * @param  None
+  * @retval Pages the delta changes
+  */
+static uint32_t TEST_Images(void)
+{
+  DFU_DeltaHeaderTypeDef header;
+  uint32_t seed = 12345U, i, page, start, end, changed = 0U;
+
+  for (i = 0U; i < TEST_BASE_SIZE; i++)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    TestBase[i] = (uint8_t)((seed >> 16) | 1U);
+  }
+  memcpy(TestTarget, TestBase, TEST_BASE_SIZE);
+  for (i = TEST_BASE_SIZE; i < TEST_TARGET_SIZE; i++)
+  {
+    TestTarget[i] = (uint8_t)(i * 7U) | 1U;
+  }
+
+  for (page = 0U; page < (TEST_BASE_SIZE / FLASH_PAGE_SIZE); page++)
+  {
+    start = page * FLASH_PAGE_SIZE;
+    if ((page % 7U) == 5U)
+    {
+      for (i = start; i < (start + FLASH_PAGE_SIZE); i++)
+      {
+        TestTarget[i] ^= 0x5AU;
+      }
+    }
+    else if ((page % 3U) == 0U)
+    {
+      start += (page * 37U) % (FLASH_PAGE_SIZE - 64U);
+      for (i = start; i < (start + 24U); i++)
+      {
+        TestTarget[i] ^= 0xA5U;
+      }
+      TestTarget[start + 40U] ^= 0xFFU;
+    }
+    else
+    {
+      continue;
+    }
+    changed++;
+  }
+  changed += (TEST_TARGET_SIZE - TEST_BASE_SIZE) / FLASH_PAGE_SIZE;
+
+  header.Magic      = DFU_DELTA_MAGIC;
+  header.Address    = USBD_DFU_APP_DEFAULT_ADD;
+  header.BaseSize   = TEST_BASE_SIZE;
+  header.BaseCrc    = TEST_Crc((const uint32_t *)TestBase, TEST_BASE_SIZE / 4U);
+  header.TargetSize = TEST_TARGET_SIZE;
+  header.TargetCrc  = TEST_Crc((const uint32_t *)TestTarget, TEST_TARGET_SIZE / 4U);
+  memcpy(TestDelta, &header, sizeof(header));
+  TestDeltaSize = sizeof(header);
+
+  /* COPY the runs of 3 bytes or more kept from the base, DATA the others */
+  for (start = 0U; start < TEST_TARGET_SIZE; start = end)
+  {
+    end = start;
+    while ((end < TEST_BASE_SIZE) && (TestBase[end] == TestTarget[end]))
+    {
+      end++;
+    }
+    if ((end - start) >= 3U)
+    {
+      TEST_DeltaOp(0U, NULL, end - start);
+      continue;
+    }
+    end = start + 1U;
+    while ((end < TEST_TARGET_SIZE) &&
+           !((end + 2U < TEST_BASE_SIZE) && (TestBase[end] == TestTarget[end]) &&
+             (TestBase[end + 1U] == TestTarget[end + 1U]) && (TestBase[end + 2U] == TestTarget[end + 2U])))
+    {
+      end++;
+    }
+    TEST_DeltaOp(DFU_OP_DATA, &TestTarget[start], end - start);
+  }
+
+  return changed;
+}
+
+/**
+  * @brief  Plain images: written as they are, unchanged pages left alone.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Plain(void)
+{
+  TEST_Flash(NULL, 0U);
+  HOST_CHECK(TEST_Download(TestBase, TEST_BASE_SIZE, TEST_NO_CUT) == TEST_DONE);
+  HOST_CHECK(TEST_Holds(TestBase, TEST_BASE_SIZE) == 1U);
+  HOST_CHECK(TestStats->Erases == (TEST_BASE_SIZE / FLASH_PAGE_SIZE));
+  HOST_CHECK(TestStats->Halves == (2U * TestStats->Erases));
+
+  HOST_CHECK(TEST_Download(TestBase, TEST_BASE_SIZE, TEST_NO_CUT) == TEST_DONE);
+  HOST_CHECK(TestStats->Erases == 0U);
+  HOST_CHECK(Flash_If_UpdatePending() == 0U);
+}
+
+/**
+  * @brief  A delta without power failure: only the changed pages are
+  *         written, a delta for another image is refused.
+  * @param  Changed: Pages the delta changes
+  * @retval Flash operations of the delta
+  */
+static uint32_t TEST_Delta(uint32_t Changed)
+{
+  uint32_t ops;
+
+  TEST_Flash(TestBase, TEST_BASE_SIZE);
+  HOST_CHECK(TEST_Download(TestDelta, TestDeltaSize, TEST_NO_CUT) == TEST_DONE);
+  HOST_CHECK(TEST_Holds(TestTarget, TEST_TARGET_SIZE) == 1U);
+  HOST_CHECK(TestStats->Erases == Changed);
+  HOST_CHECK(Flash_If_UpdatePending() == 0U);
+  ops = TestStats->Ops;
+
+  /* Again over the target: nothing to write */
+  HOST_CHECK(TEST_Download(TestDelta, TestDeltaSize, TEST_NO_CUT) == TEST_DONE);
+  HOST_CHECK(TestStats->Erases == 0U);
+
+  TEST_Flash(TestBase, TEST_BASE_SIZE);
+  TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD)[100] ^= 1U;
+  HOST_CHECK(TEST_Download(TestDelta, TestDeltaSize, TEST_NO_CUT) == TEST_REFUSED);
+  HOST_CHECK(TestStats->Erases == 0U);
+  HOST_CHECK(Flash_If_UpdatePending() == 0U);
+
+  return ops;
+}
+
+/**
+  * @brief  Whether a page of the application is neither the base nor the
+  *         target one.
+  * @param  None
+  * @retval 1 if a page is torn
+  */
+static uint32_t TEST_Torn(void)
+{
+  uint32_t offset;
+  const uint8_t *flash;
+
+  for (offset = 0U; offset < TEST_BASE_SIZE; offset += FLASH_PAGE_SIZE)
+  {
+    flash = TEST_FLASH(USBD_DFU_APP_DEFAULT_ADD + offset);
+    if ((memcmp(flash, &TestBase[offset], FLASH_PAGE_SIZE) != 0) &&
+        (memcmp(flash, &TestTarget[offset], FLASH_PAGE_SIZE) != 0))
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  A power failure at each flash operation of the delta, then the
+  *         same delta again; a second failure early in the resume of each
+  *         torn page.
+  * @param  Ops: Flash operations of the delta
+  * @retval None
+  */
+static void TEST_PowerCut(uint32_t Ops)
+{
+  uint32_t cut, second, torn = 0U, failed = 0U, status;
+
+  for (cut = 0U; cut < Ops; cut++)
+  {
+    TEST_Flash(TestBase, TEST_BASE_SIZE);
+    status = (TEST_Download(TestDelta, TestDeltaSize, cut) == TEST_CUT) ? 1U : 0U;
+    if (TEST_Torn() == 0U)
+    {
+      status &= (TEST_Download(TestDelta, TestDeltaSize, TEST_NO_CUT) == TEST_DONE) ? 1U : 0U;
+    }
+    else
+    {
+      torn++;
+      memcpy(TestSnapshot, TEST_FLASH(FLASH_BASE), TEST_MAP_SIZE);
+      for (second = 0U; second <= TEST_SECOND_CUTS; second++)
+      {
+        memcpy(TEST_FLASH(FLASH_BASE), TestSnapshot, TEST_MAP_SIZE);
+        if (second < TEST_SECOND_CUTS)
+        {
+          status &= (TEST_Download(TestDelta, TestDeltaSize, second) == TEST_CUT) ? 1U : 0U;
+        }
+        status &= (TEST_Download(TestDelta, TestDeltaSize, TEST_NO_CUT) == TEST_DONE) ? 1U : 0U;
+        status &= TEST_Holds(TestTarget, TEST_TARGET_SIZE);
+      }
+    }
+    status &= TEST_Holds(TestTarget, TEST_TARGET_SIZE);
+    status &= (Flash_If_UpdatePending() == 0U) ? 1U : 0U;
+
+    if (status == 0U)
+    {
+      if (failed == 0U)
+      {
+        printf("FAIL dfu_test: power failure at operation %lu of %lu not recovered\n",
+               (unsigned long)cut, (unsigned long)Ops);
+      }
+      failed++;
+    }
+  }
+  HOST_CHECK(failed == 0U);
+  HOST_CHECK(torn != 0U);
+
+  printf("dfu_test: %lu power failures, %lu with a torn page, %lu not recovered\n",
+         (unsigned long)Ops, (unsigned long)torn, (unsigned long)failed);
+}
+
+int main(void)
+{
+  uint32_t changed, ops;
+
+  if ((mmap(TEST_FLASH(FLASH_BASE), TEST_MAP_SIZE, PROT_READ | PROT_WRITE,
+            MAP_FIXED | MAP_SHARED | MAP_ANONYMOUS, -1, 0) == MAP_FAILED) ||
+      ((TestStats = mmap(NULL, sizeof(*TestStats), PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED))
+  {
+    printf("FAIL dfu_test: cannot map the flash at 0x%08lX\n", (unsigned long)FLASH_BASE);
+    return 1;
+  }
+
+  changed = TEST_Images();
+  TEST_Plain();
+  ops = TEST_Delta(changed);
+  TEST_PowerCut(ops);
+  return HOST_Report("dfu_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
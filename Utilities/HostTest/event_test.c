@@ -0,0 +1,367 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/event_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the event rings of Application/Src/event.c.
+  *
+  *          The edges are checked first, single threaded: empty, full, the
+  *          drop counter, the wrap of the free running indexes and the
+  *          dispatch order of the sources. Then one thread per source posts
+  *          with EVT_Post() while the main thread drains with EVT_Dispatch():
+  *          every event is either dispatched, in order and intact, or counted
+  *          as dropped.
+  *
+  *          The worst EVT_Post() and post to dispatch times are printed: they
+  *          are host times, the target figures are PROF_ISR_RTC_WKUP and
+  *          PROF_EVT_DISPATCH of profile.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <sched.h>
+#include "host_hal.h"
+#include "event.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Producer thread of one source
+  */
+typedef struct
+{
+  EVT_SourceTypeDef Source;
+  pthread_t         Thread;
+  uint32_t          Dropped;      /*!< HAL_BUSY returns                  */
+  uint64_t          DroppedSum;   /*!< Sum of the sequences dropped      */
+  uint64_t          PostMaxNs;    /*!< Worst EVT_Post() call             */
+} TEST_ProducerTypeDef;
+
+/**
+  * @brief  What the handlers saw of one source
+  */
+typedef struct
+{
+  uint32_t Received;
+  uint32_t Next;                  /*!< Lowest sequence still expected    */
+  uint64_t ReceivedSum;
+  uint32_t Disorder;              /*!< Sequence at or below one seen     */
+  uint32_t Torn;                  /*!< Parameter of another source       */
+} TEST_SinkTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_EVENTS        200000U       /* Events per producer           */
+#define TEST_SRC_SHIFT     24U           /* Param: source, then sequence  */
+#define TEST_SEQ_MASK      0x00FFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Event posted by each source in the stress test */
+static const EVT_IdTypeDef TestIdOfSource[EVT_SRC_COUNT] =
+{
+  EVT_RTC_WAKEUP, EVT_COUNTDOWN_EXPIRED, EVT_BATTERY_LOW, EVT_BUTTON_EDGE, EVT_LIGHT
+};
+
+static TEST_ProducerTypeDef TestProducers[EVT_SRC_COUNT];
+static TEST_SinkTypeDef     TestSinks[EVT_SRC_COUNT];
+static uint64_t            *TestStamps[EVT_SRC_COUNT];
+static uint64_t             TestLatencyMaxNs;
+static volatile uint32_t    TestRunning;
+
+/* Single threaded checks: handler calls in order */
+static uint32_t TestLog[64];
+static uint32_t TestLogCount;
+
+static uint32_t TestStops;
+static uint32_t TestSleeps;
+
+/* Private function prototypes -----------------------------------------------*/
+static void  TEST_LogHandler(uint32_t Param);
+static void  TEST_SinkHandler(uint32_t Param);
+static void  TEST_Edges(void);
+static void  TEST_Stress(void);
+static void *TEST_Producer(void *Argument);
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Stand-ins of the modules event.c calls */
+void PROF_Record(PROF_IdTypeDef Id, uint32_t StartCycles) { (void)Id; (void)StartCycles; }
+void RTC_BackupWrite(uint32_t reg, uint32_t data) { (void)reg; (void)data; }
+void WDG_Idle(void) { }
+void SystemCoreClockUpdate(void) { }
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry) { (void)Regulator; (void)STOPEntry; TestStops++; }
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry) { (void)Regulator; (void)SLEEPEntry; TestSleeps++; }
+
+/**
+  * @brief  Handler of the single threaded checks: log the parameter.
+  */
+static void TEST_LogHandler(uint32_t Param)
+{
+  if (TestLogCount < (sizeof(TestLog) / sizeof(TestLog[0])))
+  {
+    TestLog[TestLogCount] = Param;
+  }
+  TestLogCount++;
+}
+
+/**
+  * @brief  Handler of the stress test: check the order and the parameter.
+  */
+static void TEST_SinkHandler(uint32_t Param)
+{
+  uint32_t src = Param >> TEST_SRC_SHIFT;
+  uint32_t seq = Param & TEST_SEQ_MASK;
+  uint64_t latency;
+  TEST_SinkTypeDef *sink;
+
+  if (src >= EVT_SRC_COUNT)
+  {
+    TestSinks[0].Torn++;
+    return;
+  }
+  sink = &TestSinks[src];
+
+  if (seq < sink->Next)
+  {
+    sink->Disorder++;
+  }
+  sink->Next = seq + 1U;
+  sink->Received++;
+  sink->ReceivedSum += seq;
+
+  latency = HOST_Nanoseconds() - TestStamps[src][seq];
+  if (latency > TestLatencyMaxNs)
+  {
+    TestLatencyMaxNs = latency;
+  }
+}
+
+/**
+  * @brief  Empty, full, wrap and order, single threaded.
+  */
+static void TEST_Edges(void)
+{
+  uint32_t i;
+
+  EVT_Init();
+  for (i = 0U; i < EVT_ID_COUNT; i++)
+  {
+    EVT_Register((EVT_IdTypeDef)i, TEST_LogHandler);
+  }
+
+  /* Empty: nothing to run, STOP mode */
+  HOST_CHECK(EVT_Dispatch() == 0U);
+  TestStops = 0U;
+  EVT_Idle();
+  HOST_CHECK(TestStops == 1U);
+  HOST_CHECK(HostPrimask == 0U);
+
+  /* Full: EVT_QUEUE_SIZE events fit, the next one is dropped and counted */
+  for (i = 0U; i < EVT_QUEUE_SIZE; i++)
+  {
+    HOST_CHECK(EVT_Post(EVT_SRC_BUTTON, EVT_BUTTON_EDGE, 100U + i) == HAL_OK);
+  }
+  HOST_CHECK(EVT_Post(EVT_SRC_BUTTON, EVT_BUTTON_EDGE, 999U) == HAL_BUSY);
+  HOST_CHECK(EVT_GetDropped(EVT_SRC_BUTTON) == 1U);
+  HOST_CHECK(EVT_GetDropped(EVT_SRC_RTC) == 0U);
+
+  /* Pending: no STOP mode */
+  TestStops = 0U;
+  EVT_Idle();
+  HOST_CHECK(TestStops == 0U);
+
+  TestLogCount = 0U;
+  HOST_CHECK(EVT_Dispatch() == EVT_QUEUE_SIZE);
+  for (i = 0U; i < EVT_QUEUE_SIZE; i++)
+  {
+    HOST_CHECK(TestLog[i] == (100U + i));
+  }
+  HOST_CHECK(EVT_Dispatch() == 0U);
+
+  /* A freed slot takes a new event at once */
+  HOST_CHECK(EVT_Post(EVT_SRC_BUTTON, EVT_BUTTON_EDGE, 1U) == HAL_OK);
+  HOST_CHECK(EVT_Dispatch() == 1U);
+
+  /* The free running indexes wrap around 2^32 */
+  EvtQueues[EVT_SRC_PVD].Head = 0xFFFFFFFDU;
+  EvtQueues[EVT_SRC_PVD].Tail = 0xFFFFFFFDU;
+  for (i = 0U; i < EVT_QUEUE_SIZE; i++)
+  {
+    HOST_CHECK(EVT_Post(EVT_SRC_PVD, EVT_BATTERY_LOW, 200U + i) == HAL_OK);
+  }
+  HOST_CHECK(EVT_Post(EVT_SRC_PVD, EVT_BATTERY_LOW, 999U) == HAL_BUSY);
+  TestLogCount = 0U;
+  HOST_CHECK(EVT_Dispatch() == EVT_QUEUE_SIZE);
+  for (i = 0U; i < EVT_QUEUE_SIZE; i++)
+  {
+    HOST_CHECK(TestLog[i] == (200U + i));
+  }
+  HOST_CHECK(EvtQueues[EVT_SRC_PVD].Tail == (EVT_QUEUE_SIZE - 3U));
+
+  /* Sources in priority order, each in posting order */
+  EVT_Post(EVT_SRC_COMP, EVT_LIGHT, 5U);
+  EVT_Post(EVT_SRC_PVD, EVT_BATTERY_LOW, 3U);
+  EVT_Post(EVT_SRC_RTC, EVT_RTC_WAKEUP, 1U);
+  EVT_Post(EVT_SRC_BUTTON, EVT_BUTTON_EDGE, 4U);
+  EVT_Post(EVT_SRC_RTC, EVT_BUTTON_TICK, 2U);
+  TestLogCount = 0U;
+  HOST_CHECK(EVT_Dispatch() == 5U);
+  for (i = 0U; i < 5U; i++)
+  {
+    HOST_CHECK(TestLog[i] == (i + 1U));
+  }
+
+  /* No handler: the event is consumed, nothing runs */
+  EVT_Register(EVT_TOUCH_TICK, NULL);
+  EVT_Post(EVT_SRC_RTC, EVT_TOUCH_TICK, 7U);
+  TestLogCount = 0U;
+  HOST_CHECK(EVT_Dispatch() == 1U);
+  HOST_CHECK(TestLogCount == 0U);
+
+  /* SLEEP mode only while a peripheral needs its clock */
+  TestStops = 0U;
+  TestSleeps = 0U;
+  EVT_InhibitStop(EVT_STOP_CHIME, ENABLE);
+  EVT_Idle();
+  EVT_InhibitStop(EVT_STOP_CHIME, DISABLE);
+  EVT_Idle();
+  HOST_CHECK((TestSleeps == 1U) && (TestStops == 1U));
+}
+
+/**
+  * @brief  Producer thread: an interrupt posting as fast as it can, pausing
+  *         now and then so that the rings also run empty.
+  */
+static void *TEST_Producer(void *Argument)
+{
+  TEST_ProducerTypeDef *p = (TEST_ProducerTypeDef *)Argument;
+  uint32_t seq, param, burst = 0U;
+  unsigned int seed = (unsigned int)p->Source + 1U;
+  uint64_t start, spent;
+
+  while (TestRunning == 0U)
+  {
+  }
+
+  for (seq = 0U; seq < TEST_EVENTS; seq++)
+  {
+    param = ((uint32_t)p->Source << TEST_SRC_SHIFT) | seq;
+    start = HOST_Nanoseconds();
+    TestStamps[p->Source][seq] = start;
+    if (EVT_Post(p->Source, TestIdOfSource[p->Source], param) != HAL_OK)
+    {
+      p->Dropped++;
+      p->DroppedSum += seq;
+    }
+    spent = HOST_Nanoseconds() - start;
+    if (spent > p->PostMaxNs)
+    {
+      p->PostMaxNs = spent;
+    }
+
+    /* Bursts of 1 to 2 x EVT_QUEUE_SIZE events: the ring fills up or
+       runs empty depending on the other threads */
+    if (burst == 0U)
+    {
+      burst = ((uint32_t)rand_r(&seed) % (2U * EVT_QUEUE_SIZE)) + 1U;
+      sched_yield();
+    }
+    burst--;
+  }
+  return NULL;
+}
+
+/**
+  * @brief  One producer thread per source, the main thread dispatching.
+  */
+static void TEST_Stress(void)
+{
+  uint64_t expected_sum = ((uint64_t)TEST_EVENTS * (TEST_EVENTS - 1U)) / 2U;
+  uint64_t post_max_ns = 0U;
+  uint32_t src, dropped = 0U, received = 0U, empty = 0U;
+
+  EVT_Init();
+  memset(TestSinks, 0, sizeof(TestSinks));
+  for (src = 0U; src < EVT_SRC_COUNT; src++)
+  {
+    EVT_Register(TestIdOfSource[src], TEST_SinkHandler);
+    TestStamps[src] = calloc(TEST_EVENTS, sizeof(uint64_t));
+    TestProducers[src].Source = (EVT_SourceTypeDef)src;
+    pthread_create(&TestProducers[src].Thread, NULL, TEST_Producer, &TestProducers[src]);
+  }
+
+  TestRunning = 1U;
+  while (received + dropped < (TEST_EVENTS * EVT_SRC_COUNT))
+  {
+    if (EVT_Dispatch() == 0U)
+    {
+      empty++;
+      sched_yield();
+    }
+    received = 0U;
+    dropped = 0U;
+    for (src = 0U; src < EVT_SRC_COUNT; src++)
+    {
+      received += TestSinks[src].Received;
+      dropped += EVT_GetDropped((EVT_SourceTypeDef)src);
+    }
+  }
+
+  for (src = 0U; src < EVT_SRC_COUNT; src++)
+  {
+    pthread_join(TestProducers[src].Thread, NULL);
+  }
+  HOST_CHECK(EVT_Dispatch() == 0U);
+
+  received = 0U;
+  dropped = 0U;
+  for (src = 0U; src < EVT_SRC_COUNT; src++)
+  {
+    TEST_ProducerTypeDef *p = &TestProducers[src];
+    TEST_SinkTypeDef *sink = &TestSinks[src];
+
+    HOST_CHECK(EVT_GetDropped((EVT_SourceTypeDef)src) == p->Dropped);
+    HOST_CHECK((sink->Received + p->Dropped) == TEST_EVENTS);
+    HOST_CHECK((sink->ReceivedSum + p->DroppedSum) == expected_sum);
+    HOST_CHECK(sink->Disorder == 0U);
+    HOST_CHECK(sink->Torn == 0U);
+    received += sink->Received;
+    dropped += p->Dropped;
+    if (p->PostMaxNs > post_max_ns)
+    {
+      post_max_ns = p->PostMaxNs;
+    }
+    free(TestStamps[src]);
+  }
+
+  /* Both edges were reached under load */
+  HOST_CHECK((dropped > 0U) && (empty > 0U));
+  HOST_CHECK(received > (TEST_EVENTS * EVT_SRC_COUNT / 2U));
+
+  printf("event_test: %lu events dispatched, %lu dropped on full rings, %lu empty dispatches\n",
+         (unsigned long)received, (unsigned long)dropped, (unsigned long)empty);
+  printf("event_test: worst EVT_Post() %lu ns, worst post to dispatch %lu ns (host)\n",
+         (unsigned long)post_max_ns, (unsigned long)TestLatencyMaxNs);
+}
+
+/**
+  * @brief  Main program.
+  */
+int main(void)
+{
+  TEST_Edges();
+  TEST_Stress();
+  return HOST_Report("event_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,357 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/flash_bulk_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of FLASHBULK_Write(), flash_bulk.c of the
+  *          STM32L152D-EVAL FLASH_EraseProgram example.
+  *
+  *          The program memory is mapped at its address and behaves as the
+  *          STM32L1 one: a page erase clears 256 bytes, a half page write
+  *          programs 32 erased words. Checked against memcpy() on a copy:
+  *          unaligned heads and tails, a single byte, writes crossing
+  *          pages, the pages holding the data already left alone, the
+  *          source in flash, and the failed erase and CRC check paths.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+#include <sys/mman.h>
+
+#include "flash_bulk.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Area written by the test, away from the example code */
+#define TEST_AREA               0x08010000U
+#define TEST_AREA_SIZE          (16U * FLASH_PAGE_SIZE)
+#define TEST_MAP_SIZE           (TEST_AREA + TEST_AREA_SIZE - FLASH_BASE)
+
+/* Writes at random places */
+#define TEST_RANDOM_RUNS        500U
+
+/* Private macro -------------------------------------------------------------*/
+#define TEST_FLASH(address)     ((uint8_t *)(uintptr_t)(address))
+
+/* Private variables ---------------------------------------------------------*/
+/* What the area must hold */
+static uint8_t  TestModel[TEST_AREA_SIZE];
+static uint8_t  TestData[TEST_AREA_SIZE];
+
+static uint32_t TestErases;
+static uint32_t TestHalves;
+static uint32_t TestFailErase;
+static uint32_t TestCorruptHalf;
+static uint32_t TestSeed = 1U;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/* HAL ---------------------------------------------------------------------- */
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  return HAL_OK;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  uint32_t crc = 0xFFFFFFFFU, i, bit;
+
+  for (i = 0U; i < BufferLength; i++)
+  {
+    crc ^= pBuffer[i];
+    for (bit = 0U; bit < 32U; bit++)
+    {
+      crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+  HOST_CHECK(pEraseInit->TypeErase == FLASH_TYPEERASE_PAGES);
+  HOST_CHECK((pEraseInit->PageAddress % FLASH_PAGE_SIZE) == 0U);
+  HOST_CHECK(pEraseInit->PageAddress >= TEST_AREA);
+  HOST_CHECK((pEraseInit->PageAddress + (pEraseInit->NbPages * FLASH_PAGE_SIZE)) <= (TEST_AREA + TEST_AREA_SIZE));
+
+  if (TestFailErase != 0U)
+  {
+    *PageError = pEraseInit->PageAddress;
+    return HAL_ERROR;
+  }
+  memset(TEST_FLASH(pEraseInit->PageAddress), 0, pEraseInit->NbPages * FLASH_PAGE_SIZE);
+  TestErases += pEraseInit->NbPages;
+  *PageError = 0xFFFFFFFFU;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_HalfPageProgram(uint32_t Address, uint32_t *pBuffer)
+{
+  uint32_t *flash = (uint32_t *)TEST_FLASH(Address);
+  uint32_t i;
+
+  HOST_CHECK((Address % FLASHBULK_HALF_PAGE_SIZE) == 0U);
+  HOST_CHECK(((uintptr_t)pBuffer % 4U) == 0U);
+  for (i = 0U; i < (FLASHBULK_HALF_PAGE_SIZE / 4U); i++)
+  {
+    /* Programmed without an erase */
+    HOST_CHECK(flash[i] == 0U);
+  }
+
+  memcpy(flash, pBuffer, FLASHBULK_HALF_PAGE_SIZE);
+  if (TestCorruptHalf != 0U)
+  {
+    /* A word that did not program */
+    flash[5] ^= 0x00010000U;
+  }
+  TestHalves++;
+  return HAL_OK;
+}
+
+/* Tests -------------------------------------------------------------------- */
+/**
+  * @brief  Pseudo random number.
+  * @param  Range: Upper bound, excluded
+  * @retval 0 to Range - 1
+  */
+static uint32_t TEST_Random(uint32_t Range)
+{
+  TestSeed = (TestSeed * 1103515245U) + 12345U;
+  return (TestSeed >> 8) % Range;
+}
+
+/**
+  * @brief  Fills the area with a pattern, on the flash and the model.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Fill(void)
+{
+  uint32_t i;
+
+  for (i = 0U; i < TEST_AREA_SIZE; i++)
+  {
+    TestModel[i] = (uint8_t)((i * 13U) + 1U);
+  }
+  memcpy(TEST_FLASH(TEST_AREA), TestModel, TEST_AREA_SIZE);
+  FLASHBULK_Init();
+  TestErases = TestHalves = 0U;
+}
+
+/**
+  * @brief  Writes through FLASHBULK_Write() and memcpy() on the model.
+  * @param  Offset: In the area
+  * @param  Data: Source
+  * @param  Size: Bytes
+  * @retval Status of FLASHBULK_Write()
+  */
+static HAL_StatusTypeDef TEST_Write(uint32_t Offset, const uint8_t *Data, uint32_t Size)
+{
+  memmove(&TestModel[Offset], Data, Size);
+  return FLASHBULK_Write(TEST_AREA + Offset, Data, Size);
+}
+
+/**
+  * @brief  Whether the area holds the model.
+  * @param  None
+  * @retval 1 if so
+  */
+static uint32_t TEST_Matches(void)
+{
+  return (memcmp(TEST_FLASH(TEST_AREA), TestModel, TEST_AREA_SIZE) == 0) ? 1U : 0U;
+}
+
+/**
+  * @brief  Writes within a page, and across pages: the bytes around are
+  *         kept, only the heads and tails are merged.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Unaligned(void)
+{
+  FLASHBULK_StatsTypeDef stats;
+
+  /* A single byte, at an odd address */
+  TEST_Fill();
+  HOST_CHECK(TEST_Write(FLASH_PAGE_SIZE + 77U, TestData, 1U) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK(TEST_Matches() == 1U);
+  HOST_CHECK((stats.Pages == 1U) && (stats.Merged == 1U) && (stats.Skipped == 0U));
+  HOST_CHECK((TestErases == 1U) && (TestHalves == 2U));
+
+  /* Head and tail in two pages */
+  TEST_Fill();
+  HOST_CHECK(TEST_Write((2U * FLASH_PAGE_SIZE) + 17U, TestData, 300U) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK(TEST_Matches() == 1U);
+  HOST_CHECK((stats.Pages == 2U) && (stats.Merged == 2U));
+
+  /* Head, two whole pages and tail, from an odd source address */
+  TEST_Fill();
+  HOST_CHECK(TEST_Write((4U * FLASH_PAGE_SIZE) + 200U, &TestData[3], 600U) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK(TEST_Matches() == 1U);
+  HOST_CHECK((stats.Pages == 4U) && (stats.Merged == 2U) && (TestErases == 4U));
+
+  /* Whole pages: nothing read back */
+  TEST_Fill();
+  HOST_CHECK(TEST_Write(8U * FLASH_PAGE_SIZE, TestData, 3U * FLASH_PAGE_SIZE) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK(TEST_Matches() == 1U);
+  HOST_CHECK((stats.Pages == 3U) && (stats.Merged == 0U));
+
+  /* Nothing to write */
+  HOST_CHECK(TEST_Write(100U, TestData, 0U) == HAL_OK);
+  HOST_CHECK(TEST_Matches() == 1U);
+}
+
+/**
+  * @brief  The pages already holding the data are not erased.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Unchanged(void)
+{
+  FLASHBULK_StatsTypeDef stats;
+
+  TEST_Fill();
+  HOST_CHECK(TEST_Write(FLASH_PAGE_SIZE + 200U, TestData, 600U) == HAL_OK);
+  TestErases = 0U;
+
+  /* The same bytes again */
+  FLASHBULK_Init();
+  HOST_CHECK(TEST_Write(FLASH_PAGE_SIZE + 200U, TestData, 600U) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK((stats.Skipped == 4U) && (stats.Pages == 0U) && (TestErases == 0U));
+
+  /* One byte changed: one page written */
+  FLASHBULK_Init();
+  TestData[300] ^= 0xFFU;
+  HOST_CHECK(TEST_Write(FLASH_PAGE_SIZE + 200U, TestData, 600U) == HAL_OK);
+  TestData[300] ^= 0xFFU;
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK((stats.Skipped == 3U) && (stats.Pages == 1U) && (TestErases == 1U));
+  HOST_CHECK(TEST_Matches() == 1U);
+
+  /* Bytes equal to the flash: nothing written */
+  FLASHBULK_Init();
+  HOST_CHECK(TEST_Write(5U, TEST_FLASH(TEST_AREA + 5U), 700U) == HAL_OK);
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK((stats.Pages == 0U) && (stats.Skipped == 3U));
+}
+
+/**
+  * @brief  The source in flash, overlapping the destination.
+  * @param  None
+  * @retval None
+  */
+static void TEST_FlashSource(void)
+{
+  TEST_Fill();
+  HOST_CHECK(TEST_Write(3U * FLASH_PAGE_SIZE, TEST_FLASH(TEST_AREA + (3U * FLASH_PAGE_SIZE) + 10U),
+                        FLASH_PAGE_SIZE) == HAL_OK);
+  HOST_CHECK(TEST_Matches() == 1U);
+
+  /* Within one page, the whole source is read before the erase */
+  HOST_CHECK(TEST_Write(7U * FLASH_PAGE_SIZE + 10U, TEST_FLASH(TEST_AREA + (7U * FLASH_PAGE_SIZE)),
+                        100U) == HAL_OK);
+  HOST_CHECK(TEST_Matches() == 1U);
+}
+
+/**
+  * @brief  A failed erase or a page that does not match its CRC stops the
+  *         write with HAL_ERROR, the next pages untouched.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Failures(void)
+{
+  FLASHBULK_StatsTypeDef stats;
+
+  TEST_Fill();
+  TestCorruptHalf = 1U;
+  HOST_CHECK(FLASHBULK_Write(TEST_AREA + 100U, TestData, 3U * FLASH_PAGE_SIZE) == HAL_ERROR);
+  TestCorruptHalf = 0U;
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK((stats.Pages == 0U) && (TestErases == 1U));
+  HOST_CHECK(memcmp(TEST_FLASH(TEST_AREA + FLASH_PAGE_SIZE), &TestModel[FLASH_PAGE_SIZE],
+                    TEST_AREA_SIZE - FLASH_PAGE_SIZE) == 0);
+
+  TEST_Fill();
+  TestFailErase = 1U;
+  HOST_CHECK(FLASHBULK_Write(TEST_AREA + 100U, TestData, 3U * FLASH_PAGE_SIZE) == HAL_ERROR);
+  TestFailErase = 0U;
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK((stats.Pages == 0U) && (TestHalves == 0U));
+  HOST_CHECK(TEST_Matches() == 1U);
+
+  /* Written again once the flash behaves */
+  HOST_CHECK(TEST_Write(100U, TestData, 3U * FLASH_PAGE_SIZE) == HAL_OK);
+  HOST_CHECK(TEST_Matches() == 1U);
+}
+
+/**
+  * @brief  Writes of random sizes at random places, against memcpy().
+  * @param  None
+  * @retval None
+  */
+static void TEST_RandomWrites(void)
+{
+  FLASHBULK_StatsTypeDef stats;
+  uint32_t run, offset, size, failed = 0U;
+
+  TEST_Fill();
+  for (run = 0U; run < TEST_RANDOM_RUNS; run++)
+  {
+    offset = TEST_Random(TEST_AREA_SIZE);
+    size = TEST_Random(((run % 4U) == 0U) ? (TEST_AREA_SIZE - offset + 1U) : 40U);
+    if ((size > (TEST_AREA_SIZE - offset)) || (TEST_Write(offset, &TestData[TEST_Random(64U)], size) != HAL_OK) ||
+        (TEST_Matches() == 0U))
+    {
+      failed++;
+    }
+  }
+  FLASHBULK_GetStats(&stats);
+  HOST_CHECK(failed == 0U);
+
+  printf("flash_bulk_test: %lu random writes, %lu pages written, %lu skipped, %lu merged\n",
+         (unsigned long)TEST_RANDOM_RUNS, (unsigned long)stats.Pages, (unsigned long)stats.Skipped,
+         (unsigned long)stats.Merged);
+}
+
+int main(void)
+{
+  uint32_t i;
+
+  if (mmap(TEST_FLASH(FLASH_BASE), TEST_MAP_SIZE, PROT_READ | PROT_WRITE,
+           MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) == MAP_FAILED)
+  {
+    printf("FAIL flash_bulk_test: cannot map the flash at 0x%08lX\n", (unsigned long)FLASH_BASE);
+    return 1;
+  }
+  for (i = 0U; i < TEST_AREA_SIZE; i++)
+  {
+    TestData[i] = (uint8_t)TEST_Random(256U);
+  }
+
+  TEST_Unaligned();
+  TEST_Unchanged();
+  TEST_FlashSource();
+  TEST_Failures();
+  TEST_RandomWrites();
+  return HOST_Report("flash_bulk_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
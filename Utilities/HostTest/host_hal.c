@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/host_hal.c
+  * @author  MCD Application Team
+  * @brief   Host stand-ins shared by the host tests: core peripherals, check
+  *          reporting and the weak defaults of the hooks a test may replace.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <time.h>
+#include "host_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+__IO uint32_t HostPrimask;
+DWT_Type      HostDwt;
+SCB_Type      HostScb;
+SysTick_Type  HostSysTick;
+RCC_TypeDef   HostRcc;
+uint32_t      HostFailed;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Report a check.
+  * @param  Passed: Non zero if the check passed
+  * @param  Text: Condition checked
+  * @param  File: Source file of the check
+  * @param  Line: Source line of the check
+  * @retval None
+  */
+void HOST_Check(int Passed, const char *Text, const char *File, int Line)
+{
+  if (Passed == 0)
+  {
+    printf("FAIL %s:%d: %s\n", File, Line, Text);
+    HostFailed++;
+  }
+}
+
+/**
+  * @brief  Print the result of a test.
+  * @param  Name: Test name
+  * @retval Exit status of the test, 0 if every check passed
+  */
+int HOST_Report(const char *Name)
+{
+  printf("%s: %s\n", Name, (HostFailed == 0U) ? "PASS" : "FAIL");
+  return (HostFailed == 0U) ? 0 : 1;
+}
+
+/**
+  * @brief  WFI and WFE: return at once, as with an interrupt pending.
+  * @note   Weak: a test simulating a peripheral advances it here.
+  * @param  None
+  * @retval None
+  */
+__weak void HOST_Wfi(void)
+{
+}
+
+/**
+  * @brief  NVIC_SystemReset().
+  * @note   Weak: a test simulating a power cycle replaces it.
+  * @param  None
+  * @retval None
+  */
+__weak void HOST_Reset(void)
+{
+  printf("FAIL unexpected system reset\n");
+  exit(2);
+}
+
+/**
+  * @brief  Host monotonic clock, for the timings reported by the tests.
+  * @param  None
+  * @retval Nanoseconds
+  */
+uint64_t HOST_Nanoseconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,628 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/rtos_tick_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the FreeRTOS tick and tickless idle of
+  *          Application/Src/rtos_tick.c.
+  *
+  *          The kernel is a stand-in (Inc/FreeRTOS.h, Inc/task.h): a tick
+  *          count, the tick a task is blocked until, and the scheduler
+  *          state. xTaskIncrementTick() pends the ticks while the scheduler
+  *          is suspended, and vTaskStepTick() asserts as the kernel does
+  *          that it never steps beyond the tick due. The RTC is simulated
+  *          in time stamps: the wake-up timer fires a period after it was
+  *          programmed, EVT_Sleep() runs the time up to it or to an earlier
+  *          interrupt, and the wake-up callback runs RTOS_TickHandler() if
+  *          its event was not cleared.
+  *
+  *          Checked: the stretch is capped at the next second, one tick
+  *          sleeps while RTC_WakeUpFast() is set, the tick step after an
+  *          early wake-up, the task due running on wake-up, the midnight
+  *          wrap, a calendar change, and ten random minutes across
+  *          midnight in which the tick count never drifts from the stamps.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+#include "rtos_tick.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* configEXPECTED_IDLE_TIME_BEFORE_SLEEP of Application/Inc/FreeRTOSConfig.h */
+#define TEST_IDLE_BEFORE_SLEEP  2U
+
+/* Simulated time, in stamps from day 0 */
+#define TEST_SECOND             ((uint64_t)RTC_STAMP_FREQ)
+#define TEST_DAY                ((uint64_t)RTC_STAMP_PER_DAY)
+#define TEST_NEVER              UINT64_MAX
+
+/* Random run: ten minutes centred on a midnight */
+#define TEST_RANDOM_START       ((9U * TEST_DAY) - (300U * TEST_SECOND))
+#define TEST_RANDOM_END         ((9U * TEST_DAY) + (300U * TEST_SECOND))
+
+/* Private macro -------------------------------------------------------------*/
+/* Time of the boundary of a kernel tick */
+#define TEST_TICK_TIME(__TICK__) (TestTickBase + ((uint64_t)(__TICK__) * RTOS_STAMPS_PER_TICK))
+
+/* Private variables ---------------------------------------------------------*/
+/* RTC: time, calendar changes and wake-up timer */
+static uint64_t   TestTime;
+static uint64_t   TestOffset;
+static uint64_t   TestTimerStart;
+static uint64_t   TestTimerPeriod;
+static uint32_t   TestTimerFlag;          /* WUTF, set until cleared       */
+static uint32_t   TestIrqPending;         /* NVIC pending bit, until run   */
+static uint32_t   TestFast;
+static uint64_t   TestEarly = TEST_NEVER; /* Another interrupt             */
+static uint64_t   TestJump;               /* Calendar change on it         */
+static uint64_t   TestDueTime = TEST_NEVER;
+
+/* Kernel stand-in */
+static BaseType_t       TestScheduler = taskSCHEDULER_NOT_STARTED;
+static eSleepModeStatus TestSleepStatus = eStandardSleep;
+static UBaseType_t      TestMask;
+static uint32_t         TestTickCount;
+static uint32_t         TestPended;
+static uint32_t         TestUnblockTick;
+static uint64_t         TestUnblockedAt = TEST_NEVER;
+static uint64_t         TestTickBase;
+
+/* What happened */
+static uint32_t   TestSleeps;
+static uint32_t   TestStretches;
+static uint64_t   TestLastStretch;
+static uint32_t   TestEarlyWakes;
+static uint32_t   TestSteps;
+static uint32_t   TestLastStep;
+static uint32_t   TestSeed = 1U;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/* RTC and event loop ------------------------------------------------------- */
+uint32_t RTC_GetStamp(void)
+{
+  return (uint32_t)((TestTime + TestOffset) % TEST_DAY);
+}
+
+uint32_t RTC_WakeUpFast(void)
+{
+  return TestFast;
+}
+
+void RTC_SetWakeUp(uint32_t Counts)
+{
+  uint32_t now = RTC_GetStamp();
+  uint64_t period = Counts / RTOS_COUNTS_PER_STAMP;
+
+  HOST_CHECK((Counts >= 1U) && (Counts <= 0x10000U));
+  HOST_CHECK((Counts % RTOS_COUNTS_PER_STAMP) == 0U);
+
+  if (Counts != RTOS_COUNTS_PER_TICK)
+  {
+    /* A stretch, one stamp past the boundary at most: the next second,
+       or the tick due */
+    HOST_CHECK(((now % RTC_STAMP_FREQ) + period) <= (RTC_STAMP_FREQ + 1U));
+    HOST_CHECK((TestDueTime == TEST_NEVER) || ((TestTime + period) <= (TestDueTime + 1U)));
+    HOST_CHECK(period >= (2U * RTOS_STAMPS_PER_TICK));
+    TestStretches++;
+    TestLastStretch = period;
+  }
+
+  /* Same as HAL_RTCEx_SetWakeUpTimer_IT(): the flag is cleared */
+  TestTimerStart = TestTime;
+  TestTimerPeriod = period;
+  TestTimerFlag = 0U;
+}
+
+/**
+  * @brief  Next expiry of the wake-up timer, after the current time.
+  * @param  None
+  * @retval Time
+  */
+static uint64_t TEST_TimerNext(void)
+{
+  uint64_t periods = ((TestTime - TestTimerStart) / TestTimerPeriod) + 1U;
+
+  return TestTimerStart + (periods * TestTimerPeriod);
+}
+
+void EVT_Sleep(void)
+{
+  uint64_t expiry;
+
+  HOST_CHECK(HostPrimask != 0U);
+  TestSleeps++;
+
+  /* A pending interrupt ends the sleep at once */
+  if (TestIrqPending != 0U)
+  {
+    return;
+  }
+
+  expiry = TEST_TimerNext();
+  if (TestEarly < expiry)
+  {
+    TestTime = TestEarly;
+    TestOffset += TestJump;
+    TestEarlyWakes++;
+  }
+  else
+  {
+    TestTime = expiry;
+    TestTimerFlag = 1U;
+    TestIrqPending = 1U;
+  }
+  TestEarly = TEST_NEVER;
+  TestJump = 0U;
+}
+
+/* rtos.c ------------------------------------------------------------------- */
+/* Same as in rtos.c, which needs the queues of the kernel: checked across
+   midnight and on a calendar change by Utilities/RtosSim */
+uint32_t RTOS_TicksElapsed(uint32_t From, uint32_t To)
+{
+  uint32_t ticks = (((To + RTC_STAMP_PER_DAY) - From) % RTC_STAMP_PER_DAY) / RTOS_STAMPS_PER_TICK;
+
+  return (ticks > RTOS_TICKS_MAX_STEP) ? RTOS_TICKS_JUMP : ticks;
+}
+
+/* Kernel ------------------------------------------------------------------- */
+UBaseType_t ulPortRaiseBASEPRI(void)
+{
+  UBaseType_t mask = TestMask;
+
+  TestMask = 1U;
+  return mask;
+}
+
+void vPortSetBASEPRI(UBaseType_t Mask)
+{
+  TestMask = Mask;
+}
+
+void vPortYield(void)
+{
+}
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+  return TestScheduler;
+}
+
+eSleepModeStatus eTaskConfirmSleepModeStatus(void)
+{
+  return TestSleepStatus;
+}
+
+/**
+  * @brief  One tick of the kernel, with the scheduler running.
+  * @param  None
+  * @retval pdTRUE when the blocked task is ready
+  */
+static BaseType_t TEST_KernelTick(void)
+{
+  /* As the kernel, on the first tick at or beyond the one due */
+  TestTickCount++;
+  if ((TestTickCount >= TestUnblockTick) && (TestUnblockedAt == TEST_NEVER))
+  {
+    TestUnblockedAt = TestTime;
+    return pdTRUE;
+  }
+  return pdFALSE;
+}
+
+BaseType_t xTaskIncrementTick(void)
+{
+  HOST_CHECK(TestMask != 0U);
+  HOST_CHECK(TestScheduler != taskSCHEDULER_NOT_STARTED);
+
+  if (TestScheduler == taskSCHEDULER_SUSPENDED)
+  {
+    TestPended++;
+    return pdFALSE;
+  }
+  return TEST_KernelTick();
+}
+
+void vTaskStepTick(TickType_t xTicksToJump)
+{
+  /* configASSERT() of the kernel */
+  HOST_CHECK(TestScheduler == taskSCHEDULER_SUSPENDED);
+  HOST_CHECK((TestTickCount + xTicksToJump) <= TestUnblockTick);
+
+  TestTickCount += xTicksToJump;
+  TestSteps++;
+  TestLastStep = xTicksToJump;
+}
+
+/* Tests -------------------------------------------------------------------- */
+/**
+  * @brief  Pseudo random number.
+  * @param  Range: Upper bound, excluded
+  * @retval 0 to Range - 1
+  */
+static uint32_t TEST_Random(uint32_t Range)
+{
+  TestSeed = (TestSeed * 1103515245U) + 12345U;
+  return (TestSeed >> 8) % Range;
+}
+
+/**
+  * @brief  Start the kernel at a time, the wake-up timer on the fast tick.
+  * @param  Time: Simulated time
+  * @retval None
+  */
+static void TEST_Start(uint64_t Time)
+{
+  TestTime = Time;
+  TestOffset = 0U;
+  TestTimerStart = Time - (Time % RTOS_STAMPS_PER_TICK);
+  TestTimerPeriod = RTOS_STAMPS_PER_TICK;
+  TestTimerFlag = 0U;
+  TestIrqPending = 0U;
+  TestFast = 0U;
+  TestEarly = TEST_NEVER;
+  TestJump = 0U;
+  TestTickCount = 0U;
+  TestPended = 0U;
+  TestUnblockTick = 0U;
+  TestUnblockedAt = TEST_NEVER;
+  TestSleeps = 0U;
+  TestStretches = 0U;
+  TestEarlyWakes = 0U;
+  TestSteps = 0U;
+  TestSleepStatus = eStandardSleep;
+
+  /* Nothing is counted before vTaskStartScheduler() */
+  TestScheduler = taskSCHEDULER_NOT_STARTED;
+  RTOS_TickHandler();
+  HOST_CHECK(TestTickCount == 0U);
+
+  vPortSetupTimerInterrupt();
+  TestScheduler = taskSCHEDULER_RUNNING;
+  TestTickBase = TestTimerStart;
+  HOST_CHECK(RtosTickStamp == (RTC_GetStamp() - (RTC_GetStamp() % RTOS_STAMPS_PER_TICK)));
+}
+
+/**
+  * @brief  Block the task until a number of ticks from now.
+  * @param  Ticks: Ticks to wait
+  * @retval None
+  */
+static void TEST_Block(uint32_t Ticks)
+{
+  TestUnblockTick = TestTickCount + Ticks;
+  TestUnblockedAt = TEST_NEVER;
+  TestDueTime = TEST_TICK_TIME(TestUnblockTick);
+}
+
+/**
+  * @brief  One pass of the idle task, then the wake-up timer interrupt if
+  *         its event is still set.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Idle(void)
+{
+  TickType_t expected = TestUnblockTick - TestTickCount;
+
+  if (expected >= TEST_IDLE_BEFORE_SLEEP)
+  {
+    /* prvIdleTask(): vTaskSuspendAll(), the sleep, xTaskResumeAll() */
+    TestScheduler = taskSCHEDULER_SUSPENDED;
+    HostPrimask = 0U;
+    vPortSuppressTicksAndSleep(expected);
+    HOST_CHECK(HostPrimask == 0U);
+    TestScheduler = taskSCHEDULER_RUNNING;
+    for (; TestPended > 0U; TestPended--)
+    {
+      (void)TEST_KernelTick();
+    }
+  }
+  else if (TestIrqPending == 0U)
+  {
+    /* The idle task runs until the next interrupt */
+    if (TestEarly < TEST_TimerNext())
+    {
+      TestTime = TestEarly;
+      TestEarlyWakes++;
+    }
+    else
+    {
+      TestTime = TEST_TimerNext();
+      TestTimerFlag = 1U;
+      TestIrqPending = 1U;
+    }
+    TestEarly = TEST_NEVER;
+  }
+
+  /* HAL_RTCEx_WakeUpTimerIRQHandler(): the callback only if WUTF is set */
+  if (TestIrqPending != 0U)
+  {
+    TestIrqPending = 0U;
+    if (TestTimerFlag != 0U)
+    {
+      TestTimerFlag = 0U;
+      RTOS_TickHandler();
+    }
+  }
+}
+
+/**
+  * @brief  The stretch ends on the next second however long the kernel may
+  *         sleep, the 1 s work running on time.
+  * @param  None
+  * @retval None
+  */
+static void TEST_SecondCap(void)
+{
+  uint64_t second = 1000U * TEST_SECOND;
+
+  /* Three ticks into a second, the task blocked for three seconds */
+  TEST_Start(second + (3U * RTOS_STAMPS_PER_TICK));
+  TEST_Block(3U * RTOS_TICK_HZ);
+  TEST_Idle();
+  HOST_CHECK(TestStretches == 1U);
+  HOST_CHECK(TestLastStretch == ((TEST_SECOND - (3U * RTOS_STAMPS_PER_TICK)) + 1U));
+  HOST_CHECK(TestTime == (second + TEST_SECOND + 1U));
+  HOST_CHECK(TestTickCount == (RTOS_TICK_HZ - 3U));
+  HOST_CHECK(TestTimerPeriod == RTOS_STAMPS_PER_TICK);
+  HOST_CHECK(RtosTickStamp == RTC_GetStamp() - 1U);
+
+  /* Less than a second, but beyond the next one */
+  TEST_Start(second + (20U * RTOS_STAMPS_PER_TICK));
+  TEST_Block(20U);
+  TEST_Idle();
+  HOST_CHECK(TestLastStretch == ((12U * RTOS_STAMPS_PER_TICK) + 1U));
+  HOST_CHECK(TestTickCount == 12U);
+  HOST_CHECK(TestUnblockedAt == TEST_NEVER);
+
+  /* The rest of the wait, then the task runs on the tick due */
+  TEST_Idle();
+  HOST_CHECK(TestTickCount == 20U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(20U) + 1U));
+}
+
+/**
+  * @brief  The task due runs on the wake-up that ends the stretch, not a
+  *         tick later: the last tick goes through xTaskIncrementTick().
+  * @param  None
+  * @retval None
+  */
+static void TEST_DueTick(void)
+{
+  /* Five stamps into a tick, the task due in 6 ticks */
+  TEST_Start((2000U * TEST_SECOND) + 5U);
+  TEST_Block(6U);
+  TEST_Idle();
+  HOST_CHECK(TestStretches == 1U);
+  HOST_CHECK(TestLastStretch == ((6U * RTOS_STAMPS_PER_TICK) - 5U + 1U));
+  HOST_CHECK(TestLastStep == 5U);
+  HOST_CHECK(TestTickCount == 6U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(6U) + 1U));
+
+  /* One tick left: no sleep, the idle task runs up to the interrupt */
+  TEST_Block(1U);
+  TEST_Idle();
+  HOST_CHECK(TestSleeps == 1U);
+  HOST_CHECK(TestTickCount == 7U);
+  HOST_CHECK(TestUnblockedAt == TEST_TimerNext() - RTOS_STAMPS_PER_TICK);
+
+  /* Aborted by a task made ready meanwhile */
+  TEST_Block(10U);
+  TestSleepStatus = eAbortSleep;
+  TEST_Idle();
+  HOST_CHECK(TestSleeps == 1U);
+  HOST_CHECK(TestStretches == 1U);
+  HOST_CHECK(TestTickCount == 7U);
+  TestSleepStatus = eStandardSleep;
+}
+
+/**
+  * @brief  While the button or the touch slider need the fast tick, the
+  *         part sleeps one tick at a time and each tick is counted by the
+  *         wake-up timer interrupt.
+  * @param  None
+  * @retval None
+  */
+static void TEST_FastTick(void)
+{
+  uint32_t i;
+
+  TEST_Start(3000U * TEST_SECOND);
+  TestFast = RTC_FAST_BUTTON;
+  TEST_Block(10U);
+  for (i = 0U; i < 10U; i++)
+  {
+    TEST_Idle();
+    HOST_CHECK(TestTickCount == (i + 1U));
+    HOST_CHECK(TestTime == TEST_TICK_TIME(i + 1U));
+  }
+  HOST_CHECK(TestStretches == 0U);
+  HOST_CHECK(TestSteps == 0U);
+  HOST_CHECK(TestSleeps == 9U);
+  HOST_CHECK(TestUnblockedAt == TEST_TICK_TIME(10U));
+
+  /* The touch slider alone */
+  TestFast = RTC_FAST_TOUCH;
+  TEST_Block(40U);
+  TEST_Idle();
+  HOST_CHECK(TestStretches == 0U);
+  HOST_CHECK(TestTickCount == 11U);
+  TestFast = 0U;
+}
+
+/**
+  * @brief  Another interrupt ends the stretch: the ticks elapsed are
+  *         stepped, the tick stamp stays on a boundary, and the rest of
+  *         the wait is slept again.
+  * @param  None
+  * @retval None
+  */
+static void TEST_EarlyWake(void)
+{
+  TEST_Start(4000U * TEST_SECOND);
+  TEST_Block(20U);
+
+  /* 5 ticks and 3 stamps in */
+  TestEarly = TestTime + (5U * RTOS_STAMPS_PER_TICK) + 3U;
+  TEST_Idle();
+  HOST_CHECK(TestEarlyWakes == 1U);
+  HOST_CHECK(TestStretches == 1U);
+  HOST_CHECK(TestLastStep == 5U);
+  HOST_CHECK(TestTickCount == 5U);
+  HOST_CHECK(RtosTickStamp == (RTC_GetStamp() - 3U));
+  HOST_CHECK(TestTimerPeriod == RTOS_STAMPS_PER_TICK);
+  HOST_CHECK(TestTimerStart == TestTime);
+
+  /* Before the first boundary: nothing to step */
+  TestEarly = TestTime + 2U;
+  TEST_Idle();
+  HOST_CHECK(TestLastStep == 0U);
+  HOST_CHECK(TestTickCount == 5U);
+
+  /* Then up to the tick due, from the middle of a tick */
+  TEST_Idle();
+  HOST_CHECK(TestStretches == 3U);
+  HOST_CHECK(TestLastStretch == ((15U * RTOS_STAMPS_PER_TICK) - 5U + 1U));
+  HOST_CHECK(TestTickCount == 20U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(20U) + 1U));
+}
+
+/**
+  * @brief  Stamps wrap at midnight: the stretch ends there, and a tick left
+  *         pending across it does not stretch the sleep to the next second.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Midnight(void)
+{
+  /* Three ticks before midnight, the task due 7 ticks after it */
+  TEST_Start((6U * TEST_DAY) - (3U * RTOS_STAMPS_PER_TICK));
+  TEST_Block(10U);
+  TEST_Idle();
+  HOST_CHECK(TestLastStretch == ((3U * RTOS_STAMPS_PER_TICK) + 1U));
+  HOST_CHECK(RTC_GetStamp() == 1U);
+  HOST_CHECK(TestTickCount == 3U);
+  HOST_CHECK(RtosTickStamp == 0U);
+  TEST_Idle();
+  HOST_CHECK(TestLastStretch == ((7U * RTOS_STAMPS_PER_TICK) - 1U + 1U));
+  HOST_CHECK(TestTickCount == 10U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(10U) + 1U));
+
+  /* The last tick of the day, its interrupt pending at stamp 1: the sleep
+     ends at once, and the interrupt finds no event once it is cleared */
+  TEST_Start((7U * TEST_DAY) - RTOS_STAMPS_PER_TICK);
+  TEST_Block(4U);
+  TestTime += RTOS_STAMPS_PER_TICK + 1U;
+  TestTimerFlag = 1U;
+  TestIrqPending = 1U;
+  TEST_Idle();
+  HOST_CHECK(TestStretches == 1U);
+  HOST_CHECK(TestLastStretch == ((4U * RTOS_STAMPS_PER_TICK) - (RTOS_STAMPS_PER_TICK + 1U) + 1U));
+  HOST_CHECK(TestTickCount == 1U);
+  HOST_CHECK(RtosTickStamp == 0U);
+  TEST_Idle();
+  HOST_CHECK(TestTickCount == 4U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(4U) + 1U));
+}
+
+/**
+  * @brief  A calendar change during a stretch counts one tick and starts
+  *         again from the new time.
+  * @param  None
+  * @retval None
+  */
+static void TEST_CalendarChange(void)
+{
+  TEST_Start(5000U * TEST_SECOND);
+  TEST_Block(30U);
+  TestEarly = TestTime + (2U * RTOS_STAMPS_PER_TICK) + 1U;
+  TestJump = 3600U * TEST_SECOND;
+  TEST_Idle();
+  HOST_CHECK(TestLastStep == 1U);
+  HOST_CHECK(TestTickCount == 1U);
+  HOST_CHECK(RtosTickStamp == (RTC_GetStamp() - 1U));
+
+  /* Counted from the new time on, tick 1 on its boundary */
+  TestTickBase = TestTime - 1U - RTOS_STAMPS_PER_TICK;
+  TestDueTime = TEST_TICK_TIME(TestUnblockTick);
+  TEST_Idle();
+  HOST_CHECK(TestTickCount == 30U);
+  HOST_CHECK(TestUnblockedAt == (TEST_TICK_TIME(30U) + 1U));
+}
+
+/**
+  * @brief  Random waits, early wake-ups and fast ticks for ten minutes
+  *         across midnight: the tick count follows the stamps exactly, and
+  *         each task due runs less than a tick after its boundary.
+  * @param  None
+  * @retval None
+  */
+static void TEST_RandomRun(void)
+{
+  uint64_t late, worst = 0U;
+  uint32_t blocks = 0U;
+
+  TEST_Start(TEST_RANDOM_START);
+  TEST_Block(1U);
+  while (TestTime < TEST_RANDOM_END)
+  {
+    if (TestTickCount >= TestUnblockTick)
+    {
+      HOST_CHECK(TestUnblockedAt != TEST_NEVER);
+      late = TestUnblockedAt - TEST_TICK_TIME(TestUnblockTick);
+      HOST_CHECK(late <= RTOS_STAMPS_PER_TICK);
+      worst = (late > worst) ? late : worst;
+      blocks++;
+
+      TEST_Block(1U + TEST_Random(3U * RTOS_TICK_HZ));
+      if (TEST_Random(8U) == 0U)
+      {
+        TestFast = (TestFast == 0U) ? RTC_FAST_TOUCH : 0U;
+      }
+    }
+    if (TEST_Random(3U) == 0U)
+    {
+      TestEarly = TestTime + 1U + TEST_Random(2U * RTC_STAMP_FREQ);
+    }
+    TEST_Idle();
+  }
+
+  /* Up to the last boundary passed */
+  RTOS_TickHandler();
+  HOST_CHECK(TestTickCount == ((TestTime - TestTickBase) / RTOS_STAMPS_PER_TICK));
+  HOST_CHECK(TestStretches > 0U);
+  HOST_CHECK(TestEarlyWakes > 0U);
+
+  printf("rtos_tick_test: %u waits over 10 min, %u sleeps, %u stretched, %u early wake-ups,"
+         " task due late by %u stamps at most\n", (unsigned)blocks, (unsigned)TestSleeps,
+         (unsigned)TestStretches, (unsigned)TestEarlyWakes, (unsigned)worst);
+}
+
+int main(void)
+{
+  TEST_SecondCap();
+  TEST_DueTick();
+  TEST_FastTick();
+  TEST_EarlyWake();
+  TEST_Midnight();
+  TEST_CalendarChange();
+  TEST_RandomRun();
+  return HOST_Report("rtos_tick_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,804 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/sd_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the sector cache of the two sd_diskio.c drivers, on
+  *          a fake card backed by a file.
+  *
+  *          Built twice: for Projects/STM32L152D-EVAL FatFs_uSD, the card is
+  *          reached through the BSP_SD_*_DMA() functions; with HOST_SD_NUCLEO
+  *          for the NUCLEO-L152RE Adafruit demonstration, the card answers
+  *          the SPI mode commands byte per byte and its data blocks must go
+  *          through HAL_SPI_TransmitReceive_DMA().
+  *
+  *          Checked: the hits and the LRU order, the write back of a dirty
+  *          sector on eviction, the dirty sectors patched into a multi
+  *          sector read, the cached copies refreshed by a multi sector write,
+  *          the ascending order of CTRL_SYNC, the unaligned buffers and the
+  *          failed write backs. The hit rate of a file growing the way FatFs
+  *          grows it is printed.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+#include "sd_diskio.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Card access, as seen by the card
+  */
+typedef struct
+{
+  uint32_t Write;                 /*!< 1 for a write, 0 for a read       */
+  uint32_t Sector;
+} TEST_CardOpTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_BLOCK         512U
+#define TEST_SECTORS       2048U         /* Size of the fake card         */
+#define TEST_OPS_MAX       4096U
+
+#if defined(HOST_SD_NUCLEO)
+#define TEST_NAME          "sd_nucleo_test"
+#else
+#define TEST_NAME          "sd_eval_test"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static FILE              *TestCard;
+static uint32_t           TestCardFail;
+static TEST_CardOpTypeDef TestOps[TEST_OPS_MAX];
+static uint32_t           TestOpCount;
+static uint32_t           TestTick;
+
+#if defined(HOST_SD_NUCLEO)
+/* SPI mode card: bytes it sends next, data bytes flagged, and its state */
+#define TEST_SPI_DATA      0x100U
+typedef enum
+{
+  TEST_SPI_IDLE = 0,
+  TEST_SPI_CMD,
+  TEST_SPI_WRITE_TOKEN,
+  TEST_SPI_WRITE_DATA,
+  TEST_SPI_WRITE_CRC
+} TEST_SpiStateTypeDef;
+
+static uint16_t             TestSpiOut[TEST_BLOCK + 16U];
+static uint32_t             TestSpiOutHead;
+static uint32_t             TestSpiOutTail;
+static TEST_SpiStateTypeDef TestSpiState;
+static uint8_t              TestSpiCmd[6];
+static uint8_t              TestSpiBlock[TEST_BLOCK];
+static uint32_t             TestSpiCount;
+static uint32_t             TestSpiSector;
+static uint32_t             TestSpiSelected;
+static uint32_t             TestSpiInDma;
+static uint32_t             TestSpiDataOutsideDma;
+static uint32_t             TestSpiDmaBlocks;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Content the card starts with.
+  * @param  Sector: Sector
+  * @param  Offset: Byte in the sector
+  * @retval Byte
+  */
+static uint8_t TEST_Pattern(uint32_t Sector, uint32_t Offset)
+{
+  return (uint8_t)((Sector * 7U) + Offset + (Offset >> 8));
+}
+
+/**
+  * @brief  Fill a sector with the bytes the test writes.
+  * @param  pData: Sector
+  * @param  Tag: Value of every byte
+  * @retval None
+  */
+static void TEST_Fill(uint8_t *pData, uint8_t Tag)
+{
+  memset(pData, Tag, TEST_BLOCK);
+}
+
+/**
+  * @brief  Fake card: read sectors of the backing file.
+  * @param  pData: Destination
+  * @param  Sector: First sector
+  * @param  Count: Sectors
+  * @retval 0 on success
+  */
+static int TEST_CardRead(uint8_t *pData, uint32_t Sector, uint32_t Count)
+{
+  uint32_t i;
+
+  if ((TestCardFail != 0U) || ((Sector + Count) > TEST_SECTORS))
+  {
+    return -1;
+  }
+  for (i = 0U; i < Count; i++)
+  {
+    if (TestOpCount < TEST_OPS_MAX)
+    {
+      TestOps[TestOpCount].Write  = 0U;
+      TestOps[TestOpCount].Sector = Sector + i;
+      TestOpCount++;
+    }
+  }
+  fseek(TestCard, (long)Sector * TEST_BLOCK, SEEK_SET);
+  return (fread(pData, TEST_BLOCK, Count, TestCard) == Count) ? 0 : -1;
+}
+
+/**
+  * @brief  Fake card: write sectors of the backing file.
+  * @param  pData: Source
+  * @param  Sector: First sector
+  * @param  Count: Sectors
+  * @retval 0 on success
+  */
+static int TEST_CardWrite(const uint8_t *pData, uint32_t Sector, uint32_t Count)
+{
+  uint32_t i;
+
+  if ((TestCardFail != 0U) || ((Sector + Count) > TEST_SECTORS))
+  {
+    return -1;
+  }
+  for (i = 0U; i < Count; i++)
+  {
+    if (TestOpCount < TEST_OPS_MAX)
+    {
+      TestOps[TestOpCount].Write  = 1U;
+      TestOps[TestOpCount].Sector = Sector + i;
+      TestOpCount++;
+    }
+  }
+  fseek(TestCard, (long)Sector * TEST_BLOCK, SEEK_SET);
+  return (fwrite(pData, TEST_BLOCK, Count, TestCard) == Count) ? 0 : -1;
+}
+
+/**
+  * @brief  Check one sector of the card.
+  * @param  Sector: Sector
+  * @param  pExpected: Expected content
+  * @retval 1 if the card holds it
+  */
+static int TEST_CardHolds(uint32_t Sector, const uint8_t *pExpected)
+{
+  uint8_t data[TEST_BLOCK];
+
+  fseek(TestCard, (long)Sector * TEST_BLOCK, SEEK_SET);
+  if (fread(data, TEST_BLOCK, 1U, TestCard) != 1U)
+  {
+    return 0;
+  }
+  return (memcmp(data, pExpected, TEST_BLOCK) == 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Sector as the card starts with it.
+  * @param  pData: Destination
+  * @param  Sector: Sector
+  * @retval None
+  */
+static void TEST_Original(uint8_t *pData, uint32_t Sector)
+{
+  uint32_t i;
+
+  for (i = 0U; i < TEST_BLOCK; i++)
+  {
+    pData[i] = TEST_Pattern(Sector, i);
+  }
+}
+
+/**
+  * @brief  Count the card writes since the last reset of the log.
+  * @param  None
+  * @retval Writes
+  */
+static uint32_t TEST_CardWrites(void)
+{
+  uint32_t i, writes = 0U;
+
+  for (i = 0U; i < TestOpCount; i++)
+  {
+    writes += TestOps[i].Write;
+  }
+  return writes;
+}
+
+/**
+  * @brief  Restart with the original card and an empty cache.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Restart(void)
+{
+  uint8_t data[TEST_BLOCK];
+  uint32_t sector;
+
+  fseek(TestCard, 0L, SEEK_SET);
+  for (sector = 0U; sector < TEST_SECTORS; sector++)
+  {
+    TEST_Original(data, sector);
+    fwrite(data, TEST_BLOCK, 1U, TestCard);
+  }
+  fflush(TestCard);
+
+  TestCardFail = 0U;
+  HOST_CHECK(SD_initialize(0) == 0U);
+  memset(&SdCacheStats, 0, sizeof(SdCacheStats));
+  TestOpCount = 0U;
+}
+
+/* HAL ---------------------------------------------------------------------- */
+uint32_t HAL_GetTick(void)
+{
+  return TestTick++;
+}
+
+#if defined(HOST_SD_NUCLEO)
+/* NUCLEO BSP and SPI card -------------------------------------------------- */
+uint8_t BSP_SD_Init(void)
+{
+  return MSD_OK;
+}
+
+uint8_t BSP_SD_GetStatus(void)
+{
+  return MSD_OK;
+}
+
+uint8_t BSP_SD_GetCardInfo(SD_CardInfo *CardInfo)
+{
+  CardInfo->CardCapacity  = (uint64_t)TEST_SECTORS * TEST_BLOCK;
+  CardInfo->CardBlockSize = TEST_BLOCK;
+  return MSD_OK;
+}
+
+void HOST_SdSelect(uint32_t Selected)
+{
+  TestSpiSelected = Selected;
+  if (Selected == 0U)
+  {
+    /* A transaction ends with the chip select */
+    HOST_CHECK(TestSpiOutHead == TestSpiOutTail);
+    TestSpiOutHead = TestSpiOutTail = 0U;
+    TestSpiState   = TEST_SPI_IDLE;
+  }
+}
+
+/**
+  * @brief  Queue bytes the card sends.
+  * @param  Byte: Byte, TEST_SPI_DATA set for a data block byte
+  * @retval None
+  */
+static void TEST_SpiSend(uint16_t Byte)
+{
+  TestSpiOut[TestSpiOutTail++] = Byte;
+}
+
+/**
+  * @brief  Decode a command: queue the R1 response, and the data block of a
+  *         read.
+  * @param  None
+  * @retval None
+  */
+static void TEST_SpiCommand(void)
+{
+  uint32_t index = TestSpiCmd[0] & 0x3FU;
+  uint32_t arg = ((uint32_t)TestSpiCmd[1] << 24) | ((uint32_t)TestSpiCmd[2] << 16) |
+                 ((uint32_t)TestSpiCmd[3] << 8) | TestSpiCmd[4];
+  uint32_t i;
+
+  TestSpiOutHead = TestSpiOutTail = 0U;
+  TestSpiState   = TEST_SPI_IDLE;
+  TestSpiSector  = arg / TEST_BLOCK;
+
+  /* NCR: one byte before the response */
+  TEST_SpiSend(0xFFU);
+  if (((index != SD_SPI_CMD_READ_BLOCK) && (index != SD_SPI_CMD_WRITE_BLOCK)) ||
+      ((arg % TEST_BLOCK) != 0U) || (TestSpiSector >= TEST_SECTORS))
+  {
+    TEST_SpiSend(0x04U);
+    return;
+  }
+
+  if (index == SD_SPI_CMD_WRITE_BLOCK)
+  {
+    TEST_SpiSend((TestCardFail != 0U) ? 0x20U : 0x00U);
+    TestSpiState = TEST_SPI_WRITE_TOKEN;
+    return;
+  }
+
+  if (TEST_CardRead(TestSpiBlock, TestSpiSector, 1U) != 0)
+  {
+    TEST_SpiSend(0x20U);
+    return;
+  }
+  TEST_SpiSend(0x00U);
+  /* NAC: the data token comes a few bytes later */
+  TEST_SpiSend(0xFFU);
+  TEST_SpiSend(0xFFU);
+  TEST_SpiSend(SD_SPI_START_TOKEN);
+  for (i = 0U; i < TEST_BLOCK; i++)
+  {
+    TEST_SpiSend(TEST_SPI_DATA | TestSpiBlock[i]);
+  }
+  TEST_SpiSend(0x5AU);
+  TEST_SpiSend(0xA5U);
+}
+
+/**
+  * @brief  One byte on the SPI: the card sends what it prepared before it
+  *         sees the byte it receives.
+  * @param  In: Byte from the STM32
+  * @retval Byte from the card
+  */
+static uint8_t TEST_SpiExchange(uint8_t In)
+{
+  uint16_t out = 0xFFU;
+
+  if (TestSpiSelected == 0U)
+  {
+    return 0xFFU;
+  }
+
+  if (TestSpiOutHead != TestSpiOutTail)
+  {
+    out = TestSpiOut[TestSpiOutHead++];
+    if (((out & TEST_SPI_DATA) != 0U) && (TestSpiInDma == 0U))
+    {
+      TestSpiDataOutsideDma++;
+    }
+  }
+
+  switch (TestSpiState)
+  {
+    case TEST_SPI_IDLE:
+      if ((In & 0xC0U) == 0x40U)
+      {
+        TestSpiCmd[0] = In;
+        TestSpiCount  = 1U;
+        TestSpiState  = TEST_SPI_CMD;
+      }
+      break;
+
+    case TEST_SPI_CMD:
+      TestSpiCmd[TestSpiCount++] = In;
+      if (TestSpiCount == sizeof(TestSpiCmd))
+      {
+        TEST_SpiCommand();
+      }
+      break;
+
+    case TEST_SPI_WRITE_TOKEN:
+      if (In == SD_SPI_START_TOKEN)
+      {
+        TestSpiCount = 0U;
+        TestSpiState = TEST_SPI_WRITE_DATA;
+      }
+      break;
+
+    case TEST_SPI_WRITE_DATA:
+      if (TestSpiInDma == 0U)
+      {
+        TestSpiDataOutsideDma++;
+      }
+      TestSpiBlock[TestSpiCount++] = In;
+      if (TestSpiCount == TEST_BLOCK)
+      {
+        TestSpiCount = 0U;
+        TestSpiState = TEST_SPI_WRITE_CRC;
+      }
+      break;
+
+    case TEST_SPI_WRITE_CRC:
+      if (++TestSpiCount == 2U)
+      {
+        TestSpiOutHead = TestSpiOutTail = 0U;
+        /* Data response, then busy while programming */
+        TEST_SpiSend((TEST_CardWrite(TestSpiBlock, TestSpiSector, 1U) == 0) ? 0xE5U : 0xEBU);
+        TEST_SpiSend(0x00U);
+        TEST_SpiSend(0x00U);
+        TEST_SpiSend(0x00U);
+        TestSpiState = TEST_SPI_IDLE;
+      }
+      break;
+  }
+
+  return (uint8_t)out;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData,
+                                          uint16_t Size, uint32_t Timeout)
+{
+  uint32_t i;
+
+  HOST_CHECK(hspi->State == HAL_SPI_STATE_READY);
+  for (i = 0U; i < Size; i++)
+  {
+    pRxData[i] = TEST_SpiExchange(pTxData[i]);
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData,
+                                              uint16_t Size)
+{
+  uint32_t i;
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  HOST_CHECK((hspi->hdmarx == &SdDmaRxHandle) && (hspi->hdmatx == &SdDmaTxHandle));
+  HOST_CHECK(Size == TEST_BLOCK);
+
+  /* Each byte is read by the TX channel before the RX channel stores the
+     byte received in its place: the completion is immediate */
+  TestSpiInDma = 1U;
+  for (i = 0U; i < Size; i++)
+  {
+    pRxData[i] = TEST_SpiExchange(pTxData[i]);
+  }
+  TestSpiInDma = 0U;
+  TestSpiDmaBlocks++;
+  return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi)
+{
+  return hspi->State;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+  hspi->State = HAL_SPI_STATE_READY;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  hdma->State = HAL_DMA_STATE_READY;
+  return HAL_OK;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+#else
+/* STM32L152D-EVAL BSP ------------------------------------------------------ */
+uint8_t BSP_SD_Init(void)
+{
+  return MSD_OK;
+}
+
+uint8_t BSP_SD_GetCardState(void)
+{
+  return MSD_OK;
+}
+
+void BSP_SD_GetCardInfo(BSP_SD_CardInfo *CardInfo)
+{
+  CardInfo->LogBlockNbr  = TEST_SECTORS;
+  CardInfo->LogBlockSize = TEST_BLOCK;
+}
+
+uint8_t BSP_SD_ReadBlocks_DMA(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOfBlocks)
+{
+  /* The SDIO DMA moves words */
+  HOST_CHECK(((uintptr_t)pData & 3U) == 0U);
+  if (TEST_CardRead((uint8_t *)pData, ReadAddr, NumOfBlocks) != 0)
+  {
+    return MSD_ERROR;
+  }
+  BSP_SD_ReadCpltCallback();
+  return MSD_OK;
+}
+
+uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint32_t WriteAddr, uint32_t NumOfBlocks)
+{
+  HOST_CHECK(((uintptr_t)pData & 3U) == 0U);
+  if (TEST_CardWrite((const uint8_t *)pData, WriteAddr, NumOfBlocks) != 0)
+  {
+    return MSD_ERROR;
+  }
+  BSP_SD_WriteCpltCallback();
+  return MSD_OK;
+}
+#endif /* HOST_SD_NUCLEO */
+
+/* Tests -------------------------------------------------------------------- */
+
+/**
+  * @brief  Hits, misses and the least recently used entry evicted.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Lru(void)
+{
+  uint8_t data[TEST_BLOCK], expected[TEST_BLOCK];
+  uint32_t sector, pass;
+
+  TEST_Restart();
+
+  for (pass = 0U; pass < 4U; pass++)
+  {
+    for (sector = 0U; sector < SD_CACHE_SECTORS; sector++)
+    {
+      HOST_CHECK(SD_read(0, data, sector, 1U) == RES_OK);
+      TEST_Original(expected, sector);
+      HOST_CHECK(memcmp(data, expected, TEST_BLOCK) == 0);
+    }
+  }
+  HOST_CHECK(SdCacheStats.Misses == SD_CACHE_SECTORS);
+  HOST_CHECK(SdCacheStats.Hits == (3U * SD_CACHE_SECTORS));
+  HOST_CHECK(TestOpCount == SD_CACHE_SECTORS);
+
+  /* Sector 0 used again: sector 1 is now the oldest and goes */
+  HOST_CHECK(SD_read(0, data, 0U, 1U) == RES_OK);
+  HOST_CHECK(SD_read(0, data, 100U, 1U) == RES_OK);
+  TestOpCount = 0U;
+  HOST_CHECK(SD_read(0, data, 0U, 1U) == RES_OK);
+  HOST_CHECK(TestOpCount == 0U);
+  HOST_CHECK(SD_read(0, data, 1U, 1U) == RES_OK);
+  HOST_CHECK((TestOpCount == 1U) && (TestOps[0].Sector == 1U));
+
+  /* A clean sector is dropped, never written */
+  HOST_CHECK(TEST_CardWrites() == 0U);
+  HOST_CHECK(SdCacheStats.WriteBacks == 0U);
+}
+
+/**
+  * @brief  A dirty sector reaches the card when it is evicted, not before.
+  * @param  None
+  * @retval None
+  */
+static void TEST_EvictionWriteBack(void)
+{
+  uint8_t data[TEST_BLOCK], written[TEST_BLOCK];
+  uint32_t sector;
+
+  TEST_Restart();
+
+  TEST_Fill(written, 0xA1U);
+  HOST_CHECK(SD_write(0, written, 50U, 1U) == RES_OK);
+  HOST_CHECK(TestOpCount == 0U);
+  HOST_CHECK(SD_read(0, data, 50U, 1U) == RES_OK);
+  HOST_CHECK(memcmp(data, written, TEST_BLOCK) == 0);
+  HOST_CHECK(SdCacheStats.Hits == 1U);
+
+  /* SD_CACHE_SECTORS newer sectors: sector 50 is the oldest */
+  for (sector = 60U; sector < (60U + SD_CACHE_SECTORS - 1U); sector++)
+  {
+    HOST_CHECK(SD_read(0, data, sector, 1U) == RES_OK);
+  }
+  HOST_CHECK(TEST_CardWrites() == 0U);
+  HOST_CHECK(SD_read(0, data, 60U + SD_CACHE_SECTORS, 1U) == RES_OK);
+  HOST_CHECK(TEST_CardWrites() == 1U);
+  HOST_CHECK(TEST_CardHolds(50U, written) == 1);
+  HOST_CHECK(SdCacheStats.WriteBacks == 1U);
+
+  /* Back from the card */
+  HOST_CHECK(SD_read(0, data, 50U, 1U) == RES_OK);
+  HOST_CHECK(memcmp(data, written, TEST_BLOCK) == 0);
+}
+
+/**
+  * @brief  Multi sector transfers and the cached copies.
+  * @param  None
+  * @retval None
+  */
+static void TEST_MultiSector(void)
+{
+  static uint8_t data[6U * TEST_BLOCK], block[3U * TEST_BLOCK];
+  uint8_t written[TEST_BLOCK], expected[TEST_BLOCK];
+  uint32_t i;
+
+  TEST_Restart();
+
+  /* Dirty sector 33 patched into a read of 30..35, the card still old */
+  TEST_Fill(written, 0xB2U);
+  HOST_CHECK(SD_write(0, written, 33U, 1U) == RES_OK);
+  HOST_CHECK(SD_read(0, data, 30U, 6U) == RES_OK);
+  for (i = 0U; i < 6U; i++)
+  {
+    TEST_Original(expected, 30U + i);
+    HOST_CHECK(memcmp(&data[i * TEST_BLOCK], (i == 3U) ? written : expected, TEST_BLOCK) == 0);
+  }
+  TEST_Original(expected, 33U);
+  HOST_CHECK(TEST_CardHolds(33U, expected) == 1);
+
+  /* Dirty sector 41 overwritten by a write of 40..42: refreshed and clean */
+  TEST_Fill(written, 0xC3U);
+  HOST_CHECK(SD_write(0, written, 41U, 1U) == RES_OK);
+  for (i = 0U; i < 3U; i++)
+  {
+    TEST_Fill(&block[i * TEST_BLOCK], (uint8_t)(0xD0U + i));
+  }
+  TestOpCount = 0U;
+  HOST_CHECK(SD_write(0, block, 40U, 3U) == RES_OK);
+  HOST_CHECK(TEST_CardWrites() == 3U);
+  HOST_CHECK(TEST_CardHolds(41U, &block[TEST_BLOCK]) == 1);
+  TestOpCount = 0U;
+  HOST_CHECK(SD_read(0, written, 41U, 1U) == RES_OK);
+  HOST_CHECK(TestOpCount == 0U);
+  HOST_CHECK(memcmp(written, &block[TEST_BLOCK], TEST_BLOCK) == 0);
+  HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_OK);
+  /* Only sector 33 was still dirty */
+  HOST_CHECK((TEST_CardWrites() == 1U) && (TestOps[0].Sector == 33U));
+}
+
+/**
+  * @brief  CTRL_SYNC writes the dirty sectors once, in ascending order.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Sync(void)
+{
+  static const uint32_t order[4] = {40U, 10U, 30U, 20U};
+  uint8_t written[TEST_BLOCK];
+  uint32_t i;
+
+  TEST_Restart();
+
+  for (i = 0U; i < 4U; i++)
+  {
+    TEST_Fill(written, (uint8_t)order[i]);
+    HOST_CHECK(SD_write(0, written, order[i], 1U) == RES_OK);
+  }
+  /* Rewritten: still one write back */
+  TEST_Fill(written, 0x77U);
+  HOST_CHECK(SD_write(0, written, 30U, 1U) == RES_OK);
+  HOST_CHECK(TestOpCount == 0U);
+
+  HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_OK);
+  HOST_CHECK(TestOpCount == 4U);
+  for (i = 0U; i < TestOpCount; i++)
+  {
+    HOST_CHECK((TestOps[i].Write == 1U) && (TestOps[i].Sector == (10U * (i + 1U))));
+  }
+  HOST_CHECK(TEST_CardHolds(30U, written) == 1);
+  HOST_CHECK(SdCacheStats.WriteBacks == 4U);
+
+  TestOpCount = 0U;
+  HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_OK);
+  HOST_CHECK(TestOpCount == 0U);
+
+  /* A failed write back keeps the sector dirty */
+  HOST_CHECK(SD_write(0, written, 12U, 1U) == RES_OK);
+  TestCardFail = 1U;
+  HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_ERROR);
+  TestCardFail = 0U;
+  TestOpCount = 0U;
+  HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_OK);
+  HOST_CHECK((TestOpCount == 1U) && (TestOps[0].Sector == 12U));
+  HOST_CHECK(TEST_CardHolds(12U, written) == 1);
+}
+
+/**
+  * @brief  FatFs buffers need not be word aligned.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Unaligned(void)
+{
+  static uint32_t words[(3U * TEST_BLOCK / 4U) + 1U];
+  uint8_t *buff = (uint8_t *)words + 1;
+  uint8_t expected[TEST_BLOCK];
+  uint32_t i;
+
+  TEST_Restart();
+
+  HOST_CHECK(SD_read(0, buff, 70U, 2U) == RES_OK);
+  for (i = 0U; i < 2U; i++)
+  {
+    TEST_Original(expected, 70U + i);
+    HOST_CHECK(memcmp(&buff[i * TEST_BLOCK], expected, TEST_BLOCK) == 0);
+  }
+  HOST_CHECK(SD_read(0, buff, 75U, 1U) == RES_OK);
+  TEST_Original(expected, 75U);
+  HOST_CHECK(memcmp(buff, expected, TEST_BLOCK) == 0);
+
+  TEST_Fill(buff, 0xE4U);
+  TEST_Fill(&buff[TEST_BLOCK], 0xE5U);
+  HOST_CHECK(SD_write(0, buff, 72U, 2U) == RES_OK);
+  HOST_CHECK(TEST_CardHolds(72U, buff) == 1);
+  HOST_CHECK(TEST_CardHolds(73U, &buff[TEST_BLOCK]) == 1);
+}
+
+/**
+  * @brief  A file growing cluster after cluster: the FAT and directory
+  *         sectors are read and written once per cluster, the data goes
+  *         straight to the card. Prints the hit rate and the writes saved.
+  * @param  None
+  * @retval None
+  */
+static void TEST_FileGrowth(void)
+{
+  static uint8_t cluster[4U * TEST_BLOCK];
+  uint8_t window[TEST_BLOCK];
+  uint32_t k, fat, single = 0U, syncs = 0U, writes;
+
+  TEST_Restart();
+
+  for (k = 0U; k < 256U; k++)
+  {
+    TEST_Fill(cluster, (uint8_t)k);
+    HOST_CHECK(SD_write(0, cluster, 200U + (k * 4U), 4U) == RES_OK);
+
+    /* FAT entry of the cluster, two FAT copies, then the directory entry */
+    fat = 1U + (k / 128U);
+    HOST_CHECK(SD_read(0, window, fat, 1U) == RES_OK);
+    window[(k % 128U) * 4U] = (uint8_t)k;
+    HOST_CHECK(SD_write(0, window, fat, 1U) == RES_OK);
+    HOST_CHECK(SD_write(0, window, fat + 8U, 1U) == RES_OK);
+    HOST_CHECK(SD_read(0, window, 20U, 1U) == RES_OK);
+    window[28] = (uint8_t)k;
+    HOST_CHECK(SD_write(0, window, 20U, 1U) == RES_OK);
+    single += 3U;
+
+    if ((k % 64U) == 63U)
+    {
+      HOST_CHECK(SD_ioctl(0, CTRL_SYNC, NULL) == RES_OK);
+      syncs++;
+    }
+  }
+
+  writes = TEST_CardWrites() - (256U * 4U);
+  HOST_CHECK(writes == SdCacheStats.WriteBacks);
+  HOST_CHECK(writes <= (syncs * 3U));
+  HOST_CHECK(SdCacheStats.Hits >= (2U * 256U - 4U));
+  printf("%s: %lu hits, %lu misses (%lu%% hits), %lu of %lu single sector writes reached the card\n",
+         TEST_NAME, (unsigned long)SdCacheStats.Hits, (unsigned long)SdCacheStats.Misses,
+         (unsigned long)((100U * SdCacheStats.Hits) / (SdCacheStats.Hits + SdCacheStats.Misses)),
+         (unsigned long)writes, (unsigned long)single);
+}
+
+int main(void)
+{
+  TestCard = tmpfile();
+  if (TestCard == NULL)
+  {
+    printf("FAIL no backing file for the card\n");
+    return 2;
+  }
+
+  TEST_Lru();
+  TEST_EvictionWriteBack();
+  TEST_MultiSector();
+  TEST_Sync();
+  TEST_Unaligned();
+  TEST_FileGrowth();
+
+#if defined(HOST_SD_NUCLEO)
+  /* Every data byte went through the DMA, one transfer per block */
+  HOST_CHECK(TestSpiDataOutsideDma == 0U);
+  HOST_CHECK(TestSpiDmaBlocks > 0U);
+#endif
+
+  fclose(TestCard);
+  return HOST_Report(TEST_NAME);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,409 @@
+/**
+  ******************************************************************************
+  * @file    HostTest/sync_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the sync packets of Application/Src/sync.c and of
+  *          the software AES of Application/Src/aes_sw.c.
+  *
+  *          Known answers: AESSW_Encrypt() against FIPS-197, the CTR mode
+  *          of SYNC_SwCipher() against SP 800-38A F.5.1, the CMAC subkeys
+  *          and SYNC_Cmac() against RFC 4493. Then packets sealed as the
+  *          sender does go through SYNC_Receive(): accepted once, rejected
+  *          when played again, when any byte is changed or when the
+  *          counter goes back, and the rejections are logged at most once
+  *          per SYNC_REJECT_LOG_PERIOD.
+  *
+  *          The data EEPROM holding the device key and the counter is a
+  *          host array.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_hal.h"
+
+/* Device key then counter, as provisioned in the data EEPROM */
+static uint32_t TestEeprom[8];
+#undef  FLASH_EEPROM_BASE
+#define FLASH_EEPROM_BASE       ((uintptr_t)TestEeprom)
+
+#include "aes_sw.c"
+#include "sync.c"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Packets of the flood checked against the log */
+#define TEST_FLOOD              100U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* FIPS-197 appendix B and C.1 */
+static const uint8_t TestFipsKey[2][AESSW_KEY_SIZE] =
+{
+  {0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C},
+  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+};
+static const uint8_t TestFipsIn[2][AESSW_BLOCK_SIZE] =
+{
+  {0x32, 0x43, 0xF6, 0xA8, 0x88, 0x5A, 0x30, 0x8D, 0x31, 0x31, 0x98, 0xA2, 0xE0, 0x37, 0x07, 0x34},
+  {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+};
+static const uint8_t TestFipsOut[2][AESSW_BLOCK_SIZE] =
+{
+  {0x39, 0x25, 0x84, 0x1D, 0x02, 0xDC, 0x09, 0xFB, 0xDC, 0x11, 0x85, 0x97, 0x19, 0x6A, 0x0B, 0x32},
+  {0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A},
+};
+
+/* SP 800-38A and RFC 4493 key and message */
+static const uint8_t TestKey[AESSW_KEY_SIZE] =
+{
+  0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C
+};
+static const uint8_t TestMsg[4 * SYNC_BLOCK_SIZE] =
+{
+  0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+  0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+  0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+  0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10,
+};
+
+/* SP 800-38A F.5.1 CTR-AES128.Encrypt */
+static const uint8_t TestCtrIv[SYNC_BLOCK_SIZE] =
+{
+  0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+static const uint8_t TestCtrOut[4 * SYNC_BLOCK_SIZE] =
+{
+  0x87, 0x4D, 0x61, 0x91, 0xB6, 0x20, 0xE3, 0x26, 0x1B, 0xEF, 0x68, 0x64, 0x99, 0x0D, 0xB6, 0xCE,
+  0x98, 0x06, 0xF6, 0x6B, 0x79, 0x70, 0xFD, 0xFF, 0x86, 0x17, 0x18, 0x7B, 0xB9, 0xFF, 0xFD, 0xFF,
+  0x5A, 0xE4, 0xDF, 0x3E, 0xDB, 0xD5, 0xD3, 0x5E, 0x5B, 0x4F, 0x09, 0x02, 0x0D, 0xB0, 0x3E, 0xAB,
+  0x1E, 0x03, 0x1D, 0xDA, 0x2F, 0xBE, 0x03, 0xD1, 0x79, 0x21, 0x70, 0xA0, 0xF3, 0x00, 0x9C, 0xEE,
+};
+
+/* RFC 4493 subkeys */
+static const uint8_t TestK1[SYNC_BLOCK_SIZE] =
+{
+  0xFB, 0xEE, 0xD6, 0x18, 0x35, 0x71, 0x33, 0x66, 0x7C, 0x85, 0xE0, 0x8F, 0x72, 0x36, 0xA8, 0xDE
+};
+static const uint8_t TestK2[SYNC_BLOCK_SIZE] =
+{
+  0xF7, 0xDD, 0xAC, 0x30, 0x6A, 0xE2, 0x66, 0xCC, 0xF9, 0x0B, 0xC1, 0x1E, 0xE4, 0x6D, 0x51, 0x3B
+};
+
+/* Tags of the first bytes of TestMsg: examples 1 and 2 of RFC 4493, then
+   24 and 32 bytes, the sizes of the packets, from the OpenSSL CMAC. The
+   40 and 64 byte examples are longer than SYNC_MAC_BLOCKS. */
+static const uint32_t TestCmacSize[4] = {0U, 16U, 24U, 32U};
+static const uint8_t TestCmacTag[4][SYNC_TAG_SIZE] =
+{
+  {0xBB, 0x1D, 0x69, 0x29, 0xE9, 0x59, 0x37, 0x28, 0x7F, 0xA3, 0x7D, 0x12, 0x9B, 0x75, 0x67, 0x46},
+  {0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44, 0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C},
+  {0xC2, 0xCC, 0xF5, 0x5E, 0xCF, 0x86, 0xA4, 0x06, 0xD0, 0xE8, 0x3C, 0xBB, 0xD9, 0x71, 0x1E, 0x05},
+  {0xCE, 0x0C, 0xBF, 0x17, 0x38, 0xF4, 0xDF, 0x64, 0x28, 0xB1, 0xD9, 0x3B, 0xF1, 0x20, 0x81, 0xC9},
+};
+
+/* Effects of the accepted packets */
+static uint32_t TestSeconds;
+static uint32_t TestContrast;
+static uint32_t TestCountdown;
+static uint32_t TestApplied;
+
+/* Log */
+static uint32_t TestNow = 86400U;
+static uint32_t TestLogAccepted;
+static uint32_t TestLogRejected;
+static uint32_t TestLogArg;
+static uint32_t TestLogValue;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/* Other modules ------------------------------------------------------------ */
+void LOG_Write(LOG_TypeDef Type, uint16_t Arg, uint32_t Value)
+{
+  if (Type == LOG_SYNC)
+  {
+    if ((Arg & SYNC_LOG_REJECTED) != 0U)
+    {
+      TestLogRejected++;
+    }
+    else
+    {
+      TestLogAccepted++;
+    }
+    TestLogArg = Arg;
+    TestLogValue = Value;
+  }
+}
+
+uint32_t LOG_Now(void)
+{
+  return TestNow;
+}
+
+void RTC_SetSeconds(uint32_t Seconds)
+{
+  TestSeconds = Seconds;
+  TestApplied++;
+}
+
+void DISPLAY_Contrast(uint32_t Level)
+{
+  TestContrast = Level;
+  TestApplied++;
+}
+
+void CHRONO_CountdownSet(uint32_t seconds)
+{
+  TestCountdown = seconds;
+  TestApplied++;
+}
+
+void PROF_Record(PROF_IdTypeDef Id, uint32_t StartCycles)
+{
+}
+
+/* HAL ---------------------------------------------------------------------- */
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Unlock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Lock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data)
+{
+  HOST_CHECK(TypeProgram == FLASH_TYPEPROGRAMDATA_WORD);
+  HOST_CHECK(Address == (uint32_t)SYNC_COUNTER_ADDRESS);
+  TestEeprom[(SYNC_COUNTER_ADDRESS - SYNC_KEY_ADDRESS) / 4U] = Data;
+  return HAL_OK;
+}
+
+/* Tests -------------------------------------------------------------------- */
+/**
+  * @brief  AESSW_Encrypt() against FIPS-197, out of place and in place.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Aes(void)
+{
+  AESSW_ContextTypeDef ctx;
+  uint8_t block[AESSW_BLOCK_SIZE];
+  uint32_t i;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    AESSW_SetKey(&ctx, TestFipsKey[i]);
+    AESSW_Encrypt(&ctx, TestFipsIn[i], block);
+    HOST_CHECK(memcmp(block, TestFipsOut[i], AESSW_BLOCK_SIZE) == 0);
+
+    memcpy(block, TestFipsIn[i], AESSW_BLOCK_SIZE);
+    AESSW_Encrypt(&ctx, block, block);
+    HOST_CHECK(memcmp(block, TestFipsOut[i], AESSW_BLOCK_SIZE) == 0);
+  }
+}
+
+/**
+  * @brief  The CTR mode of the software cipher against SP 800-38A, and back.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Ctr(void)
+{
+  uint8_t out[sizeof(TestMsg)], back[sizeof(TestMsg)];
+
+  SYNC_SetKey(SYNC_KEY_ENC, TestKey);
+  SYNC_SwCipher(SYNC_MODE_CTR, SYNC_KEY_ENC, TestCtrIv, TestMsg, sizeof(TestMsg), out);
+  HOST_CHECK(memcmp(out, TestCtrOut, sizeof(TestCtrOut)) == 0);
+
+  SYNC_SwCipher(SYNC_MODE_CTR, SYNC_KEY_ENC, TestCtrIv, out, sizeof(out), back);
+  HOST_CHECK(memcmp(back, TestMsg, sizeof(TestMsg)) == 0);
+}
+
+/**
+  * @brief  The CMAC subkeys and tags against RFC 4493.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Cmac(void)
+{
+  uint8_t tag[SYNC_TAG_SIZE];
+  uint32_t i;
+
+  SYNC_SetKey(SYNC_KEY_MAC, TestKey);
+  HOST_CHECK(memcmp(SyncK1, TestK1, SYNC_BLOCK_SIZE) == 0);
+  HOST_CHECK(memcmp(SyncK2, TestK2, SYNC_BLOCK_SIZE) == 0);
+
+  for (i = 0U; i < 4U; i++)
+  {
+    SYNC_Cmac(SYNC_SwCipher, TestMsg, TestCmacSize[i], tag);
+    HOST_CHECK(memcmp(tag, TestCmacTag[i], SYNC_TAG_SIZE) == 0);
+  }
+}
+
+/**
+  * @brief  Provision the device key and the counter, then start.
+  * @param  Key: AESSW_KEY_SIZE bytes
+  * @param  Counter: Last counter accepted
+  * @retval None
+  */
+static void TEST_Provision(const uint8_t *Key, uint32_t Counter)
+{
+  memcpy(TestEeprom, Key, AESSW_KEY_SIZE);
+  TestEeprom[(SYNC_COUNTER_ADDRESS - SYNC_KEY_ADDRESS) / 4U] = Counter;
+  SYNC_Init();
+}
+
+/**
+  * @brief  Seal a SYNC_TIME packet, as the sender does.
+  * @param  Counter: Packet counter
+  * @param  Seconds: Time
+  * @param  Packet: SYNC_PACKET_MAX bytes
+  * @retval Packet size
+  */
+static uint32_t TEST_Time(uint32_t Counter, uint32_t Seconds, uint8_t *Packet)
+{
+  SYNC_HeaderTypeDef header = { SYNC_VERSION, SYNC_TIME, sizeof(SYNC_TimeTypeDef), 0U, 0U };
+  SYNC_TimeTypeDef time;
+
+  header.Counter = Counter;
+  time.Seconds = Seconds;
+  return SYNC_Seal(SYNC_SwCipher, &header, &time, Packet);
+}
+
+/**
+  * @brief  Packets through SYNC_Receive(): applied once, never replayed,
+  *         never tampered with.
+  * @param  None
+  * @retval None
+  */
+static void TEST_Packets(void)
+{
+  SYNC_HeaderTypeDef header = { SYNC_VERSION, SYNC_SETTINGS, sizeof(SYNC_SettingsTypeDef), 0U, 10U };
+  SYNC_SettingsTypeDef settings = { 3U, { 0U }, 600U };
+  uint8_t packet[SYNC_PACKET_MAX], old[SYNC_PACKET_MAX];
+  uint32_t size, oldsize, i, bit, seconds = 1000U;
+  uint32_t *counter = &TestEeprom[(SYNC_COUNTER_ADDRESS - SYNC_KEY_ADDRESS) / 4U];
+  static const uint8_t zero[AESSW_KEY_SIZE] = {0};
+
+  /* Erased EEPROM: sync disabled */
+  TEST_Provision(zero, 0U);
+  size = TEST_Time(1U, 1000U, packet);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+  HOST_CHECK(TestApplied == 0U);
+
+  TEST_Provision(TestFipsKey[1], 0U);
+
+  /* The payload is encrypted, then accepted once */
+  oldsize = TEST_Time(1U, seconds, old);
+  HOST_CHECK(memcmp(&old[SYNC_HEADER_SIZE], &seconds, sizeof(seconds)) != 0);
+  HOST_CHECK(SYNC_Receive(old, oldsize) == HAL_OK);
+  HOST_CHECK((TestApplied == 1U) && (TestSeconds == 1000U));
+  HOST_CHECK((SyncCounter == 1U) && (*counter == 1U));
+  HOST_CHECK(SYNC_Receive(old, oldsize) == HAL_ERROR);
+  HOST_CHECK(TestApplied == 1U);
+
+  /* Every bit of header, payload and tag is covered */
+  size = SYNC_Seal(SYNC_SwCipher, &header, &settings, packet);
+  for (i = 0U; i < size; i++)
+  {
+    for (bit = 0U; bit < 8U; bit++)
+    {
+      packet[i] ^= (uint8_t)(1U << bit);
+      HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+      packet[i] ^= (uint8_t)(1U << bit);
+    }
+  }
+  HOST_CHECK(SYNC_Receive(packet, size - 1U) == HAL_ERROR);
+  HOST_CHECK(TestApplied == 1U);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_OK);
+  HOST_CHECK((TestContrast == 3U) && (TestCountdown == 600U) && (TestApplied == 3U));
+  HOST_CHECK(*counter == 10U);
+
+  /* A counter below the last one, even authentic, or after a reset */
+  size = TEST_Time(5U, 2000U, packet);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+  SYNC_Init();
+  HOST_CHECK(SYNC_Receive(old, oldsize) == HAL_ERROR);
+  HOST_CHECK(TestApplied == 3U);
+
+  /* Authentic but out of range: the counter is used up */
+  size = TEST_Time(11U, SYNC_SECONDS_MAX, packet);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+  HOST_CHECK((TestApplied == 3U) && (*counter == 11U));
+  size = TEST_Time(12U, 3000U, packet);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_OK);
+  HOST_CHECK(TestSeconds == 3000U);
+
+  /* A device with another key rejects the packet */
+  size = TEST_Time(13U, 4000U, packet);
+  TEST_Provision(TestFipsKey[0], 12U);
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+  HOST_CHECK(TestSeconds == 3000U);
+
+  /* Accepted packets are all logged, the rejected ones once in the period */
+  HOST_CHECK(TestLogAccepted == 3U);
+  HOST_CHECK(TestLogRejected == 1U);
+  HOST_CHECK(SYNC_GetRejected() > (size * 8U));
+}
+
+/**
+  * @brief  A flood of rejected packets: one log entry per period, holding
+  *         the count.
+  * @param  None
+  * @retval None
+  */
+static void TEST_RejectLog(void)
+{
+  uint8_t packet[SYNC_PACKET_MAX];
+  uint32_t size, i, rejected, entries;
+
+  TEST_Provision(TestFipsKey[1], 0U);
+  size = TEST_Time(1U, 1000U, packet);
+  packet[size - 1U] ^= 1U;
+
+  /* A quiet period: the first rejection is logged at once */
+  TestNow += SYNC_REJECT_LOG_PERIOD;
+  rejected = SYNC_GetRejected();
+  entries = TestLogRejected;
+  for (i = 0U; i < TEST_FLOOD; i++)
+  {
+    HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+    TestNow += (i % 8U) == 7U ? 1U : 0U;
+  }
+  HOST_CHECK(SYNC_GetRejected() == (rejected + TEST_FLOOD));
+  HOST_CHECK(TestLogRejected == (entries + 1U));
+  HOST_CHECK(TestLogArg == (SYNC_TIME | SYNC_LOG_REJECTED));
+
+  /* The next period: the rest in one entry */
+  TestNow += SYNC_REJECT_LOG_PERIOD;
+  HOST_CHECK(SYNC_Receive(packet, size) == HAL_ERROR);
+  HOST_CHECK(TestLogRejected == (entries + 2U));
+  HOST_CHECK(TestLogValue == TEST_FLOOD);
+  HOST_CHECK(SyncRejectPending == 0U);
+}
+
+int main(void)
+{
+  TEST_Aes();
+  TEST_Ctr();
+  TEST_Cmac();
+  TEST_Packets();
+  TEST_RejectLog();
+  return HOST_Report("sync_test");
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
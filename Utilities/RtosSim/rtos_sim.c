@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file    RtosSim/rtos_sim.c
+  * @author  MCD Application Team
+  * @brief   Host simulation of the FreeRTOS build, on the POSIX port: runs
+  *          Application/Src/rtos.c with the handlers replaced by recorders
+  *          and checks the routing, the order and the run to completion of
+  *          the events, the sync queue and the tick count of the RTC stamps.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rtos.h"
+#include "sync.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Handler run, as recorded by EVT_Run()
+  */
+typedef struct
+{
+  EVT_IdTypeDef Id;
+  uint32_t      Param;
+  char          Task[configMAX_TASK_NAME_LEN];
+} SIM_RunTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define SIM_RUNS_MAX        64U
+#define SIM_PARAM_EARLY     0xEA71U     /* Event posted before the kernel  */
+#define SIM_PARAM_BUSY      0xB05AU     /* Handler running for 3 ticks     */
+
+/* Private macro -------------------------------------------------------------*/
+#define SIM_CHECK(__COND__) SIM_Check((__COND__), #__COND__, __LINE__)
+
+/* Private variables ---------------------------------------------------------*/
+static SIM_RunTypeDef SimRuns[SIM_RUNS_MAX];
+static uint32_t SimRunCount;
+static uint32_t SimDepth;               /* Handlers running, at most 1     */
+static uint32_t SimNested;
+static uint32_t SimFailed;
+
+static EVT_TypeDef SimEarly;            /* The rings of event.c, reduced   */
+static uint32_t SimEarlyPending;
+
+static uint32_t SimPackets;
+static uint8_t  SimPacketFirst[4];
+static uint32_t SimPacketSize[4];
+
+/* Private function prototypes -----------------------------------------------*/
+static void SIM_Check(int Cond, const char *Text, int Line);
+static void SIM_Post(EVT_IdTypeDef Id, uint32_t Param);
+static const char *SIM_TaskOf(EVT_IdTypeDef Id);
+static void SIM_CheckTicks(void);
+static void SIM_StimulusTask(void *Argument);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Record a failed check.
+  */
+static void SIM_Check(int Cond, const char *Text, int Line)
+{
+  if (!Cond)
+  {
+    printf("FAIL line %d: %s\n", Line, Text);
+    SimFailed++;
+  }
+}
+
+/**
+  * @brief  Kernel assertion, from configASSERT().
+  */
+void SIM_AssertFailed(const char *File, unsigned long Line)
+{
+  printf("FAIL assert %s:%lu\n", File, Line);
+  exit(2);
+}
+
+/**
+  * @brief  EVT_Post() of event.c: the task queues once the kernel runs.
+  */
+static void SIM_Post(EVT_IdTypeDef Id, uint32_t Param)
+{
+  EVT_TypeDef evt;
+
+  evt.Id = Id;
+  evt.Param = Param;
+  if (RTOS_IsRunning() != 0U)
+  {
+    SIM_CHECK(RTOS_Post(&evt) == HAL_OK);
+  }
+  else
+  {
+    SimEarly = evt;
+    SimEarlyPending = 1U;
+  }
+}
+
+/**
+  * @brief  Task expected to handle an event.
+  */
+static const char *SIM_TaskOf(EVT_IdTypeDef Id)
+{
+  switch (Id)
+  {
+    case EVT_BUTTON_EDGE:
+    case EVT_BUTTON_TICK:
+    case EVT_TOUCH_TICK:
+      return "Input";
+    default:
+      return "Display";
+  }
+}
+
+/**
+  * @brief  Stand-in of event.c: handlers of the events posted before the
+  *         kernel ran.
+  */
+uint32_t EVT_Dispatch(void)
+{
+  if (SimEarlyPending != 0U)
+  {
+    SimEarlyPending = 0U;
+    EVT_Run(&SimEarly);
+    return 1U;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Stand-in of event.c: record the handler run and the task running
+  *         it. A busy handler lets ticks pass: no other handler may start.
+  */
+void EVT_Run(const EVT_TypeDef *Event)
+{
+  TickType_t start;
+
+  if (SimDepth++ != 0U)
+  {
+    SimNested++;
+  }
+
+  if (SimRunCount < SIM_RUNS_MAX)
+  {
+    SimRuns[SimRunCount].Id = Event->Id;
+    SimRuns[SimRunCount].Param = Event->Param;
+    strncpy(SimRuns[SimRunCount].Task, pcTaskGetName(NULL), configMAX_TASK_NAME_LEN - 1U);
+    SimRunCount++;
+  }
+
+  /* The stimulus task wakes up meanwhile: a preemptive scheduler would
+     run it, then the input task, a cooperative one waits for the return */
+  if (Event->Param == SIM_PARAM_BUSY)
+  {
+    start = xTaskGetTickCount();
+    while ((xTaskGetTickCount() - start) < 3U)
+    {
+    }
+  }
+
+  SimDepth--;
+}
+
+/**
+  * @brief  Stand-in of sync.c: record the packet.
+  */
+HAL_StatusTypeDef SYNC_Receive(const uint8_t *Packet, uint32_t Size)
+{
+  if (SimPackets < 4U)
+  {
+    SimPacketFirst[SimPackets] = Packet[0];
+    SimPacketSize[SimPackets] = Size;
+  }
+  SimPackets++;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Ticks counted from the RTC stamps.
+  */
+static void SIM_CheckTicks(void)
+{
+  SIM_CHECK(RTOS_TicksElapsed(0U, RTOS_STAMPS_PER_TICK - 1U) == 0U);
+  SIM_CHECK(RTOS_TicksElapsed(0U, RTOS_STAMPS_PER_TICK) == 1U);
+  SIM_CHECK(RTOS_TicksElapsed(1000U, 1000U + RTC_STAMP_FREQ) == RTOS_TICK_HZ);
+
+  /* Across midnight */
+  SIM_CHECK(RTOS_TicksElapsed(RTC_STAMP_PER_DAY - RTOS_STAMPS_PER_TICK,
+                              RTOS_STAMPS_PER_TICK) == 2U);
+
+  /* Longest step counted, then calendar changes */
+  SIM_CHECK(RTOS_TicksElapsed(100U, 100U + (RTOS_TICKS_MAX_STEP * RTOS_STAMPS_PER_TICK))
+            == RTOS_TICKS_MAX_STEP);
+  SIM_CHECK(RTOS_TicksElapsed(100U, 100U + ((RTOS_TICKS_MAX_STEP + 1U) * RTOS_STAMPS_PER_TICK))
+            == RTOS_TICKS_JUMP);
+  SIM_CHECK(RTOS_TicksElapsed(1000U, 900U) == RTOS_TICKS_JUMP);
+
+  /* The tick is the RTC fast tick, on whole stamps and timer counts */
+  SIM_CHECK(configTICK_RATE_HZ == RTOS_TICK_HZ);
+  SIM_CHECK((RTOS_STAMPS_PER_TICK * RTOS_TICK_HZ) == RTC_STAMP_FREQ);
+  SIM_CHECK((RTOS_COUNTS_PER_STAMP * RTOS_STAMPS_PER_TICK) == RTOS_COUNTS_PER_TICK);
+}
+
+/**
+  * @brief  Interrupts of the clock: posts the events and packets, then
+  *         checks what the tasks ran.
+  */
+static void SIM_StimulusTask(void *Argument)
+{
+  uint8_t packet[SYNC_PACKET_MAX + 1U];
+  uint32_t i, id, last;
+  (void)Argument;
+
+  /* Every event, in the order of the identifiers, as from one interrupt */
+  for (id = 0U; id < EVT_ID_COUNT; id++)
+  {
+    SIM_Post((EVT_IdTypeDef)id, id);
+  }
+  vTaskDelay(2U);
+
+  /* A burst of fast ticks: handled in order, all of them */
+  for (i = 0U; i < RTOS_QUEUE_SIZE; i++)
+  {
+    SIM_Post(EVT_BUTTON_TICK, 0x100U + i);
+  }
+  vTaskDelay(2U);
+
+  /* Sync packets: two wait, the third is refused, too long is an error */
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0xA1U;
+  SIM_CHECK(RTOS_Sync(packet, 16U) == HAL_OK);
+  packet[0] = 0xA2U;
+  SIM_CHECK(RTOS_Sync(packet, SYNC_PACKET_MAX) == HAL_OK);
+  SIM_CHECK(RTOS_Sync(packet, 16U) == HAL_BUSY);
+  SIM_CHECK(RTOS_Sync(packet, SYNC_PACKET_MAX + 1U) == HAL_ERROR);
+  vTaskDelay(2U);
+
+  /* A button press while the display task is busy: run after it */
+  SIM_Post(EVT_LIGHT, SIM_PARAM_BUSY);
+  vTaskDelay(1U);
+  SIM_Post(EVT_BUTTON_EDGE, SIM_PARAM_BUSY + 1U);
+  vTaskDelay(4U);
+
+  /* The event posted before the kernel ran, handled first and once */
+  SIM_CHECK(SimRunCount == (1U + EVT_ID_COUNT + RTOS_QUEUE_SIZE + 2U));
+  SIM_CHECK(SimRuns[0].Id == EVT_RTC_WAKEUP);
+  SIM_CHECK(SimRuns[0].Param == SIM_PARAM_EARLY);
+
+  /* Every event by its task, input before display */
+  last = 0U;
+  for (i = 1U; i <= EVT_ID_COUNT; i++)
+  {
+    SIM_CHECK(strcmp(SimRuns[i].Task, SIM_TaskOf(SimRuns[i].Id)) == 0);
+    SIM_CHECK(SimRuns[i].Param == (uint32_t)SimRuns[i].Id);
+    if (strcmp(SimRuns[i].Task, "Input") == 0)
+    {
+      SIM_CHECK(last == 0U);
+    }
+    else
+    {
+      last = 1U;
+    }
+  }
+
+  /* The burst in order, in the input task */
+  for (i = 0U; i < RTOS_QUEUE_SIZE; i++)
+  {
+    SIM_CHECK(SimRuns[1U + EVT_ID_COUNT + i].Param == (0x100U + i));
+    SIM_CHECK(strcmp(SimRuns[1U + EVT_ID_COUNT + i].Task, "Input") == 0);
+  }
+
+  /* Run to completion */
+  i = 1U + EVT_ID_COUNT + RTOS_QUEUE_SIZE;
+  SIM_CHECK((SimRuns[i].Id == EVT_LIGHT) && (SimRuns[i + 1U].Id == EVT_BUTTON_EDGE));
+  SIM_CHECK(SimNested == 0U);
+
+  SIM_CHECK(SimPackets == 2U);
+  SIM_CHECK((SimPacketFirst[0] == 0xA1U) && (SimPacketSize[0] == 16U));
+  SIM_CHECK((SimPacketFirst[1] == 0xA2U) && (SimPacketSize[1] == SYNC_PACKET_MAX));
+
+  SIM_CheckTicks();
+
+  printf("%s: %lu handlers, %lu packets\n", (SimFailed == 0U) ? "PASS" : "FAIL",
+         (unsigned long)SimRunCount, (unsigned long)SimPackets);
+  exit((SimFailed == 0U) ? 0 : 1);
+}
+
+/**
+  * @brief  Main program: the end of the initialization of main.c.
+  */
+int main(void)
+{
+  /* An interrupt before RTOS_Start(): left for the first task */
+  SIM_Post(EVT_RTC_WAKEUP, SIM_PARAM_EARLY);
+
+  /* Above the tasks of rtos.c, like the interrupts it stands for */
+  xTaskCreate(SIM_StimulusTask, "Stim", configMINIMAL_STACK_SIZE * 4U, NULL,
+              configMAX_PRIORITIES - 1U, NULL);
+
+  RTOS_Start();
+  return 1;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
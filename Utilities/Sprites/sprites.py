@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""RGB565 digit sprites of the TFT clock face, as a C source file.
+
+Usage:
+  sprites.py [-o OUTPUT]
+
+The digits are seven-segment glyphs with beveled segments, anti-aliased by
+supersampling. Each sprite is written column after column, in the order the
+panel is filled by display_tft.c, with the RGB565 bytes swapped for the 8-bit
+SPI: the DMA streams the sprites from flash as they are.
+
+The geometry must match TFT_SPRITE_xxx in Application/Inc/display_tft.h.
+"""
+
+import argparse
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, '..', '..'))
+DEFAULT_OUTPUT = os.path.join(ROOT, 'Application', 'Src', 'display_tft_sprites.c')
+
+HEIGHT = 32
+DIGIT_WIDTH = 18
+SEP_WIDTH = 6
+SUPERSAMPLE = 4
+
+FORE = 0xFFFF  # TFT_COLOR_DIGIT
+BACK = 0x0000  # TFT_COLOR_BACK
+
+HALF = 1.6     # half thickness of a segment
+GAP = 0.5      # between two segments
+DOT = 1.8      # radius of the colon and point dots
+
+# Segments a to g of '0' to '9', ' ' and '-'
+GLYPHS = ['abcdef', 'bc', 'abdeg', 'abcdg', 'bcfg', 'acdfg', 'acdefg', 'abc',
+          'abcdefg', 'abcdfg', '', 'g']
+NAMES = ['0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'blank', 'minus']
+SEPARATORS = [(), ('colon',), ('point',), ('colon', 'point')]
+SEP_NAMES = ['none', 'colon', 'point', 'colon and point']
+
+HEADER = '''/**
+  ******************************************************************************
+  * @file    display_tft_sprites.c
+  * @author  MCD Application Team
+  * @brief   Digit sprites of the TFT clock face, in flash.
+  *          Written by Utilities/Sprites/sprites.py: do not edit.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "display_tft.h"
+
+#if defined(USE_DISPLAY_TFT)
+
+'''
+
+FOOTER = '''#endif /* USE_DISPLAY_TFT */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+'''
+
+
+def hexagon(x0, y0, x1, y1):
+    """Beveled segment from (x0, y0) to (x1, y1), horizontal or vertical."""
+    if y0 == y1:
+        return [(x0, y0), (x0 + HALF, y0 - HALF), (x1 - HALF, y0 - HALF),
+                (x1, y0), (x1 - HALF, y0 + HALF), (x0 + HALF, y0 + HALF)]
+    return [(x0, y0), (x0 + HALF, y0 + HALF), (x0 + HALF, y1 - HALF),
+            (x0, y1), (x0 - HALF, y1 - HALF), (x0 - HALF, y0 + HALF)]
+
+
+def segments():
+    left, right = HALF + 0.2, DIGIT_WIDTH - HALF - 0.2
+    top, mid, bottom = HALF + 0.2, HEIGHT / 2.0, HEIGHT - HALF - 0.2
+    return {
+        'a': hexagon(left + GAP, top, right - GAP, top),
+        'b': hexagon(right, top + GAP, right, mid - GAP),
+        'c': hexagon(right, mid + GAP, right, bottom - GAP),
+        'd': hexagon(left + GAP, bottom, right - GAP, bottom),
+        'e': hexagon(left, mid + GAP, left, bottom - GAP),
+        'f': hexagon(left, top + GAP, left, mid - GAP),
+        'g': hexagon(left + GAP, mid, right - GAP, mid),
+    }
+
+
+def inside(poly, x, y):
+    """Point in a convex polygon listed clockwise on the screen."""
+    for i in range(len(poly)):
+        (ax, ay), (bx, by) = poly[i], poly[(i + 1) % len(poly)]
+        if (bx - ax) * (y - ay) - (by - ay) * (x - ax) < 0:
+            return False
+    return True
+
+
+def render(width, shapes):
+    """Coverage of each pixel, column after column."""
+    out = []
+    step = 1.0 / SUPERSAMPLE
+    for x in range(width):
+        for y in range(HEIGHT):
+            hits = 0
+            for i in range(SUPERSAMPLE):
+                for j in range(SUPERSAMPLE):
+                    sx, sy = x + (i + 0.5) * step, y + (j + 0.5) * step
+                    if any(shape(sx, sy) for shape in shapes):
+                        hits += 1
+            out.append(hits / float(SUPERSAMPLE * SUPERSAMPLE))
+    return out
+
+
+def blend(level):
+    """RGB565 of FORE over BACK, bytes swapped."""
+    color = 0
+    for shift, bits in ((11, 5), (5, 6), (0, 5)):
+        mask = (1 << bits) - 1
+        f, b = (FORE >> shift) & mask, (BACK >> shift) & mask
+        color |= int(round(b + (f - b) * level)) << shift
+    return ((color >> 8) | (color << 8)) & 0xFFFF
+
+
+def digit_shapes(glyph):
+    segs = segments()
+    return [lambda x, y, p=segs[s]: inside(p, x, y) for s in glyph]
+
+
+def sep_shapes(marks):
+    centers = {'colon': [(SEP_WIDTH / 2.0, 11.0), (SEP_WIDTH / 2.0, 21.0)],
+               'point': [(SEP_WIDTH / 2.0, HEIGHT - HALF - 0.2)]}
+    shapes = []
+    for mark in marks:
+        for cx, cy in centers[mark]:
+            shapes.append(lambda x, y, cx=cx, cy=cy:
+                          (x - cx) ** 2 + (y - cy) ** 2 <= DOT * DOT)
+    return shapes
+
+
+def emit(f, pixels, comment):
+    f.write('  /* %s */\n  {\n' % comment)
+    for i in range(0, len(pixels), 12):
+        f.write('    ' + ', '.join('0x%04X' % blend(p) for p in pixels[i:i + 12]) + ',\n')
+    f.write('  },\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('-o', '--output', default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    with open(args.output, 'w', newline='\r\n') as f:
+        f.write(HEADER)
+        f.write('/* Exported variables --------------------------------------------------------*/\n')
+        f.write('const uint16_t TftDigitSprites[TFT_SPRITE_DIGITS]'
+                '[TFT_SPRITE_DIGIT_WIDTH * TFT_SPRITE_HEIGHT] =\n{\n')
+        for glyph, name in zip(GLYPHS, NAMES):
+            emit(f, render(DIGIT_WIDTH, digit_shapes(glyph)), name)
+        f.write('};\n\n')
+        f.write('const uint16_t TftSepSprites[TFT_SPRITE_SEPS]'
+                '[TFT_SPRITE_SEP_WIDTH * TFT_SPRITE_HEIGHT] =\n{\n')
+        for marks, name in zip(SEPARATORS, SEP_NAMES):
+            emit(f, render(SEP_WIDTH, sep_shapes(marks)), name)
+        f.write('};\n\n')
+        f.write(FOOTER)
+    print('%d digit and %d separator sprites written to %s'
+          % (len(GLYPHS), len(SEPARATORS), args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())